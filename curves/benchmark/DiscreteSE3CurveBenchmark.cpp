@@ -0,0 +1,103 @@
+/*
+ * DiscreteSE3CurveBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "curves/DiscreteSE3Curve.hpp"
+
+using namespace curves;
+
+typedef DiscreteSE3Curve::ValueType ValueType;
+
+namespace {
+
+const int kNumQueries = 10000;
+
+// Non-uniform timestamps, e.g. camera frames with dropouts.
+void getSamples(int numKnots, std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  std::mt19937 generator(1);
+  std::exponential_distribution<double> gap(30.0);
+  Time time = 0.0;
+  for (int k = 0; k < numKnots; ++k) {
+    time += gap(generator) + 1e-4;
+    times->push_back(time);
+    values->push_back(ValueType(ValueType::Position(time, 0.0, 0.0), ValueType::Rotation()));
+  }
+}
+
+std::vector<Time> getQueryTimes(const std::vector<Time>& times)
+{
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<double> queryTime(times.front(), times.back());
+  std::vector<Time> queryTimes(kNumQueries);
+  for (int i = 0; i < kNumQueries; ++i) {
+    queryTimes[i] = queryTime(generator);
+  }
+  return queryTimes;
+}
+
+void getNearestKnot(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(state.range(0), &times, &values);
+  DiscreteSE3Curve curve;
+  curve.fitCurve(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  Time knotTime;
+  for (auto _ : state) {
+    for (size_t i = 0; i < queryTimes.size(); ++i) {
+      curve.getNearestKnot(queryTimes[i], &knotTime);
+      benchmark::DoNotOptimize(knotTime);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+// Same query through the search in the coefficient map.
+void getNearestKnotInMap(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(state.range(0), &times, &values);
+  LocalSupport2CoefficientManager<ValueType> manager;
+  manager.insertCoefficients(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  LocalSupport2CoefficientManager<ValueType>::CoefficientIter a, b;
+  for (auto _ : state) {
+    for (size_t i = 0; i < queryTimes.size(); ++i) {
+      manager.getCoefficientsAt(queryTimes[i], &a, &b);
+      Time knotTime = (b->first - queryTimes[i] < queryTimes[i] - a->first) ? b->first : a->first;
+      benchmark::DoNotOptimize(knotTime);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+void associate(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(state.range(0), &times, &values);
+  DiscreteSE3Curve curve;
+  curve.fitCurve(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  std::vector<int> knotIndices;
+  for (auto _ : state) {
+    curve.associate(queryTimes, 0.01, &knotIndices);
+    benchmark::DoNotOptimize(knotIndices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+} // namespace
+
+BENCHMARK(getNearestKnot)->Arg(1000)->Arg(100000);
+BENCHMARK(getNearestKnotInMap)->Arg(1000)->Arg(100000);
+BENCHMARK(associate)->Arg(1000)->Arg(100000);
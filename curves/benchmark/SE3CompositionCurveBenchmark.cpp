@@ -0,0 +1,94 @@
+/*
+ * SE3CompositionCurveBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "curves/CubicHermiteSE3Curve.hpp"
+#include "curves/SE3CompositionCurve.hpp"
+
+using namespace curves;
+
+typedef SE3CompositionCurve<CubicHermiteSE3Curve, CubicHermiteSE3Curve> HermiteCompositionCurve;
+typedef HermiteCompositionCurve::ValueType ValueType;
+typedef HermiteCompositionCurve::DerivativeType DerivativeType;
+
+namespace {
+
+const int kNumBaseKnots = 1000;
+const int kCorrectionRatio = 10;
+const int kNumQueries = 1000;
+
+// Base curve at 10 Hz with a correction every tenth knot.
+void setupCurve(HermiteCompositionCurve* curve)
+{
+  std::vector<Time> times, correctionTimes;
+  std::vector<ValueType> values;
+  for (int k = 0; k < kNumBaseKnots; ++k) {
+    const double t = 0.1 * k;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(std::cos(0.2 * t), std::sin(0.2 * t), 0.01 * t),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.2 * t, 0.1 * std::sin(t), 0.0))));
+    if (k % kCorrectionRatio == 0 || k == kNumBaseKnots - 1) {
+      correctionTimes.push_back(t);
+    }
+  }
+  curve->fitCurve(times, values);
+  curve->resetCorrectionCurve(correctionTimes);
+  for (size_t i = 0; i < correctionTimes.size(); ++i) {
+    const double t = correctionTimes[i];
+    curve->setCorrectionCoefficientAtTime(t, ValueType(ValueType::Position(0.01 * std::sin(t), 0.0, 0.0),
+                                                       ValueType::Rotation(kindr::EulerAnglesZyxD(0.001 * t, 0.0, 0.0))));
+  }
+}
+
+std::vector<Time> getQueryTimes(const HermiteCompositionCurve& curve)
+{
+  std::vector<Time> times(kNumQueries);
+  const double dt = (curve.getMaxTime() - curve.getMinTime()) / kNumQueries;
+  for (int i = 0; i < kNumQueries; ++i) {
+    times[i] = curve.getMinTime() + (i + 0.37) * dt;
+  }
+  return times;
+}
+
+void evaluate(benchmark::State& state, HermiteCompositionCurve::CompositionStrategy strategy)
+{
+  HermiteCompositionCurve curve(strategy);
+  setupCurve(&curve);
+  const std::vector<Time> times = getQueryTimes(curve);
+  ValueType value;
+  for (auto _ : state) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      curve.evaluate(value, times[i]);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+void evaluateDerivative(benchmark::State& state, HermiteCompositionCurve::CompositionStrategy strategy)
+{
+  HermiteCompositionCurve curve(strategy);
+  setupCurve(&curve);
+  const std::vector<Time> times = getQueryTimes(curve);
+  DerivativeType derivative;
+  for (auto _ : state) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      curve.evaluateDerivative(derivative, times[i], 1);
+      benchmark::DoNotOptimize(derivative);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(evaluate, ComposeCurves, HermiteCompositionCurve::kComposeCurves);
+BENCHMARK_CAPTURE(evaluate, InterpolateComposedKnots, HermiteCompositionCurve::kInterpolateComposedKnots);
+BENCHMARK_CAPTURE(evaluateDerivative, ComposeCurves, HermiteCompositionCurve::kComposeCurves);
+BENCHMARK_CAPTURE(evaluateDerivative, InterpolateComposedKnots, HermiteCompositionCurve::kInterpolateComposedKnots);
@@ -0,0 +1,45 @@
+/*
+ * SE3CurveFactoryBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "curves/SE3CurveFactory.hpp"
+
+using namespace curves;
+
+namespace {
+
+// Short-lived curves, created and destroyed right away.
+void createCurveByName(benchmark::State& state)
+{
+  for (auto _ : state) {
+    std::shared_ptr<SE3Curve> curve = SE3CurveFactory::create_curve("slerp_hermite_composition_curve");
+    benchmark::DoNotOptimize(curve.get());
+  }
+}
+
+void createCurve(benchmark::State& state)
+{
+  for (auto _ : state) {
+    std::shared_ptr<SE3Curve> curve = SE3CurveFactory::createCurve(kSlerpHermiteCompositionCurve);
+    benchmark::DoNotOptimize(curve.get());
+  }
+}
+
+void createCurveInPool(benchmark::State& state)
+{
+  SE3CurvePool pool;
+  for (auto _ : state) {
+    SE3CurvePool::CurvePtr curve = pool.createCurve(kSlerpHermiteCompositionCurve);
+    benchmark::DoNotOptimize(curve.get());
+  }
+}
+
+} // namespace
+
+BENCHMARK(createCurveByName);
+BENCHMARK(createCurve);
+BENCHMARK(createCurveInPool);
@@ -0,0 +1,105 @@
+/*
+ * SlerpSE3CurveBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "curves/CubicHermiteSE3Curve.hpp"
+#include "curves/SlerpSE3Curve.hpp"
+
+using namespace curves;
+
+typedef SE3Curve::ValueType ValueType;
+typedef SE3Curve::DerivativeType DerivativeType;
+
+namespace {
+
+const int kNumKnots = 1000;
+const int kNumQueries = 10000;
+
+void getSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  for (int k = 0; k < kNumKnots; ++k) {
+    const double t = 0.1 * k;
+    times->push_back(t);
+    values->push_back(ValueType(ValueType::Position(std::cos(0.2 * t), std::sin(0.2 * t), 0.01 * t),
+                                ValueType::Rotation(kindr::EulerAnglesZyxD(0.2 * t, 0.1 * std::sin(t), 0.0))));
+  }
+}
+
+// Sequential queries, several per segment as for playback or resampling.
+std::vector<Time> getQueryTimes(const std::vector<Time>& times)
+{
+  std::vector<Time> queryTimes(kNumQueries);
+  const double dt = (times.back() - times.front()) / kNumQueries;
+  for (int i = 0; i < kNumQueries; ++i) {
+    queryTimes[i] = times.front() + (i + 0.37) * dt;
+  }
+  return queryTimes;
+}
+
+template <class CurveType>
+void evaluate(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CurveType curve;
+  curve.fitCurve(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  ValueType value;
+  for (auto _ : state) {
+    for (size_t i = 0; i < queryTimes.size(); ++i) {
+      curve.evaluate(value, queryTimes[i]);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+template <class CurveType>
+void evaluateDerivative(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CurveType curve;
+  curve.fitCurve(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  DerivativeType derivative;
+  for (auto _ : state) {
+    for (size_t i = 0; i < queryTimes.size(); ++i) {
+      curve.evaluateDerivative(derivative, queryTimes[i], 1);
+      benchmark::DoNotOptimize(derivative);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+void evaluateSlerpInBatch(benchmark::State& state)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE3Curve curve;
+  curve.fitCurve(times, values);
+  const std::vector<Time> queryTimes = getQueryTimes(times);
+  std::vector<ValueType> queryValues;
+  for (auto _ : state) {
+    curve.evaluateInBatch(queryValues, queryTimes);
+    benchmark::DoNotOptimize(queryValues.data());
+  }
+  state.SetItemsProcessed(state.iterations() * queryTimes.size());
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(evaluate, SlerpSE3Curve);
+BENCHMARK_TEMPLATE(evaluate, CubicHermiteSE3Curve);
+BENCHMARK(evaluateSlerpInBatch);
+BENCHMARK_TEMPLATE(evaluateDerivative, SlerpSE3Curve);
+BENCHMARK_TEMPLATE(evaluateDerivative, CubicHermiteSE3Curve);
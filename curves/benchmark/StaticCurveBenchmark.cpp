@@ -0,0 +1,137 @@
+/*
+ * StaticCurveBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <benchmark/benchmark.h>
+
+#include "curves/PolynomialSplineScalarCurve.hpp"
+#include "curves/PolynomialSplineVectorSpaceCurve.hpp"
+#include "curves/StaticCurve.hpp"
+
+using namespace curves;
+
+namespace {
+
+template <class CurveType>
+void fitCurve(CurveType& curve, size_t numKnots);
+
+template <>
+void fitCurve(PolynomialSplineQuinticVector3Curve& curve, size_t numKnots)
+{
+  std::vector<Time> times;
+  std::vector<PolynomialSplineQuinticVector3Curve::ValueType> values;
+  for (size_t k = 0; k < numKnots; ++k) {
+    times.push_back(0.1 * k);
+    values.push_back(PolynomialSplineQuinticVector3Curve::ValueType(std::sin(0.1 * k), std::cos(0.3 * k), 0.01 * k));
+  }
+  curve.fitCurve(times, values);
+}
+
+template <>
+void fitCurve(PolynomialSplineLinearScalarCurve& curve, size_t numKnots)
+{
+  std::vector<Time> times;
+  std::vector<double> values;
+  for (size_t k = 0; k < numKnots; ++k) {
+    times.push_back(0.1 * k);
+    values.push_back(std::sin(0.1 * k));
+  }
+  curve.fitCurve(times, values);
+}
+
+template <class CurveType>
+std::vector<Time> getEvaluationTimes(const CurveType& curve, size_t numTimes)
+{
+  std::vector<Time> times;
+  const double step = (curve.getMaxTime() - curve.getMinTime()) / numTimes;
+  for (size_t i = 0; i < numTimes; ++i) times.push_back(curve.getMinTime() + step * i);
+  return times;
+}
+
+// Dense evaluation through the interface, one virtual call per time.
+template <class CurveType, class Interface>
+void evaluateVirtual(benchmark::State& state)
+{
+  CurveType curve;
+  fitCurve(curve, 20);
+  const std::vector<Time> times = getEvaluationTimes(curve, state.range(0));
+  std::vector<typename CurveType::ValueType> values(times.size());
+  const Interface* virtualCurve = &curve;
+  // Hide the type of the curve from the optimizer, such that the calls are not devirtualized.
+  benchmark::DoNotOptimize(virtualCurve);
+  for (auto _ : state) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      virtualCurve->evaluate(values[i], times[i]);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+// Same evaluation with the type of the curve known at compile time.
+template <class CurveType>
+void evaluateStatic(benchmark::State& state)
+{
+  CurveType curve;
+  fitCurve(curve, 20);
+  const std::vector<Time> times = getEvaluationTimes(curve, state.range(0));
+  std::vector<typename CurveType::ValueType> values(times.size());
+  for (auto _ : state) {
+    StaticCurveTraits<CurveType>::evaluateInBatch(curve, times, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+// Value, velocity and acceleration with the derivative order given at runtime, three lookups.
+template <class CurveType>
+void evaluateDerivativesRuntimeOrder(benchmark::State& state)
+{
+  CurveType curve;
+  fitCurve(curve, 20);
+  const std::vector<Time> times = getEvaluationTimes(curve, state.range(0));
+  typename CurveType::ValueType value;
+  typename CurveType::DerivativeType velocity, acceleration;
+  for (auto _ : state) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      StaticCurveTraits<CurveType>::evaluate(curve, value, times[i]);
+      StaticCurveTraits<CurveType>::evaluateDerivative(curve, velocity, times[i], 1);
+      StaticCurveTraits<CurveType>::evaluateDerivative(curve, acceleration, times[i], 2);
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(velocity);
+      benchmark::DoNotOptimize(acceleration);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+// Same with the orders known at compile time, one lookup and one Horner pass.
+template <class CurveType>
+void evaluateDerivativesCompileTimeOrder(benchmark::State& state)
+{
+  CurveType curve;
+  fitCurve(curve, 20);
+  const std::vector<Time> times = getEvaluationTimes(curve, state.range(0));
+  typename CurveType::ValueType value;
+  std::array<typename CurveType::DerivativeType, 2> derivatives;
+  for (auto _ : state) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      curve.template evaluate<2>(value, derivatives, times[i]);
+      benchmark::DoNotOptimize(value);
+      benchmark::DoNotOptimize(derivatives);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(evaluateVirtual, PolynomialSplineLinearScalarCurve, Curve<ScalarCurveConfig>)->Arg(1000);
+BENCHMARK_TEMPLATE(evaluateStatic, PolynomialSplineLinearScalarCurve)->Arg(1000);
+BENCHMARK_TEMPLATE(evaluateVirtual, PolynomialSplineQuinticVector3Curve, VectorSpaceCurve<3>)->Arg(1000);
+BENCHMARK_TEMPLATE(evaluateStatic, PolynomialSplineQuinticVector3Curve)->Arg(1000);
+BENCHMARK_TEMPLATE(evaluateDerivativesRuntimeOrder, PolynomialSplineQuinticVector3Curve)->Arg(1000);
+BENCHMARK_TEMPLATE(evaluateDerivativesCompileTimeOrder, PolynomialSplineQuinticVector3Curve)->Arg(1000);
@@ -0,0 +1,119 @@
+/*
+ * CubicHermiteSE2Curve.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "curves/LocalSupport2CoefficientManager.hpp"
+#include "curves/SE2Curve.hpp"
+
+namespace curves {
+
+/// Implements the Cubic Hermite curve class on SE2.
+/// The coefficients are the poses and the global twists at the knots. Within a segment [A, B]
+/// of length dt the pose is, with s = (t - t_A) / dt and the Hermite basis h10, h01, h11:
+/// \f[ T(s) = A \boxplus (h_{10}(s) dt v_A + h_{01}(s) (B \boxminus A) + h_{11}(s) dt v_B) \f]
+/// i.e. a cubic polynomial on the position and on the heading, the latter relative to A such that
+/// segments crossing +-pi are interpolated along the shortest arc.
+class CubicHermiteSE2Curve : public SE2Curve {
+ public:
+  typedef SE2Curve::ValueType ValueType;
+  typedef SE2Curve::DerivativeType DerivativeType;
+  typedef SE2Curve::State State;
+
+  /// Pose and twist at a knot.
+  struct Coefficient {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Coefficient() : derivative(DerivativeType::Zero()) {}
+    Coefficient(const ValueType& value, const DerivativeType& derivative)
+        : value(value),
+          derivative(derivative) {}
+
+    ValueType value;
+    DerivativeType derivative;
+  };
+
+  typedef LocalSupport2CoefficientManager<Coefficient>::TimeToKeyCoefficientMap TimeToKeyCoefficientMap;
+  typedef LocalSupport2CoefficientManager<Coefficient>::CoefficientIter CoefficientIter;
+
+  CubicHermiteSE2Curve();
+  virtual ~CubicHermiteSE2Curve();
+
+  /// Print the value of the coefficient, for debugging and unit tests
+  virtual void print(const std::string& str = "") const;
+
+  /// The first valid time for the curve.
+  virtual Time getMinTime() const;
+
+  /// The one past the last valid time for the curve.
+  virtual Time getMaxTime() const;
+
+  bool isEmpty() const;
+
+  // return number of coefficients curve is composed of
+  int size() const;
+
+  /// \brief calculate the slope between 2 coefficients
+  DerivativeType calculateSlope(Time timeA, Time timeB, const ValueType& T_W_A, const ValueType& T_W_B) const;
+
+  /// Extend the curve so that it can be evaluated at these times.
+  /// Note: Assumes that extend times strictly increase the curve time
+  /// The knots are set as if fitCurve was called with all values, extending in batches is
+  /// equivalent to fitting once.
+  virtual void extend(const std::vector<Time>& times,
+                      const std::vector<ValueType>& values,
+                      std::vector<Key>* outKeys = NULL);
+
+  /// \brief Fit a new curve to these data points.
+  ///
+  /// The existing curve will be cleared. The twists are Catmull-Rom slopes at the inner knots and
+  /// the given derivatives at the first and last knot.
+  virtual void fitCurve(const std::vector<Time>& times,
+                        const std::vector<ValueType>& values,
+                        std::vector<Key>* outKeys = NULL);
+
+  virtual void fitCurveWithDerivatives(const std::vector<Time>& times,
+                                       const std::vector<ValueType>& values,
+                                       const DerivativeType& initialDerivative = DerivativeType::Zero(),
+                                       const DerivativeType& finalDerivative = DerivativeType::Zero(),
+                                       std::vector<Key>* outKeys = NULL);
+
+  /// Evaluate the ambient space of the curve.
+  virtual bool evaluate(ValueType& value, Time time) const;
+
+  virtual bool evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const;
+
+  /// Evaluate the curve derivatives, twist (1) and its time derivative (2), higher orders are zero.
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const;
+
+  virtual bool evaluateState(State& state, Time time) const;
+
+  virtual void setTimeRange(Time minTime, Time maxTime);
+
+  // clear the curve
+  virtual void clear();
+
+  /// \brief Perform a rigid transformation on the left side of the curve
+  void transformCurve(const ValueType T);
+
+  void saveCurveTimesAndValues(const std::string& filename) const;
+
+  void getCurveTimes(std::vector<Time>* outTimes) const;
+
+ private:
+  /// Segment that contains the time, a == b if the curve has a single coefficient.
+  bool getSegment(Time time, CoefficientIter* a, CoefficientIter* b) const;
+
+  /// Pose and optionally twist and its time derivative between the coefficients a and b.
+  static void interpolate(CoefficientIter a, CoefficientIter b, Time time, ValueType& value,
+                          DerivativeType* velocity, DerivativeType* acceleration);
+
+  LocalSupport2CoefficientManager<Coefficient> manager_;
+};
+
+} // namespace curves
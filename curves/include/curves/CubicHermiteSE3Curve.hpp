@@ -10,10 +10,12 @@
 
 #include <kindr/Core>
 
+#include "curves/CubicHermiteSE3Interpolation.hpp"
 #include "curves/LocalSupport2CoefficientManager.hpp"
 #include "curves/SamplingPolicy.hpp"
 #include "curves/SE3CompositionCurve.hpp"
 #include "curves/SE3Curve.hpp"
+#include "curves/TimeAffineTransform.hpp"
 
 // wrapper class for Hermite-style coefficients (made of QuatTransformation and Vector6)
 namespace kindr {
@@ -99,6 +101,7 @@ typedef LocalSupport2CoefficientManager<Coefficient>::CoefficientIter Coefficien
 class CubicHermiteSE3Curve : public SE3Curve {
 
   friend class SamplingPolicy;
+  template <class C1, class C2> friend class SE3CompositionCurve;
  public:
   typedef kindr::HermiteTransformation<double> Coefficient;
 
@@ -130,6 +133,8 @@ class CubicHermiteSE3Curve : public SE3Curve {
   /// Extend the curve so that it can be evaluated at these times.
   /// Try to make the curve fit to the values.
   /// Note: Assumes that extend times strictly increase the curve time
+  /// The knots are set as if fitCurve was called with all values, extending in batches is
+  /// equivalent to fitting once.
   virtual void extend(const std::vector<Time>& times,
                       const std::vector<ValueType>& values,
                       std::vector<Key>* outKeys = NULL);
@@ -152,6 +157,21 @@ class CubicHermiteSE3Curve : public SE3Curve {
                                 const std::vector<ValueType>& values,
                                 std::vector<Key>* outKeys = NULL);
 
+  /// \brief Fit the curve to noisy poses instead of interpolating them.
+  ///
+  /// Coefficients are placed at the knot times only, which are usually much fewer than the samples.
+  /// The translation is the smoothing cubic spline which minimizes the weighted squared residuals plus
+  /// roughnessWeight times the integral of the squared acceleration (see PolynomialSplineSmoother).
+  /// The rotation and angular velocity of a knot follow from a weighted linear regression of the
+  /// samples around the knot in the tangent space of the sample closest to the knot.
+  /// Returns false if the fit is ill-posed or a knot has no samples around it.
+  bool fitCurveSmoothing(const std::vector<Time>& knotTimes,
+                         const std::vector<Time>& sampleTimes,
+                         const std::vector<ValueType>& sampleValues,
+                         double roughnessWeight,
+                         const std::vector<double>& sampleWeights = std::vector<double>(),
+                         std::vector<Key>* outKeys = NULL);
+
 
   /// Evaluate the ambient space of the curve.
   virtual bool evaluate(ValueType& value, Time time) const;
@@ -161,6 +181,18 @@ class CubicHermiteSE3Curve : public SE3Curve {
 
   virtual void setTimeRange(Time minTime, Time maxTime);
 
+  /// Stretches and shifts the curve in time, t' = scale*t + offset, without touching the
+  /// coefficients. Derivatives are scaled accordingly, fitting or clearing resets the transform.
+  void transformTime(double scale, double offset);
+
+  const TimeAffineTransform& getTimeTransform() const;
+
+  /// Inserts a coefficient at the given time with the interpolated pose and twist of the curve.
+  /// The translation is unchanged since it is a cubic polynomial in time. The rotation keeps its
+  /// pose and angular velocity at the new knot, but may deviate slightly between the knots.
+  /// Returns false if the time is outside of the curve or at an existing coefficient.
+  bool insertKnot(Time time, Key* outKey = NULL);
+
   bool evaluateLinearAcceleration(kindr::Acceleration3D& linearAcceleration, Time time);
 
   /// \brief Evaluate the angular velocity of Frame b as seen from Frame a, expressed in Frame a.
@@ -267,8 +299,49 @@ class CubicHermiteSE3Curve : public SE3Curve {
 
   void saveCorrectionCurveTimesAndValues(const std::string& filename) const {};
  private:
+  bool evaluateAtCurveTime(ValueType& value, Time time) const;
+  bool evaluateDerivativeAtCurveTime(DerivativeType& derivative, Time time) const;
+
   LocalSupport2CoefficientManager<Coefficient> manager_;
   SamplingPolicy hermitePolicy_;
+  TimeAffineTransform timeTransform_;
+};
+
+// Hermite coefficients store the twist at the knot with the pose.
+template <>
+struct SE3CompositionCoefficientTraits<CubicHermiteSE3Curve> {
+  typedef CubicHermiteSE3Curve::Coefficient Coefficient;
+  typedef LocalSupport2CoefficientManager<Coefficient> CoefficientManager;
+
+  static Coefficient fromValue(const ValueType& value, const DerivativeType& derivative) {
+    return Coefficient(value, derivative);
+  }
+
+  static DerivativeType getDerivative(const Coefficient& coefficient) {
+    return coefficient.getTransformationDerivative();
+  }
+
+  static const bool kIsC1 = true;
+
+  static bool interpolate(const CubicHermiteSE3Curve& curve, CoefficientIter a, CoefficientIter b,
+                          Time time, ValueType& value) {
+    // The coefficients are searched by the time of the composition, which is the curve time only
+    // without time transform.
+    CHECK(curve.getTimeTransform().isIdentity()) << "Composition of a time-transformed curve is not supported.";
+    const Coefficient& coefficientA = a->second.coefficient;
+    if (a == b) {
+      value = coefficientA.getTransformation();
+      return true;
+    }
+    const Coefficient& coefficientB = b->second.coefficient;
+    const double dt = b->first - a->first;
+    interpolateCubicHermiteSE3(value, coefficientA.getTransformation(), coefficientA.getTransformationDerivative(),
+                               coefficientB.getTransformation(), coefficientB.getTransformationDerivative(),
+                               dt, (time - a->first) / dt);
+    return true;
+  }
+
+  static void onKnotsChanged(CubicHermiteSE3Curve* curve, Time begTime) {}
 };
 
 typedef kindr::HomogeneousTransformationPosition3RotationQuaternionD SE3;
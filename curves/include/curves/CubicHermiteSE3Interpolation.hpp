@@ -0,0 +1,29 @@
+/*
+ * CubicHermiteSE3Interpolation.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include "curves/SE3Config.hpp"
+
+namespace curves {
+
+/*
+ * Cubic Hermite interpolation on SE3 between the poses T_W_A and T_W_B with their global twists
+ * d_W_A and d_W_B, which are dt apart (see CubicHermiteSE3Curve for the equations). alpha in [0, 1]
+ * is the normalized time in the interval. Shared by the curves which store Hermite knots.
+ */
+void interpolateCubicHermiteSE3(SE3Config::ValueType& value,
+                                const SE3Config::ValueType& T_W_A, const SE3Config::DerivativeType& d_W_A,
+                                const SE3Config::ValueType& T_W_B, const SE3Config::DerivativeType& d_W_B,
+                                double dt, double alpha);
+
+/// Global twist of the cubic Hermite interpolation above.
+void interpolateCubicHermiteSE3Derivative(SE3Config::DerivativeType& derivative,
+                                          const SE3Config::ValueType& T_W_A, const SE3Config::DerivativeType& d_W_A,
+                                          const SE3Config::ValueType& T_W_B, const SE3Config::DerivativeType& d_W_B,
+                                          double dt, double alpha);
+
+} // namespace curves
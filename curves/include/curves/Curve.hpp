@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 namespace curves {
 
 typedef double Time;
@@ -8,19 +8,26 @@
 #define CURVES_DISCRETE_SE3_CURVE_HPP
 
 #include "SE3Curve.hpp"
+#include "KnotTimeIndex.hpp"
 #include "LocalSupport2CoefficientManager.hpp"
 #include "SE3CompositionCurve.hpp"
-#include "gtsam/nonlinear/NonlinearFactorGraph.h"
 #include "SamplingPolicy.hpp"
-#include "CubicHermiteSE3Curve.hpp"
 
 namespace curves {
 
 /// Implements a discrete SE3 curve class.
+/// The curve takes the value of the nearest knot, e.g. to look up the pose at a camera timestamp.
+/// Knot queries go through a time-bucketed index (see KnotTimeIndex) which is O(1) expected instead
+/// of a search in the coefficient map. The index is built by the functions modifying the curve,
+/// evaluation does not modify the curve and can run concurrently.
 class DiscreteSE3Curve : public SE3Curve {
   friend class SE3CompositionCurve<DiscreteSE3Curve, DiscreteSE3Curve>;
+  friend struct SE3CompositionCoefficientTraits<DiscreteSE3Curve>;
   friend class SamplingPolicy;
  public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  typedef SE3Curve::ValueType ValueType;
+  typedef SE3Curve::DerivativeType DerivativeType;
   typedef ValueType Coefficient;
   typedef LocalSupport2CoefficientManager<Coefficient>::TimeToKeyCoefficientMap TimeToKeyCoefficientMap;
   typedef LocalSupport2CoefficientManager<Coefficient>::CoefficientIter CoefficientIter;
@@ -62,8 +69,10 @@ class DiscreteSE3Curve : public SE3Curve {
   void setCurve(const std::vector<Time>& times,
                 const std::vector<ValueType>& values);
 
-  /// Evaluate the ambient space of the curve.
-  virtual ValueType evaluate(Time time) const;
+  /// Evaluate the ambient space of the curve, the value of the nearest knot.
+  virtual bool evaluate(ValueType& value, Time time) const;
+
+  bool evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const;
 
   /// Evaluate the curve derivatives.
   /// linear 1st derivative has following behaviour:
@@ -72,12 +81,26 @@ class DiscreteSE3Curve : public SE3Curve {
   /// - time is on coefficient (not last coefficient) --> take slope between coefficient and next coefficients
   /// - time is on last coefficient --> take slope between last-1 and last coefficient
   /// derivatives of order >1 equal 0
-  virtual DerivativeType evaluateDerivative(Time time, unsigned derivativeOrder) const;
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const;
+
+  /// \brief Time and value of the last knot at or before the time.
+  /// Returns false if the curve is empty or the time is before the first knot.
+  bool getPreviousKnot(Time time, Time* knotTime, ValueType* value = NULL) const;
+
+  /// \brief Time and value of the knot closest to the time, ties go to the earlier knot.
+  /// Returns false if the curve is empty.
+  bool getNearestKnot(Time time, Time* knotTime, ValueType* value = NULL) const;
 
-  /// \brief Get an evaluator at this time
-  virtual gtsam::Expression<ValueType> getValueExpression(const Time& time) const;
+  /// \brief Associates (sensor) timestamps to their nearest knots.
+  /// outKnotIndices[i] is the index of the knot for times[i] (see getKnot), or -1 if the nearest
+  /// knot is further away than maxTimeDifference. The times do not have to be sorted.
+  /// Returns the number of associated times.
+  size_t associate(const std::vector<Time>& times, Time maxTimeDifference,
+                   std::vector<int>* outKnotIndices) const;
 
-  virtual gtsam::Expression<DerivativeType> getDerivativeExpression(const Time& time, unsigned derivativeOrder) const;
+  /// \brief Time, value and optionally key of the knot with this index, the knots are indexed
+  /// in time order. The indices are valid until the curve is modified.
+  void getKnot(size_t index, Time* knotTime, ValueType* value, Key* key = NULL) const;
 
   virtual void setTimeRange(Time minTime, Time maxTime);
 
@@ -125,15 +148,6 @@ class DiscreteSE3Curve : public SE3Curve {
   ///        and the angular velocity (3,4,5).
   virtual Vector6d evaluateDerivativeB(unsigned derivativeOrder, Time time);
 
-  /// Initialize a GTSAM values structure with the desired keys
-  virtual void initializeGTSAMValues(gtsam::KeySet keys, gtsam::Values* values) const;
-
-  /// Initialize a GTSAM values structure for all keys
-  virtual void initializeGTSAMValues(gtsam::Values* values) const;
-
-  // updates the relevant curve coefficients from the GTSAM values structure
-  virtual void updateFromGTSAMValues(const gtsam::Values& values);
-
   // set minimum sampling period
   void setMinSamplingPeriod(Time time);
 
@@ -143,13 +157,10 @@ class DiscreteSE3Curve : public SE3Curve {
 
   virtual void clear();
 
-  /// \brief Add factors to constrain the variables active at this time.
-  void addPriorFactors(gtsam::NonlinearFactorGraph* graph, Time priorTime) const;
-
   /// \brief Perform a rigid transformation on the left side of the curve
   void transformCurve(const ValueType T);
 
-  virtual Time getTimeAtKey(gtsam::Key key) const;
+  virtual Time getTimeAtKey(Key key) const;
 
   void saveCurveTimesAndValues(const std::string& filename) const;
 
@@ -202,20 +213,41 @@ class DiscreteSE3Curve : public SE3Curve {
   void saveCorrectionCurveTimesAndValues(const std::string& filename) const {};
 
  private:
+  /// Rebuilds the knot index, after the coefficients were modified anywhere.
+  void rebuildIndex();
+
+  /// Updates the knot index after coefficients at or after begTime were added, removed or moved,
+  /// in O(1) amortized per updated knot. Coefficients inserted before begTime rebuild the index.
+  /// The functions of SE3CompositionCurve which modify the knots call it as well.
+  void updateIndex(Time begTime);
+
+  /// Fails if the knots were modified without updating the index.
+  void checkIndex() const;
+
   LocalSupport2CoefficientManager<Coefficient> manager_;
   SamplingPolicy discretePolicy_;
+
+  /// Knot times and coefficients in time order.
+  KnotTimeIndex index_;
+  std::vector<CoefficientIter> knots_;
+  /// Revision of the manager the index was built for.
+  size_t indexRevision_;
 };
 
-typedef kindr::minimal::QuatTransformationTemplate<double> SE3;
-typedef SE3::Rotation SO3;
-typedef kindr::minimal::AngleAxisTemplate<double> AngleAxis;
+// The composition adds, removes and moves coefficients in the manager of the curve.
+template <>
+inline void SE3CompositionCoefficientTraits<DiscreteSE3Curve>::onKnotsChanged(DiscreteSE3Curve* curve,
+                                                                             Time begTime) {
+  curve->updateIndex(begTime);
+}
 
-// extend policy for slerp curves
+// extend policy for discrete curves
 template<>
-inline void SamplingPolicy::extend<DiscreteSE3Curve, SE3>(const std::vector<Time>& times,
-                                                          const std::vector<SE3>& values,
-                                                          DiscreteSE3Curve* curve,
-                                                          std::vector<Key>* outKeys) {
+inline void SamplingPolicy::extend<DiscreteSE3Curve, DiscreteSE3Curve::ValueType>(
+    const std::vector<Time>& times,
+    const std::vector<DiscreteSE3Curve::ValueType>& values,
+    DiscreteSE3Curve* curve,
+    std::vector<Key>* outKeys) {
   //todo: deal with minSamplingPeriod_ when extending with multiple times
   if (times.size() != 1) {
     curve->manager_.insertCoefficients(times, values, outKeys);
@@ -0,0 +1,107 @@
+/*
+ * GaussianProcessSE3Curve.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include <kindr/Core>
+
+#include "curves/Curve.hpp"
+#include "curves/SE3Config.hpp"
+#include "curves/GaussianProcessTrajectory.hpp"
+
+namespace curves {
+
+/// Rotations of a Gaussian process trajectory, perturbed on the left (global angular velocity).
+struct GaussianProcessRotationSpace {
+  typedef kindr::RotationQuaternionPD ValueType;
+  typedef Eigen::Vector3d TangentType;
+
+  static ValueType boxPlus(const ValueType& value, const TangentType& tangent)
+  {
+    return value.boxPlus(tangent);
+  }
+
+  static TangentType boxMinus(const ValueType& value, const ValueType& reference)
+  {
+    return value.boxMinus(reference);
+  }
+};
+
+/*
+ * SE3 trajectory estimated from noisy pose measurements by Gaussian process regression with
+ * white-noise-on-acceleration priors on the translation and on the rotation (see
+ * GaussianProcessTrajectory). The rotation is estimated in the tangent space of its current
+ * estimate, which neglects the Jacobians of the exponential map (valid for small rotations between
+ * the measurements). Measurements are added in time order, incrementally with addMeasurement or
+ * extend.
+ *
+ * The curve implements the plain Curve interface, the correction curve interface of SE3Curve does
+ * not apply to an estimated trajectory.
+ */
+class GaussianProcessSE3Curve : public Curve<SE3Config> {
+ public:
+  typedef Curve<SE3Config> Parent;
+  typedef Parent::ValueType ValueType;
+  typedef Parent::DerivativeType DerivativeType;
+  typedef GaussianProcessTrajectory<GaussianProcessVectorSpace<3> > TranslationTrajectory;
+  typedef GaussianProcessTrajectory<GaussianProcessRotationSpace> RotationTrajectory;
+
+  /// The power spectral densities of the linear and angular acceleration noise set the smoothness
+  /// of the curve, the measurement variances (m^2, rad^2) the trust in the poses.
+  GaussianProcessSE3Curve(double translationalPowerSpectralDensity = 1.0,
+                          double rotationalPowerSpectralDensity = 1.0,
+                          double positionVariance = 1.0,
+                          double rotationVariance = 1.0);
+  virtual ~GaussianProcessSE3Curve();
+
+  virtual void print(const std::string& str = "") const;
+
+  virtual Time getMinTime() const;
+  virtual Time getMaxTime() const;
+  bool isEmpty() const;
+  int size() const;
+
+  virtual bool evaluate(ValueType& value, Time time) const;
+
+  /// Linear and (global) angular velocity of the posterior mean, only the first derivative is supported.
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned int derivativeOrder) const;
+
+  /// Posterior variances of every component of the position and of the rotation at the time.
+  bool evaluateVariance(double& positionVariance, double& rotationVariance, Time time) const;
+
+  /// Adds one pose measurement with its own variances, in time order, and updates the estimate.
+  void addMeasurement(Time time, const ValueType& value, double positionVariance, double rotationVariance);
+
+  /// Adds pose measurements with the measurement variances and updates the estimate once.
+  virtual void extend(const std::vector<Time>& times,
+                      const std::vector<ValueType>& values,
+                      std::vector<Key>* outKeys = NULL);
+
+  virtual void fitCurve(const std::vector<Time>& times,
+                        const std::vector<ValueType>& values,
+                        std::vector<Key>* outKeys = NULL);
+
+  void setMeasurementVariances(double positionVariance, double rotationVariance);
+  void setSmoothingTolerance(double smoothingTolerance);
+
+  const TranslationTrajectory& getTranslationTrajectory() const;
+  const RotationTrajectory& getRotationTrajectory() const;
+
+  virtual void clear();
+
+  virtual void transformCurve(const ValueType T);
+
+ private:
+  TranslationTrajectory translation_;
+  RotationTrajectory rotation_;
+  double positionVariance_;
+  double rotationVariance_;
+};
+
+} /* namespace */
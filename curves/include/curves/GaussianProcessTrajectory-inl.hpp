@@ -0,0 +1,286 @@
+/*
+ * GaussianProcessTrajectory-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/GaussianProcessTrajectory.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glog/logging.h>
+
+namespace curves {
+
+template <typename Space>
+GaussianProcessTrajectory<Space>::GaussianProcessTrajectory()
+    : numSmoothedStates_(0),
+      powerSpectralDensity_(1.0),
+      initialVelocityVariance_(1.0e4),
+      smoothingTolerance_(1.0e-9)
+{
+}
+
+template <typename Space>
+GaussianProcessTrajectory<Space>::~GaussianProcessTrajectory()
+{
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::setPowerSpectralDensity(double powerSpectralDensity)
+{
+  CHECK_GT(powerSpectralDensity, 0.0);
+  powerSpectralDensity_ = powerSpectralDensity;
+}
+
+template <typename Space>
+double GaussianProcessTrajectory<Space>::getPowerSpectralDensity() const
+{
+  return powerSpectralDensity_;
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::setInitialVelocityVariance(double initialVelocityVariance)
+{
+  CHECK_GT(initialVelocityVariance, 0.0);
+  initialVelocityVariance_ = initialVelocityVariance;
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::setSmoothingTolerance(double smoothingTolerance)
+{
+  CHECK_GE(smoothingTolerance, 0.0);
+  smoothingTolerance_ = smoothingTolerance;
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::addMeasurement(double time, const ValueType& value, double variance,
+                                                      bool smooth)
+{
+  CHECK_GT(variance, 0.0);
+
+  if (states_.empty()) {
+    // The first measurement fixes the value, the velocity is only known from the prior.
+    State state;
+    state.time = time;
+    state.filteredValue = value;
+    state.filteredVelocity = TangentType::Zero(state.filteredVelocity.size());
+    state.filteredCovariance << variance, 0.0, 0.0, initialVelocityVariance_;
+    state.predictedValue = state.filteredValue;
+    state.predictedVelocity = state.filteredVelocity;
+    state.predictedCovariance = state.filteredCovariance;
+    state.gain.setZero();
+    states_.push_back(state);
+    times_.push_back(time);
+  } else {
+    CHECK_GE(time, times_.back()) << "Measurements have to be added in time order.";
+    if (time > times_.back()) {
+      const State& last = states_.back();
+      const double dt = time - last.time;
+      const Matrix transition = WhiteNoiseOnAccelerationPrior::getTransitionMatrix(dt);
+
+      State state;
+      state.time = time;
+      state.predictedValue = Space::boxPlus(last.filteredValue, dt*last.filteredVelocity);
+      state.predictedVelocity = last.filteredVelocity;
+      state.predictedCovariance = transition * last.filteredCovariance * transition.transpose()
+          + WhiteNoiseOnAccelerationPrior::getProcessCovariance(dt, powerSpectralDensity_);
+      state.filteredValue = state.predictedValue;
+      state.filteredVelocity = state.predictedVelocity;
+      state.filteredCovariance = state.predictedCovariance;
+      state.gain.setZero();
+      states_.push_back(state);
+      times_.push_back(time);
+    }
+
+    // Measurement update of the last state, the measurement observes the value only.
+    State& state = states_.back();
+    const TangentType innovation = Space::boxMinus(value, state.filteredValue);
+    const Eigen::Vector2d kalmanGain = state.filteredCovariance.col(0) / (state.filteredCovariance(0, 0) + variance);
+    state.filteredValue = Space::boxPlus(state.filteredValue, kalmanGain(0)*innovation);
+    state.filteredVelocity += kalmanGain(1)*innovation;
+    state.filteredCovariance -= kalmanGain * state.filteredCovariance.row(0);
+  }
+
+  numSmoothedStates_ = std::min(numSmoothedStates_, states_.size() - 1);
+  if (smooth) this->smooth();
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::smooth()
+{
+  if (states_.empty()) return;
+
+  State& last = states_.back();
+  last.value = last.filteredValue;
+  last.velocity = last.filteredVelocity;
+  last.covariance = last.filteredCovariance;
+
+  for (int k = static_cast<int>(states_.size()) - 2; k >= 0; --k) {
+    State& state = states_[k];
+    const State& next = states_[k+1];
+    const Matrix transition = WhiteNoiseOnAccelerationPrior::getTransitionMatrix(next.time - state.time);
+    const Matrix gain = state.filteredCovariance * transition.transpose() * next.predictedCovariance.inverse();
+
+    const TangentType valueCorrection = Space::boxMinus(next.value, next.predictedValue);
+    const TangentType velocityCorrection = next.velocity - next.predictedVelocity;
+    const ValueType value = Space::boxPlus(state.filteredValue, gain(0, 0)*valueCorrection + gain(0, 1)*velocityCorrection);
+    const TangentType velocity = state.filteredVelocity + gain(1, 0)*valueCorrection + gain(1, 1)*velocityCorrection;
+    const Matrix covariance = state.filteredCovariance
+        + gain * (next.covariance - next.predictedCovariance) * gain.transpose();
+
+    // Earlier states only change if this one changed.
+    const bool isConverged = static_cast<size_t>(k) < numSmoothedStates_
+        && Space::boxMinus(value, state.value).norm() <= smoothingTolerance_
+        && (velocity - state.velocity).norm() <= smoothingTolerance_
+        && (covariance - state.covariance).cwiseAbs().maxCoeff() <= smoothingTolerance_;
+
+    state.value = value;
+    state.velocity = velocity;
+    state.covariance = covariance;
+    state.gain = gain;
+    if (isConverged) break;
+  }
+  numSmoothedStates_ = states_.size();
+}
+
+template <typename Space>
+void GaussianProcessTrajectory<Space>::clear()
+{
+  states_.clear();
+  times_.clear();
+  numSmoothedStates_ = 0;
+}
+
+template <typename Space>
+bool GaussianProcessTrajectory<Space>::isEmpty() const
+{
+  return states_.empty();
+}
+
+template <typename Space>
+unsigned int GaussianProcessTrajectory<Space>::size() const
+{
+  return states_.size();
+}
+
+template <typename Space>
+double GaussianProcessTrajectory<Space>::getMinTime() const
+{
+  return times_.empty() ? 0.0 : times_.front();
+}
+
+template <typename Space>
+double GaussianProcessTrajectory<Space>::getMaxTime() const
+{
+  return times_.empty() ? 0.0 : times_.back();
+}
+
+template <typename Space>
+const std::vector<double>& GaussianProcessTrajectory<Space>::getTimes() const
+{
+  return times_;
+}
+
+template <typename Space>
+const typename GaussianProcessTrajectory<Space>::ValueType& GaussianProcessTrajectory<Space>::getValue(
+    unsigned int stateIdx) const
+{
+  CHECK_LT(stateIdx, states_.size());
+  return states_[stateIdx].value;
+}
+
+template <typename Space>
+const typename GaussianProcessTrajectory<Space>::TangentType& GaussianProcessTrajectory<Space>::getVelocity(
+    unsigned int stateIdx) const
+{
+  CHECK_LT(stateIdx, states_.size());
+  return states_[stateIdx].velocity;
+}
+
+template <typename Space>
+const typename GaussianProcessTrajectory<Space>::Matrix& GaussianProcessTrajectory<Space>::getCovariance(
+    unsigned int stateIdx) const
+{
+  CHECK_LT(stateIdx, states_.size());
+  return states_[stateIdx].covariance;
+}
+
+template <typename Space>
+int GaussianProcessTrajectory<Space>::getIntervalIndex(double time) const
+{
+  if (times_.empty() || time < times_.front() || time > times_.back()) return -1;
+  if (times_.size() == 1) return 0;
+  const int idx = std::upper_bound(times_.begin(), times_.end(), time) - times_.begin() - 1;
+  return std::min(idx, static_cast<int>(times_.size()) - 2);
+}
+
+/*
+ * In the tangent space of the earlier state, the mean between two states is the cubic Hermite
+ * interpolation of the values and velocities of the states.
+ */
+template <typename Space>
+bool GaussianProcessTrajectory<Space>::interpolate(double time, ValueType& value, TangentType* velocity,
+                                                   TangentType* acceleration) const
+{
+  CHECK_EQ(numSmoothedStates_, states_.size()) << "The trajectory has to be smoothed before evaluating it.";
+  const int k = getIntervalIndex(time);
+  if (k < 0) return false;
+
+  const State& state = states_[k];
+  if (states_.size() == 1) {
+    value = state.value;
+    if (velocity != NULL) *velocity = state.velocity;
+    if (acceleration != NULL) *acceleration = TangentType::Zero(state.velocity.size());
+    return true;
+  }
+
+  const State& next = states_[k+1];
+  const double dt = next.time - state.time;
+  const double s = (time - state.time) / dt;
+  const double s2 = s*s;
+  const double s3 = s2*s;
+  const TangentType nextValue = Space::boxMinus(next.value, state.value);
+
+  value = Space::boxPlus(state.value, (s3 - 2.0*s2 + s)*dt*state.velocity + (-2.0*s3 + 3.0*s2)*nextValue
+                                      + (s3 - s2)*dt*next.velocity);
+  if (velocity != NULL) {
+    *velocity = (3.0*s2 - 4.0*s + 1.0)*state.velocity + ((6.0*s - 6.0*s2)/dt)*nextValue + (3.0*s2 - 2.0*s)*next.velocity;
+  }
+  if (acceleration != NULL) {
+    *acceleration = ((6.0*s - 4.0)/dt)*state.velocity + ((6.0 - 12.0*s)/(dt*dt))*nextValue + ((6.0*s - 2.0)/dt)*next.velocity;
+  }
+  return true;
+}
+
+template <typename Space>
+bool GaussianProcessTrajectory<Space>::getVariance(double time, double& variance) const
+{
+  CHECK_EQ(numSmoothedStates_, states_.size()) << "The trajectory has to be smoothed before evaluating it.";
+  const int k = getIntervalIndex(time);
+  if (k < 0) return false;
+
+  const State& state = states_[k];
+  if (states_.size() == 1) {
+    variance = state.covariance(0, 0);
+    return true;
+  }
+
+  const State& next = states_[k+1];
+  const double dt = next.time - state.time;
+  const double tau = std::min(std::max(time - state.time, 0.0), dt);
+  Matrix lambda, psi;
+  WhiteNoiseOnAccelerationPrior::getInterpolationMatrices(tau, dt, powerSpectralDensity_, lambda, psi);
+
+  const Matrix crossCovariance = state.gain * next.covariance;
+  const Matrix jointPart = lambda * state.covariance * lambda.transpose() + psi * next.covariance * psi.transpose()
+      + lambda * crossCovariance * psi.transpose() + psi * crossCovariance.transpose() * lambda.transpose();
+  const Matrix processCovariance = WhiteNoiseOnAccelerationPrior::getProcessCovariance(tau, powerSpectralDensity_);
+  const Matrix conditionalCovariance = processCovariance
+      - psi * WhiteNoiseOnAccelerationPrior::getTransitionMatrix(dt - tau) * processCovariance;
+  variance = jointPart(0, 0) + conditionalCovariance(0, 0);
+  return true;
+}
+
+} /* namespace */
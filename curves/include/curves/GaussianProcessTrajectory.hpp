@@ -0,0 +1,168 @@
+/*
+ * GaussianProcessTrajectory.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+namespace curves {
+
+/*
+ * White-noise-on-acceleration (constant velocity) prior of a Gaussian process trajectory, with the
+ * power spectral density qc of the acceleration noise. The state is position and velocity, and the
+ * prior is Markovian, such that its inverse kernel is block-tridiagonal. The noise is isotropic,
+ * so all dimensions share the 2x2 matrices below.
+ */
+struct WhiteNoiseOnAccelerationPrior {
+  typedef Eigen::Matrix2d Matrix;
+
+  /// Transition of (position, velocity) over dt.
+  static Matrix getTransitionMatrix(double dt)
+  {
+    Matrix transition;
+    transition << 1.0, dt, 0.0, 1.0;
+    return transition;
+  }
+
+  /// Covariance of the process noise accumulated over dt.
+  static Matrix getProcessCovariance(double dt, double powerSpectralDensity)
+  {
+    Matrix covariance;
+    covariance << dt*dt*dt/3.0, dt*dt/2.0, dt*dt/2.0, dt;
+    return powerSpectralDensity * covariance;
+  }
+
+  /*
+   * Interpolation between two states at tau in [0, dt] after the first one: the mean is
+   * lambda*x_k + psi*x_k+1, with psi = Q(tau) Phi(dt-tau)' Q(dt)^-1 and lambda = Phi(tau) - psi Phi(dt).
+   * For this prior, the mean position is the cubic Hermite interpolation of the two states.
+   */
+  static void getInterpolationMatrices(double tau, double dt, double powerSpectralDensity,
+                                       Matrix& lambda, Matrix& psi)
+  {
+    psi = getProcessCovariance(tau, powerSpectralDensity) * getTransitionMatrix(dt - tau).transpose()
+        * getProcessCovariance(dt, powerSpectralDensity).inverse();
+    lambda = getTransitionMatrix(tau) - psi * getTransitionMatrix(dt);
+  }
+};
+
+/// Euclidean space of a Gaussian process trajectory.
+template <int N>
+struct GaussianProcessVectorSpace {
+  typedef Eigen::Matrix<double, N, 1> ValueType;
+  typedef Eigen::Matrix<double, N, 1> TangentType;
+
+  static ValueType boxPlus(const ValueType& value, const TangentType& tangent)
+  {
+    return value + tangent;
+  }
+
+  static TangentType boxMinus(const ValueType& value, const ValueType& reference)
+  {
+    return value - reference;
+  }
+};
+
+/*
+ * Gaussian process regression of a trajectory in a space with a white-noise-on-acceleration prior.
+ * The states at the measurement times are estimated by a Kalman filter and a Rauch-Tung-Striebel
+ * smoother, which is the sparse O(n) solution of the batch problem with the block-tridiagonal
+ * inverse kernel. States between the measurement times are interpolated from the two neighboring
+ * states with the prior.
+ *
+ * Measurements arrive in time order, every measurement costs a filter step and a backward pass of
+ * the smoother, which stops once the smoothed states do not change by more than the smoothing
+ * tolerance anymore. Since the influence of a measurement decays along the trajectory, incremental
+ * updates cost amortized O(1).
+ *
+ * Space provides the ValueType, its TangentType and boxPlus/boxMinus between them (see
+ * GaussianProcessVectorSpace). On a manifold, the prior acts on the tangent space of the current
+ * estimate (first order error-state formulation).
+ */
+template <typename Space>
+class GaussianProcessTrajectory {
+ public:
+  typedef typename Space::ValueType ValueType;
+  typedef typename Space::TangentType TangentType;
+  typedef WhiteNoiseOnAccelerationPrior::Matrix Matrix;
+
+  GaussianProcessTrajectory();
+  virtual ~GaussianProcessTrajectory();
+
+  /// Parameters of the prior, they apply to measurements added afterwards.
+  void setPowerSpectralDensity(double powerSpectralDensity);
+  double getPowerSpectralDensity() const;
+  void setInitialVelocityVariance(double initialVelocityVariance);
+  void setSmoothingTolerance(double smoothingTolerance);
+
+  /*
+   * Adds a measurement of the value with the given variance (per dimension) and updates the smoothed
+   * states. The time must not be earlier than the last measurement, a measurement at the time of the
+   * last state updates this state. With smooth = false, only the filter step is done, and smooth()
+   * has to be called before evaluating (useful for adding a batch of measurements).
+   */
+  void addMeasurement(double time, const ValueType& value, double variance, bool smooth = true);
+
+  /// Backward pass of the smoother from the last state.
+  void smooth();
+
+  void clear();
+  bool isEmpty() const;
+  unsigned int size() const;
+  double getMinTime() const;
+  double getMaxTime() const;
+  const std::vector<double>& getTimes() const;
+
+  /// Smoothed state at a measurement time.
+  const ValueType& getValue(unsigned int stateIdx) const;
+  const TangentType& getVelocity(unsigned int stateIdx) const;
+  const Matrix& getCovariance(unsigned int stateIdx) const;
+
+  /// Mean of the trajectory and its first two derivatives (in the tangent space) at the time.
+  /// Returns false if the trajectory is empty or the time is outside of it.
+  bool interpolate(double time, ValueType& value, TangentType* velocity = NULL,
+                   TangentType* acceleration = NULL) const;
+
+  /// Posterior variance of the value (per dimension) at the time, from the joint covariance
+  /// of the two neighboring states and the prior in between.
+  bool getVariance(double time, double& variance) const;
+
+ protected:
+  struct State {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    double time;
+    ValueType predictedValue;
+    TangentType predictedVelocity;
+    Matrix predictedCovariance;
+    ValueType filteredValue;
+    TangentType filteredVelocity;
+    Matrix filteredCovariance;
+    ValueType value;
+    TangentType velocity;
+    Matrix covariance;
+    /// Smoother gain towards the next state, the cross covariance is gain*covariance_k+1.
+    Matrix gain;
+  };
+
+  /// Index of the state at or before the time, such that the time is in [state, state + 1].
+  int getIntervalIndex(double time) const;
+
+  std::vector<State, Eigen::aligned_allocator<State> > states_;
+  std::vector<double> times_;
+
+  /// States from this index on have not been smoothed yet.
+  size_t numSmoothedStates_;
+
+  double powerSpectralDensity_;
+  double initialVelocityVariance_;
+  double smoothingTolerance_;
+};
+
+} /* namespace */
+
+#include "curves/GaussianProcessTrajectory-inl.hpp"
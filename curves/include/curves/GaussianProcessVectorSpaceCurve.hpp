@@ -0,0 +1,184 @@
+/*
+ * GaussianProcessVectorSpaceCurve.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <Eigen/Core>
+#include <glog/logging.h>
+
+#include "curves/Curve.hpp"
+#include "curves/VectorSpaceCurve.hpp"
+#include "curves/StaticCurve.hpp"
+#include "curves/GaussianProcessTrajectory.hpp"
+
+namespace curves {
+
+/*
+ * Curve estimated from noisy measurements by Gaussian process regression with a
+ * white-noise-on-acceleration prior (see GaussianProcessTrajectory). fitCurve and extend treat the
+ * values as measurements with the measurement variance, extend and addMeasurement update the
+ * estimate incrementally. Between the measurement times, the curve is the posterior mean of the
+ * Gaussian process, its variance is available from evaluateVariance.
+ */
+template <int N>
+class GaussianProcessVectorSpaceCurve
+    : public StaticCurve<GaussianProcessVectorSpaceCurve<N>, VectorSpaceCurve<N> >
+{
+ public:
+  typedef StaticCurve<GaussianProcessVectorSpaceCurve<N>, VectorSpaceCurve<N> > Parent;
+  typedef typename Parent::ValueType ValueType;
+  typedef typename Parent::DerivativeType DerivativeType;
+  typedef GaussianProcessTrajectory<GaussianProcessVectorSpace<N> > TrajectoryType;
+
+  /// Velocity and acceleration.
+  static constexpr unsigned maxDerivativeOrder = 2;
+
+  /// The power spectral density of the acceleration noise sets the smoothness of the curve, the
+  /// measurement variance the trust in the values.
+  GaussianProcessVectorSpaceCurve(double powerSpectralDensity = 1.0, double measurementVariance = 1.0)
+      : Parent(),
+        measurementVariance_(measurementVariance)
+  {
+    CHECK_GT(measurementVariance_, 0.0);
+    trajectory_.setPowerSpectralDensity(powerSpectralDensity);
+  }
+
+  virtual ~GaussianProcessVectorSpaceCurve()
+  {
+  }
+
+  virtual void print(const std::string& str = "") const
+  {
+    std::cout << "=========================================" << std::endl;
+    std::cout << "====== Gaussian process curve ===========" << std::endl;
+    std::cout << str << std::endl;
+    std::cout << "number of states: " << trajectory_.size() << std::endl;
+    std::cout << "dimension: " << N << std::endl;
+    std::cout << "power spectral density: " << trajectory_.getPowerSpectralDensity() << std::endl;
+    std::cout << "measurement variance: " << measurementVariance_ << std::endl;
+  }
+
+  virtual Time getMinTime() const
+  {
+    return trajectory_.getMinTime();
+  }
+
+  virtual Time getMaxTime() const
+  {
+    return trajectory_.getMaxTime();
+  }
+
+  bool isEmpty() const
+  {
+    return trajectory_.isEmpty();
+  }
+
+  int size() const
+  {
+    return trajectory_.size();
+  }
+
+  /// Non-virtual evaluation, see StaticCurve.
+  bool evaluateImpl(ValueType& value, Time time) const
+  {
+    return trajectory_.interpolate(time, value);
+  }
+
+  /// Velocity and acceleration of the posterior mean.
+  template <unsigned Order>
+  bool evaluateDerivativeImpl(DerivativeType& value, Time time) const
+  {
+    static_assert(Order >= 1 && Order <= maxDerivativeOrder, "The curve does not provide derivatives of this order.");
+    ValueType position;
+    return trajectory_.interpolate(time, position, Order == 1 ? &value : NULL, Order == 2 ? &value : NULL);
+  }
+
+  template <unsigned MaxOrder>
+  bool evaluateImpl(ValueType& value, std::array<DerivativeType, MaxOrder>& derivatives, Time time) const
+  {
+    return trajectory_.interpolate(time, value, MaxOrder >= 1 ? &derivatives[0] : NULL,
+                                   MaxOrder >= 2 ? &derivatives[1] : NULL);
+  }
+
+  /// Posterior variance of every component of the curve at the time.
+  bool evaluateVariance(double& variance, Time time) const
+  {
+    return trajectory_.getVariance(time, variance);
+  }
+
+  /// Adds one measurement with its own variance, in time order, and updates the estimate.
+  void addMeasurement(Time time, const ValueType& value, double variance)
+  {
+    trajectory_.addMeasurement(time, value, variance);
+  }
+
+  /// Adds measurements with the measurement variance and updates the estimate once.
+  virtual void extend(const std::vector<Time>& times, const std::vector<ValueType>& values,
+                      std::vector<Key>* outKeys = NULL)
+  {
+    CHECK_EQ(times.size(), values.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+      trajectory_.addMeasurement(times[i], values[i], measurementVariance_, false);
+    }
+    trajectory_.smooth();
+  }
+
+  virtual void fitCurve(const std::vector<Time>& times, const std::vector<ValueType>& values,
+                        std::vector<Key>* outKeys = NULL)
+  {
+    clear();
+    extend(times, values, outKeys);
+  }
+
+  void setPowerSpectralDensity(double powerSpectralDensity)
+  {
+    trajectory_.setPowerSpectralDensity(powerSpectralDensity);
+  }
+
+  void setMeasurementVariance(double measurementVariance)
+  {
+    CHECK_GT(measurementVariance, 0.0);
+    measurementVariance_ = measurementVariance;
+  }
+
+  void setInitialVelocityVariance(double initialVelocityVariance)
+  {
+    trajectory_.setInitialVelocityVariance(initialVelocityVariance);
+  }
+
+  /// See GaussianProcessTrajectory::setSmoothingTolerance.
+  void setSmoothingTolerance(double smoothingTolerance)
+  {
+    trajectory_.setSmoothingTolerance(smoothingTolerance);
+  }
+
+  const TrajectoryType& getTrajectory() const
+  {
+    return trajectory_;
+  }
+
+  virtual void clear()
+  {
+    trajectory_.clear();
+  }
+
+  virtual void transformCurve(const ValueType T)
+  {
+    CHECK(false) << "Not implemented";
+  }
+
+ private:
+  TrajectoryType trajectory_;
+  double measurementVariance_;
+};
+
+typedef GaussianProcessVectorSpaceCurve<3> GaussianProcessVector3Curve;
+
+} /* namespace */
@@ -0,0 +1,80 @@
+/*
+ * KnotTimeIndex.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "curves/Curve.hpp"
+
+namespace curves {
+
+/// Index over strictly increasing knot times for previous / nearest knot queries in O(1) expected
+/// time, also for non-uniform timestamps. The time span is split into about one bucket per knot,
+/// each bucket stores its first knot and a query only searches the knots of its own bucket (binary
+/// search, so clustered knots cost O(log n) in the worst case instead of O(n)).
+class KnotTimeIndex {
+ public:
+  KnotTimeIndex();
+
+  /// Rebuilds the index, the times have to be strictly increasing.
+  void build(const std::vector<Time>& times);
+
+  /// Appends a knot after the last one. The buckets are rebuilt whenever the number of knots has
+  /// doubled (or a gap would add too many empty buckets), appending is O(1) amortized.
+  void push_back(Time time);
+
+  /// Removes the last knot.
+  void pop_back();
+
+  void clear();
+
+  size_t size() const {
+    return times_.size();
+  }
+
+  bool empty() const {
+    return times_.empty();
+  }
+
+  Time getTime(size_t index) const {
+    return times_[index];
+  }
+
+  const std::vector<Time>& getTimes() const {
+    return times_;
+  }
+
+  /// Index of the last knot at or before the time.
+  /// Returns false if the index is empty or the time is before the first knot.
+  bool getPreviousKnot(Time time, size_t* index) const;
+
+  /// Index of the knot closest to the time, ties go to the earlier knot.
+  /// Returns false if the index is empty.
+  bool getNearestKnot(Time time, size_t* index) const;
+
+ private:
+  /// Bucket of a time at or after the first knot, clamped to the last bucket.
+  size_t getBucket(Time time) const;
+
+  void rebuildBuckets();
+
+  std::vector<Time> times_;
+
+  /// Index of the first knot of each bucket, followed by the number of knots.
+  std::vector<size_t> bucketBegin_;
+
+  /// Time of the first knot, the start of the first bucket.
+  Time origin_;
+
+  double inverseBucketWidth_;
+
+  /// Number of knots when the buckets were last rebuilt.
+  size_t bucketsBuiltSize_;
+};
+
+} // namespace curves
@@ -16,7 +16,7 @@
 namespace curves {
 
 template <class Coefficient>
-LocalSupport2CoefficientManager<Coefficient>::LocalSupport2CoefficientManager() {
+LocalSupport2CoefficientManager<Coefficient>::LocalSupport2CoefficientManager() : revision_(0) {
 }
 
 template <class Coefficient>
@@ -88,21 +88,14 @@ void LocalSupport2CoefficientManager<Coefficient>::getTimes(std::vector<Time>* o
 template <class Coefficient>
 void LocalSupport2CoefficientManager<Coefficient>::getTimesInWindow(std::vector<Time>* outTimes,
                                                                     Time begTime, Time endTime) const {
-  CHECK_EQ(endTime, getMaxTime()) << "Not implemented for window not at the end.";
-  CHECK(begTime >= getMinTime()) << "Asked for times outside the curve.";
   CHECK_NOTNULL(outTimes);
+  CHECK_LE(begTime, endTime);
 
   outTimes->clear();
-  CoefficientIter it = --(timeToCoefficient_.end());
-
-  do {
-    if (it->first >= begTime) {
-      outTimes->push_back(it->first);
-    }
-    --it;
-  } while (it->first >= begTime && it != timeToCoefficient_.begin());
-
-  std::reverse(outTimes->begin(),outTimes->end());
+  CoefficientIter itEnd = timeToCoefficient_.upper_bound(endTime);
+  for (CoefficientIter it = timeToCoefficient_.lower_bound(begTime); it != itEnd; ++it) {
+    outTimes->push_back(it->first);
+  }
 }
 
 template <class Coefficient>
@@ -124,6 +117,7 @@ Key LocalSupport2CoefficientManager<Coefficient>::insertCoefficient(Time time, c
     std::pair<CoefficientIter, bool> success =
         timeToCoefficient_.insert(iterator);
     keyToCoefficient_[key] = success.first;
+    ++revision_;
   }
   return key;
 }
@@ -147,14 +141,15 @@ template <class Coefficient>
 void LocalSupport2CoefficientManager<Coefficient>::modifyCoefficientsValuesInBatch(const std::vector<Time>& times,
                                                                                    const std::vector<Coefficient>& values) {
   CHECK_EQ(times.size(), values.size());
+  if (times.empty()) {
+    return;
+  }
   // Get an iterator to the first coefficient
-  typename TimeToKeyCoefficientMap::iterator it = timeToCoefficient_.end();
-
-  do {
-    --it;
-  } while (it->first != times[0]);
+  typename TimeToKeyCoefficientMap::iterator it = timeToCoefficient_.find(times[0]);
+  CHECK(it != timeToCoefficient_.end()) << "No coefficient at time " << times[0];
 
   for (size_t i = 0; i < times.size(); ++i) {
+    CHECK(it != timeToCoefficient_.end());
     CHECK_EQ(it->first,times[i]);
     it->second.coefficient = values[i];
     ++it;
@@ -172,6 +167,7 @@ void LocalSupport2CoefficientManager<Coefficient>::addCoefficientAtEnd(Time time
                                                  std::pair<Time, KeyCoefficient>(time, KeyCoefficient(key, coefficient)));
 
   keyToCoefficient_.insert(keyToCoefficient_.end(), std::pair<Key, CoefficientIter>(key,it));
+  ++revision_;
   if (outKeys != NULL) {
     outKeys->push_back(key);
   }
@@ -187,6 +183,7 @@ void LocalSupport2CoefficientManager<Coefficient>::modifyCoefficient(typename Ti
   keyToCoefficient_[it->second.key] = newIt;
   // Remove the old coefficient
   timeToCoefficient_.erase(it);
+  ++revision_;
 }
 
 template <class Coefficient>
@@ -195,9 +192,10 @@ void LocalSupport2CoefficientManager<Coefficient>::removeCoefficientWithKey(Key
   typename TimeToKeyCoefficientMap::iterator it1;
   typename boost::unordered_map<Key, CoefficientIter>::iterator it2;
   it2 = keyToCoefficient_.find(key);
-  it1 = timeToCoefficient_.find(it1->second->first);
+  it1 = timeToCoefficient_.find(it2->second->first);
   timeToCoefficient_.erase(it1);
   keyToCoefficient_.erase(it2);
+  ++revision_;
 }
 
 template <class Coefficient>
@@ -209,6 +207,7 @@ void LocalSupport2CoefficientManager<Coefficient>::removeCoefficientAtTime(Time
   it2 = keyToCoefficient_.find(it1->second.key);
   timeToCoefficient_.erase(it1);
   keyToCoefficient_.erase(it2);
+  ++revision_;
 }
 
 /// \brief return true if there is a coefficient at this time
@@ -354,6 +353,7 @@ template <class Coefficient>
 void LocalSupport2CoefficientManager<Coefficient>::clear() {
   keyToCoefficient_.clear();
   timeToCoefficient_.clear();
+  ++revision_;
 }
 
 template <class Coefficient>
@@ -69,10 +69,11 @@ class LocalSupport2CoefficientManager {
   /// Get a sorted list of coefficient times
   void getTimes(std::vector<Time>* outTimes) const;
 
-  /// Get a sorted list of coefficient times in a given time window
+  /// Get a sorted list of coefficient times in a given time window [begTime, endTime]
   void getTimesInWindow(std::vector<Time>* outTimes, Time begTime, Time endTime) const;
 
-  /// Modify multiple coefficient values. Time is assumed to be ordered.
+  /// Modify multiple coefficient values. Time is assumed to be ordered, and the times have to be
+  /// consecutive coefficients.
   void modifyCoefficientsValuesInBatch(const std::vector<Time>& times,
                                        const std::vector<Coefficient>& values);
 
@@ -159,6 +160,12 @@ class LocalSupport2CoefficientManager {
   /// \brief clear the coefficients
   void clear();
 
+  /// \brief Incremented whenever coefficients are added, removed or moved in time, but not when
+  ///        their values are updated. Curves that index the coefficients rebuild the index when it changes.
+  size_t getRevision() const {
+    return revision_;
+  }
+
   /// The first valid time for the curve.
   Time getMinTime() const;
 
@@ -193,6 +200,9 @@ class LocalSupport2CoefficientManager {
   /// Time to coefficient mapping
   TimeToKeyCoefficientMap timeToCoefficient_;
 
+  /// Structural modification counter, see getRevision().
+  size_t revision_;
+
   bool hasCoefficientAtTime(Time time, CoefficientIter *it, double tol = 0);
 
 };
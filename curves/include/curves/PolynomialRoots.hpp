@@ -0,0 +1,175 @@
+/*
+ * PolynomialRoots.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace curves {
+
+/// Evaluates p(t) = c_0 + c_1*t + ... + c_n*t^n with Horner's scheme.
+inline double evaluatePolynomial(const std::vector<double>& coeffs, double t)
+{
+  double value = 0.0;
+  for (int k = static_cast<int>(coeffs.size()) - 1; k >= 0; --k) {
+    value = value*t + coeffs[k];
+  }
+  return value;
+}
+
+/// Coefficients of the derivative of p(t) = c_0 + c_1*t + ... + c_n*t^n.
+inline std::vector<double> getPolynomialDerivative(const std::vector<double>& coeffs)
+{
+  std::vector<double> derivative;
+  for (size_t k = 1; k < coeffs.size(); ++k) {
+    derivative.push_back(static_cast<double>(k)*coeffs[k]);
+  }
+  return derivative;
+}
+
+/*
+ * Lower and upper bound of p(t) = c_0 + c_1*t + ... + c_n*t^n on [t0, t1] from the coefficients of p
+ * in the Bernstein basis of the interval, whose convex hull contains the polynomial. The bounds are
+ * exact at the interval ends and cost O(n^2), which is much cheaper than locating the extrema.
+ */
+inline void getPolynomialBounds(const std::vector<double>& coeffs, double t0, double t1,
+                                double& minValue, double& maxValue)
+{
+  const int n = static_cast<int>(coeffs.size()) - 1;
+  if (n < 0) {
+    minValue = maxValue = 0.0;
+    return;
+  }
+
+  // Coefficients of q(u) = p(t0 + (t1-t0)*u) by repeated synthetic division.
+  std::vector<double> q(coeffs);
+  for (int i = 0; i < n; ++i) {
+    for (int k = n - 1; k >= i; --k) {
+      q[k] += t0 * q[k+1];
+    }
+  }
+  double scale = 1.0;
+  for (int k = 1; k <= n; ++k) {
+    scale *= (t1 - t0);
+    q[k] *= scale;
+  }
+
+  // Bernstein coefficients b_i = sum_k (i choose k)/(n choose k) * q_k.
+  minValue = maxValue = q[0];
+  for (int i = 1; i <= n; ++i) {
+    double b = 0.0;
+    double ratio = 1.0;  // (i choose k)/(n choose k)
+    for (int k = 0; k < i; ++k) {
+      b += ratio * q[k];
+      ratio *= static_cast<double>(i - k) / static_cast<double>(n - k);
+    }
+    b += ratio * q[i];
+    minValue = std::min(minValue, b);
+    maxValue = std::max(maxValue, b);
+  }
+}
+
+namespace internal {
+
+/// Root of p in [a, b] with p(a) and p(b) of opposite sign (Newton steps, bisection as fallback).
+inline double findBracketedPolynomialRoot(const std::vector<double>& coeffs,
+                                          const std::vector<double>& derivative,
+                                          double a, double b, double fa)
+{
+  const int maxIterations = 100;
+  const double tolerance = 1.0e-15 * std::max(1.0, std::max(std::abs(a), std::abs(b)));
+
+  double t = 0.5*(a + b);
+  for (int i = 0; i < maxIterations; ++i) {
+    const double f = evaluatePolynomial(coeffs, t);
+    if (f == 0.0) return t;
+
+    // Shrink the bracket.
+    if ((f < 0.0) == (fa < 0.0)) {
+      a = t;
+      fa = f;
+    } else {
+      b = t;
+    }
+    if (b - a <= tolerance) break;
+
+    // Newton step if it stays inside the bracket, bisection otherwise.
+    const double df = evaluatePolynomial(derivative, t);
+    const double tNewton = (df != 0.0) ? t - f/df : a - 1.0;
+    t = (tNewton > a && tNewton < b) ? tNewton : 0.5*(a + b);
+  }
+  return t;
+}
+
+/// True if p(t) vanishes up to the round-off of its evaluation.
+inline bool isPolynomialRoot(const std::vector<double>& coeffs, double t)
+{
+  double value = 0.0, scale = 0.0;
+  for (int k = static_cast<int>(coeffs.size()) - 1; k >= 0; --k) {
+    value = value*t + coeffs[k];
+    scale = scale*std::abs(t) + std::abs(coeffs[k]);
+  }
+  return std::abs(value) <= 1.0e-12 * scale;
+}
+
+} /* namespace internal */
+
+/*
+ * Real roots of p(t) = c_0 + c_1*t + ... + c_n*t^n in [t0, t1], sorted in ascending order.
+ * The roots of the derivative split the interval into pieces on which p is monotonic, and every
+ * piece with a sign change contains exactly one root, which is found by a bracketed Newton iteration.
+ * Roots of even multiplicity are found if p vanishes at the corresponding root of the derivative.
+ * Polynomials which vanish identically have no isolated roots.
+ */
+inline void findPolynomialRoots(const std::vector<double>& coeffs, double t0, double t1,
+                                std::vector<double>& roots)
+{
+  roots.clear();
+  if (t1 < t0) return;
+
+  // Drop vanishing leading coefficients.
+  std::vector<double> p(coeffs);
+  while (!p.empty() && p.back() == 0.0) {
+    p.pop_back();
+  }
+  if (p.size() < 2) return;
+
+  if (p.size() == 2) {
+    const double root = -p[0]/p[1];
+    if (root >= t0 && root <= t1) roots.push_back(root);
+    return;
+  }
+
+  // Split the interval at the roots of the derivative.
+  const std::vector<double> derivative = getPolynomialDerivative(p);
+  std::vector<double> breakpoints;
+  findPolynomialRoots(derivative, t0, t1, breakpoints);
+  breakpoints.insert(breakpoints.begin(), t0);
+  breakpoints.push_back(t1);
+
+  const auto addRoot = [&roots](double root) {
+    if (roots.empty() || root > roots.back()) roots.push_back(root);
+  };
+
+  double a = breakpoints.front();
+  double fa = evaluatePolynomial(p, a);
+  for (size_t i = 1; i < breakpoints.size(); ++i) {
+    const double b = breakpoints[i];
+    const double fb = evaluatePolynomial(p, b);
+    if (internal::isPolynomialRoot(p, a)) {
+      addRoot(a);
+    } else if (!internal::isPolynomialRoot(p, b) && (fa < 0.0) != (fb < 0.0)) {
+      addRoot(internal::findBracketedPolynomialRoot(p, derivative, a, b, fa));
+    }
+    a = b;
+    fa = fb;
+  }
+  if (internal::isPolynomialRoot(p, t1)) addRoot(t1);
+}
+
+} /* namespace */
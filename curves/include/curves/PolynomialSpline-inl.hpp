@@ -0,0 +1,254 @@
+/*
+ * PolynomialSpline-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialRoots.hpp"
+
+#include <algorithm>
+
+#include <Eigen/Core>
+
+namespace curves {
+
+template <int splineOrder_>
+PolynomialSpline<splineOrder_>::PolynomialSpline():
+    time_(0.0),
+    splineDuration_(0.0),
+    didEvaluateCoeffs_(false)
+{
+  splineCoeff_.fill(0.0);
+}
+
+template <int splineOrder_>
+PolynomialSpline<splineOrder_>::~PolynomialSpline() {
+}
+
+template <int splineOrder_>
+void PolynomialSpline<splineOrder_>::advanceTime(double dt) {
+  time_ += dt;
+}
+
+template <int splineOrder_>
+void PolynomialSpline<splineOrder_>::resetTime() {
+  time_ = 0.0;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getTime() const {
+  return time_;
+}
+
+template <int splineOrder_>
+const typename PolynomialSpline<splineOrder_>::SplineCoefficients&
+PolynomialSpline<splineOrder_>::getCoeffs() const {
+  return splineCoeff_;
+}
+
+template <int splineOrder_>
+bool PolynomialSpline<splineOrder_>::evalCoeffs(const SplineOpts& opts) {
+  didEvaluateCoeffs_ = false;
+
+  if (!(opts.tf > 0.0)) {
+    return false;
+  }
+
+  // Position and the first (n-1)/2 derivatives are set at both ends of the spline.
+  // Derivatives higher than the acceleration are set to zero.
+  const int m = Traits::numSplineBoundaryConstraints;
+  const double tf = opts.tf;
+  const double initialValues[] = {opts.pos0, opts.vel0, opts.acc0};
+  const double finalValues[] = {opts.posT, opts.velT, opts.accT};
+
+  // The lower coefficients follow directly from the initial conditions.
+  for (int k = 0; k < m; ++k) {
+    splineCoeff_[k] = (k < 3) ? initialValues[k] / Traits::getDerivativeFactor(k, k) : 0.0;
+  }
+
+  // Normalized residuals of the final conditions.
+  Eigen::Matrix<double, m, 1> residuals;
+  double tfPowerD = 1.0;
+  for (int d = 0; d < m; ++d) {
+    double value = (d < 3) ? finalValues[d] : 0.0;
+    double tfPower = 1.0;
+    for (int k = d; k < m; ++k) {
+      value -= Traits::getDerivativeFactor(k, d) * splineCoeff_[k] * tfPower;
+      tfPower *= tf;
+    }
+    residuals(d) = value * tfPowerD;
+    tfPowerD *= tf;
+  }
+
+  // The upper coefficients follow from the precomputed inverse of the boundary matrix.
+  const Eigen::Matrix<double, m, 1> normalizedCoeffs = Traits::getBoundaryMatrixInverse() * residuals;
+  double tfPower = tfPowerD;
+  for (int j = 0; j < m; ++j) {
+    splineCoeff_[m + j] = normalizedCoeffs(j) / tfPower;
+    tfPower *= tf;
+  }
+
+  // save spline options
+  splineDuration_ = opts.tf;
+
+  didEvaluateCoeffs_ = true;
+
+  return didEvaluateCoeffs_;
+}
+
+template <int splineOrder_>
+void PolynomialSpline<splineOrder_>::setCoeffsAndDuration(const std::vector<double>& coeffs, double duration) {
+  const int numCoeffs = std::min(static_cast<int>(coeffs.size()), numCoefficients);
+  splineCoeff_.fill(0.0);
+  std::copy(coeffs.begin(), coeffs.begin() + numCoeffs, splineCoeff_.begin());
+  splineDuration_ = duration;
+}
+
+template <int splineOrder_>
+void PolynomialSpline<splineOrder_>::setCoeffsAndDuration(const SplineCoefficients& coeffs, double duration) {
+  splineCoeff_ = coeffs;
+  splineDuration_ = duration;
+}
+
+template <int splineOrder_>
+bool PolynomialSpline<splineOrder_>::split(double tk, PolynomialSpline& tail) {
+  if (tk <= 0.0 || tk >= splineDuration_) {
+    return false;
+  }
+
+  // Coefficients of s(tk + t) by repeated synthetic division.
+  SplineCoefficients tailCoeffs = splineCoeff_;
+  for (int i = 0; i < splineOrder_; ++i) {
+    for (int k = splineOrder_ - 1; k >= i; --k) {
+      tailCoeffs[k] += tk*tailCoeffs[k+1];
+    }
+  }
+
+  tail.setCoeffsAndDuration(tailCoeffs, splineDuration_ - tk);
+  tail.didEvaluateCoeffs_ = true;
+  tail.time_ = 0.0;
+  splineDuration_ = tk;
+  return true;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getPositionAtTime(double tk) const {
+
+  tk = std::max(0.0, std::min(tk, splineDuration_));
+
+  // Horner's scheme.
+  double position = splineCoeff_[splineOrder_];
+  for (int k = splineOrder_ - 1; k >= 0; --k) {
+    position = position*tk + splineCoeff_[k];
+  }
+  return position;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getVelocityAtTime(double tk) const {
+
+  tk = std::max(0.0, std::min(tk, splineDuration_));
+
+  double velocity = splineOrder_*splineCoeff_[splineOrder_];
+  for (int k = splineOrder_ - 1; k >= 1; --k) {
+    velocity = velocity*tk + k*splineCoeff_[k];
+  }
+  return velocity;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getAccelerationAtTime(double tk) const {
+
+  tk = std::max(0.0, std::min(tk, splineDuration_));
+
+  double acceleration = splineOrder_*(splineOrder_ - 1)*splineCoeff_[splineOrder_];
+  for (int k = splineOrder_ - 1; k >= 2; --k) {
+    acceleration = acceleration*tk + k*(k - 1)*splineCoeff_[k];
+  }
+  return acceleration;
+}
+
+template <int splineOrder_>
+void PolynomialSpline<splineOrder_>::getStateAtTime(double tk, PolynomialSplineState& state,
+                                                    bool computeJerk) const noexcept {
+
+  tk = std::max(0.0, std::min(tk, splineDuration_));
+
+  // Horner's scheme for the polynomial and its derivatives, which accumulates
+  // the Taylor coefficients p^(d)(tk)/d!.
+  double position = splineCoeff_[splineOrder_];
+  double velocity = 0.0;
+  double halfAcceleration = 0.0;
+  double sixthJerk = 0.0;
+  for (int k = splineOrder_ - 1; k >= 0; --k) {
+    if (computeJerk) sixthJerk = sixthJerk*tk + halfAcceleration;
+    halfAcceleration = halfAcceleration*tk + velocity;
+    velocity = velocity*tk + position;
+    position = position*tk + splineCoeff_[k];
+  }
+  state.position = position;
+  state.velocity = velocity;
+  state.acceleration = 2.0*halfAcceleration;
+  state.jerk = 6.0*sixthJerk;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getDerivativeAtTime(double tk, int derivativeOrder) const {
+  if (derivativeOrder > splineOrder_) {
+    return 0.0;
+  }
+
+  tk = std::max(0.0, std::min(tk, splineDuration_));
+
+  // Horner's scheme on the coefficients k!/(k-d)! * a_k of the derivative.
+  double derivative = 0.0;
+  for (int k = splineOrder_; k >= derivativeOrder; --k) {
+    derivative = derivative*tk + Traits::getDerivativeFactor(k, derivativeOrder)*splineCoeff_[k];
+  }
+  return derivative;
+}
+
+template <int splineOrder_>
+PolynomialSplineExtremum PolynomialSpline<splineOrder_>::getMaxAbsDerivative(int derivativeOrder) const {
+  PolynomialSplineExtremum extremum;
+  if (derivativeOrder > splineOrder_) {
+    return extremum;
+  }
+
+  std::vector<double> derivativeCoeffs;
+  for (int k = derivativeOrder; k <= splineOrder_; ++k) {
+    derivativeCoeffs.push_back(Traits::getDerivativeFactor(k, derivativeOrder)*splineCoeff_[k]);
+  }
+
+  std::vector<double> candidates;
+  findPolynomialRoots(getPolynomialDerivative(derivativeCoeffs), 0.0, splineDuration_, candidates);
+  candidates.push_back(0.0);
+  candidates.push_back(splineDuration_);
+
+  for (const double tk : candidates) {
+    const double absValue = std::abs(evaluatePolynomial(derivativeCoeffs, tk));
+    if (absValue > extremum.maxAbsValue) {
+      extremum.maxAbsValue = absValue;
+      extremum.time = tk;
+    }
+  }
+  return extremum;
+}
+
+template <int splineOrder_>
+PolynomialSplineExtrema PolynomialSpline<splineOrder_>::getExtrema() const {
+  PolynomialSplineExtrema extrema;
+  extrema.position = getMaxAbsDerivative(0);
+  extrema.velocity = getMaxAbsDerivative(1);
+  extrema.acceleration = getMaxAbsDerivative(2);
+  extrema.jerk = getMaxAbsDerivative(3);
+  return extrema;
+}
+
+template <int splineOrder_>
+double PolynomialSpline<splineOrder_>::getSplineDuration() const {
+  return splineDuration_;
+}
+
+} /* namespace */
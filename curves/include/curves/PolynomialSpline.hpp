@@ -0,0 +1,121 @@
+/*
+ * PolynomialSpline.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "curves/PolynomialSplineBase.hpp"
+#include "curves/PolynomialSplineTraits.hpp"
+
+namespace curves {
+
+/// Maximum absolute value of a derivative of a spline and the time at which it is reached.
+struct PolynomialSplineExtremum {
+  double maxAbsValue = 0.0;
+  double time = 0.0;
+
+  void merge(const PolynomialSplineExtremum& other) {
+    if (other.maxAbsValue > maxAbsValue) *this = other;
+  }
+};
+
+/// Extrema of the position, velocity, acceleration and jerk of a spline.
+struct PolynomialSplineExtrema {
+  PolynomialSplineExtremum position;
+  PolynomialSplineExtremum velocity;
+  PolynomialSplineExtremum acceleration;
+  PolynomialSplineExtremum jerk;
+
+  void merge(const PolynomialSplineExtrema& other) {
+    position.merge(other.position);
+    velocity.merge(other.velocity);
+    acceleration.merge(other.acceleration);
+    jerk.merge(other.jerk);
+  }
+};
+
+/// Position, velocity, acceleration and (if requested) jerk of a spline at one time.
+struct PolynomialSplineState {
+  double position = 0.0;
+  double velocity = 0.0;
+  double acceleration = 0.0;
+  double jerk = 0.0;
+};
+
+template <int splineOrder_>
+class PolynomialSpline : public PolynomialSplineBase {
+ public:
+  typedef PolynomialSplineTraits<splineOrder_> Traits;
+
+  static constexpr int splineOrder = splineOrder_;
+  static constexpr int numCoefficients = Traits::numCoefficients;
+
+  typedef std::array<double, numCoefficients> SplineCoefficients;
+
+  PolynomialSpline();
+  virtual ~PolynomialSpline();
+
+  const SplineCoefficients& getCoeffs() const;
+  bool evalCoeffs(const SplineOpts& opts);
+  void setCoeffsAndDuration(const std::vector<double>& coeffs, double duration);
+  void setCoeffsAndDuration(const SplineCoefficients& coeffs, double duration);
+
+  /*
+   * Splits the spline at tk without changing its shape: the spline keeps [0, tk] and tail gets
+   * [tk, duration], with the polynomial re-expanded around tk. Returns false if tk is not
+   * strictly inside the spline.
+   */
+  bool split(double tk, PolynomialSpline& tail);
+
+  double getPositionAtTime(double tk) const;
+  double getVelocityAtTime(double tk) const;
+  double getAccelerationAtTime(double tk) const;
+
+  /// Position, velocity, acceleration and optionally jerk in one Horner pass.
+  void getStateAtTime(double tk, PolynomialSplineState& state, bool computeJerk = false) const noexcept;
+
+  /// Derivative of arbitrary order, zero for orders higher than the spline order.
+  double getDerivativeAtTime(double tk, int derivativeOrder) const;
+
+  /// Maximum absolute value of a derivative over the spline, found analytically
+  /// among the end points and the roots of the next higher derivative.
+  PolynomialSplineExtremum getMaxAbsDerivative(int derivativeOrder) const;
+  PolynomialSplineExtrema getExtrema() const;
+
+  void advanceTime(double dt);
+  void resetTime();
+  double getTime() const;
+
+  double getSplineDuration() const;
+
+ protected:
+  double time_;
+  double splineDuration_;
+  bool didEvaluateCoeffs_;
+
+  /*
+   * s(t) = an*t^n + ... + a2*t^2 + a1*t + a0
+   * splineCoeff_ = [a0 a1 a2 ... an]
+   */
+  SplineCoefficients splineCoeff_;
+};
+
+template <int splineOrder_>
+constexpr int PolynomialSpline<splineOrder_>::splineOrder;
+
+template <int splineOrder_>
+constexpr int PolynomialSpline<splineOrder_>::numCoefficients;
+
+typedef PolynomialSpline<1> PolynomialSplineLinear;
+typedef PolynomialSpline<3> PolynomialSplineCubic;
+typedef PolynomialSpline<5> PolynomialSplineQuintic;
+typedef PolynomialSpline<7> PolynomialSplineSeptic;
+
+} /* namespace */
+
+#include "curves/PolynomialSpline-inl.hpp"
@@ -27,7 +27,6 @@ class PolynomialSplineBase {
   PolynomialSplineBase();
   virtual ~PolynomialSplineBase();
 
-  virtual const std::vector<double>& getCoeffs() const = 0;
   virtual bool evalCoeffs(const SplineOpts& opts) = 0;
   virtual void setCoeffsAndDuration(const std::vector<double>& coeffs, double duration) = 0;
 
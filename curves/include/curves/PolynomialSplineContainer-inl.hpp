@@ -0,0 +1,636 @@
+/*
+ * PolynomialSplineContainer-inl.hpp
+ *
+ *  Created on: Dec 8, 2014
+ *      Author: C. Dario Bellicoso, Peter Fankhauser
+ */
+
+#include "curves/PolynomialSplineContainer.hpp"
+
+#include <algorithm>
+
+#include "curves/PolynomialRoots.hpp"
+
+#include <glog/logging.h>
+
+namespace curves {
+
+template <int splineOrder_, int continuityOrder_>
+PolynomialSplineContainer<splineOrder_, continuityOrder_>::PolynomialSplineContainer():
+    timeOffset_(0.0),
+    containerTime_(0.0),
+    containerDuration_(0.0),
+    activeSplineIdx_(0),
+    finalVelocity_(0.0),
+    finalAcceleration_(0.0)
+{
+  // Make sure that the container is correctly emptied
+  reset();
+}
+
+template <int splineOrder_, int continuityOrder_>
+PolynomialSplineContainer<splineOrder_, continuityOrder_>::~PolynomialSplineContainer()
+{
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::advance(double dt)
+{
+  if (splines_.empty() || containerTime_ >= containerDuration_ || activeSplineIdx_ == static_cast<int>(splines_.size())) {
+    return false;
+  }
+
+  containerTime_ += dt;
+
+  if ((containerTime_ - timeOffset_ >= splines_[activeSplineIdx_].getSplineDuration())) {
+    if (activeSplineIdx_ < static_cast<int>(splines_.size()) - 1) {
+      timeOffset_ += splines_[activeSplineIdx_].getSplineDuration();
+    }
+    activeSplineIdx_++;
+  }
+
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::setContainerTime(double t)
+{
+  containerTime_ = t;
+  double timeOffset;
+  activeSplineIdx_ = getActiveSplineIndexAtTime(t, timeOffset);
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::setData(const std::vector<double>& knotPositions,
+                                                                        const std::vector<double>& knotValues,
+                                                                        double initialVelocity, double initialAcceleration,
+                                                                        double finalVelocity, double finalAcceleration)
+{
+  reset();
+
+  const double initialDerivatives[] = {initialVelocity, initialAcceleration};
+  const double finalDerivatives[] = {finalVelocity, finalAcceleration};
+
+  appendSplines(knotPositions, knotValues,
+                std::vector<double>(initialDerivatives, initialDerivatives + Traits::numBoundaryDerivatives),
+                std::vector<double>(finalDerivatives, finalDerivatives + Traits::numBoundaryDerivatives));
+
+  finalVelocity_ = finalVelocity;
+  finalAcceleration_ = finalAcceleration;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::setSplines(const std::vector<PolynomialSplineBase::SplineOpts>& splineOpts)
+{
+  reset();
+
+  splines_.resize(splineOpts.size());
+  for (size_t i = 0; i < splineOpts.size(); i++) {
+    if (!splines_[i].evalCoeffs(splineOpts[i])) {
+      reset();
+      return false;
+    }
+    containerDuration_ += splines_[i].getSplineDuration();
+  }
+
+  if (!splineOpts.empty()) {
+    finalVelocity_ = splineOpts.back().velT;
+    finalAcceleration_ = splineOpts.back().accT;
+  }
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::setDataWithDerivatives(const std::vector<double>& knotPositions,
+                                                                                       const std::vector<double>& knotValues,
+                                                                                       const std::vector<double>& knotVelocities,
+                                                                                       const std::vector<double>& knotAccelerations,
+                                                                                       bool parallel)
+{
+  CHECK_GE(knotPositions.size(), 2);
+  CHECK_EQ(knotPositions.size(), knotValues.size());
+  CHECK_EQ(knotPositions.size(), knotVelocities.size());
+  CHECK_EQ(knotPositions.size(), knotAccelerations.size());
+
+  reset();
+
+  const int num_splines = knotPositions.size()-1;
+  splines_.resize(num_splines);
+
+#pragma omp parallel for if(parallel)
+  for (int i = 0; i < num_splines; i++) {
+    PolynomialSplineBase::SplineOpts opts;
+    opts.tf = knotPositions[i+1] - knotPositions[i];
+    opts.pos0 = knotValues[i];
+    opts.posT = knotValues[i+1];
+    opts.vel0 = knotVelocities[i];
+    opts.velT = knotVelocities[i+1];
+    opts.acc0 = knotAccelerations[i];
+    opts.accT = knotAccelerations[i+1];
+    CHECK(splines_[i].evalCoeffs(opts)) << "Knot times have to be strictly increasing.";
+  }
+
+  for (int i = 0; i < num_splines; i++) {
+    containerDuration_ += splines_[i].getSplineDuration();
+  }
+  finalVelocity_ = knotVelocities.back();
+  finalAcceleration_ = knotAccelerations.back();
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::extendData(const std::vector<double>& knotPositions,
+                                                                           const std::vector<double>& knotValues,
+                                                                           unsigned int numTailSplines)
+{
+  CHECK(!splines_.empty()) << "The container has to be set before it can be extended.";
+  CHECK_EQ(knotPositions.size(), knotValues.size());
+  CHECK_GT(knotPositions.front(), containerDuration_) << "Knots have to be appended after the end of the container.";
+
+  // Remove the tail window, it is re-solved together with the new knots.
+  const unsigned int numWindowSplines = std::min<unsigned int>(numTailSplines, splines_.size());
+  const unsigned int firstWindowSplineIdx = splines_.size() - numWindowSplines;
+
+  double windowStartTime = containerDuration_;
+  for (unsigned int i = firstWindowSplineIdx; i < splines_.size(); i++) {
+    windowStartTime -= splines_[i].getSplineDuration();
+  }
+
+  // The window starts at the end of the last kept spline, or at the start of the container.
+  const SplineType& boundarySpline = (firstWindowSplineIdx > 0) ? splines_[firstWindowSplineIdx-1] : splines_.front();
+  const double boundaryTime = (firstWindowSplineIdx > 0) ? boundarySpline.getSplineDuration() : 0.0;
+
+  std::vector<double> windowKnotPositions(1, windowStartTime);
+  std::vector<double> windowKnotValues(1, boundarySpline.getPositionAtTime(boundaryTime));
+  for (unsigned int i = firstWindowSplineIdx; i < splines_.size(); i++) {
+    windowKnotPositions.push_back(windowKnotPositions.back() + splines_[i].getSplineDuration());
+    windowKnotValues.push_back(splines_[i].getPositionAtTime(splines_[i].getSplineDuration()));
+  }
+  windowKnotPositions.insert(windowKnotPositions.end(), knotPositions.begin(), knotPositions.end());
+  windowKnotValues.insert(windowKnotValues.end(), knotValues.begin(), knotValues.end());
+
+  // Keep the continuity of the container at the start of the window.
+  std::vector<double> initialDerivatives;
+  for (int d = 1; d <= continuityOrder_; d++) {
+    initialDerivatives.push_back(boundarySpline.getDerivativeAtTime(boundaryTime, d));
+  }
+
+  // Constrain the final derivatives as long as the system is not over-determined.
+  const int numFinalDerivatives = std::max(0, std::min(static_cast<int>(Traits::numBoundaryDerivatives),
+                                                       splineOrder_ - 1 - continuityOrder_));
+  const double finalDerivatives[] = {finalVelocity_, finalAcceleration_};
+
+  for (unsigned int i = 0; i < numWindowSplines; i++) {
+    containerDuration_ -= splines_.back().getSplineDuration();
+    splines_.pop_back();
+  }
+
+  appendSplines(windowKnotPositions, windowKnotValues, initialDerivatives,
+                std::vector<double>(finalDerivatives, finalDerivatives + numFinalDerivatives));
+}
+
+/*
+ * aij:
+ *  i --> spline id (1,...,n)
+ *  j --> spline coefficient aj (an,...,a1,a0)
+ *
+ * Coefficient vector is:
+ *    q = [a1n ... a10 a2n ... a20 ... ann ... an0]
+ */
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::appendSplines(const std::vector<double>& knotPositions,
+                                                                              const std::vector<double>& knotValues,
+                                                                              const std::vector<double>& initialDerivatives,
+                                                                              const std::vector<double>& finalDerivatives)
+{
+  const unsigned int num_coeffs_spline = Traits::numCoefficients;
+  const unsigned int num_splines = knotPositions.size()-1;
+  const unsigned int num_coeffs = num_splines*num_coeffs_spline;
+  const unsigned int num_knots = knotPositions.size();
+
+  // Position and the constrained derivatives at the first and the last knot.
+  const unsigned int num_initial_constraints = 1 + initialDerivatives.size();
+  const unsigned int num_final_constraints = 1 + finalDerivatives.size();
+
+  // Position of the previous and the next spline, and the continuous derivatives.
+  const unsigned int num_junction_constraints = 2 + continuityOrder_;
+
+  const unsigned int num_constraints = (num_knots-2)*num_junction_constraints
+      + num_initial_constraints + num_final_constraints;
+
+  std::vector<double> tfs;
+  for (unsigned int i=0; i<num_splines; i++) {
+    tfs.push_back(knotPositions[i+1]-knotPositions[i]);
+  }
+
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(num_constraints, num_coeffs);
+  Eigen::VectorXd coeffs = Eigen::VectorXd::Zero(num_coeffs);
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(num_constraints);
+
+  // time containers
+  typename Traits::TimeVector timeVec, timeVecTf;
+
+  int constraintIdx = 0;
+
+  // Initial conditions
+  for (unsigned int d = 0; d < num_initial_constraints; d++) {
+    Traits::getTimeVector(timeVec, 0.0, d);
+    A.block(constraintIdx, 0, 1, num_coeffs_spline) = timeVec;
+    b(constraintIdx) = (d == 0) ? knotValues.front() : initialDerivatives[d-1];
+    constraintIdx++;
+  }
+
+  // Final conditions
+  for (unsigned int d = 0; d < num_final_constraints; d++) {
+    Traits::getTimeVector(timeVecTf, tfs.back(), d);
+    A.block(constraintIdx, (num_splines-1)*num_coeffs_spline, 1, num_coeffs_spline) = timeVecTf;
+    b(constraintIdx) = (d == 0) ? knotValues.back() : finalDerivatives[d-1];
+    constraintIdx++;
+  }
+
+  /**********************************
+   * Set spline junction conditions *
+   **********************************/
+  for (unsigned int k=1; k<=num_knots-2; k++) {
+
+    const int prevSplineColumn = (k-1)*num_coeffs_spline;
+    const int nextSplineColumn = k*num_coeffs_spline;
+    const double tf = tfs[k-1];
+
+    Traits::getTimeVector(timeVec, 0.0, 0);
+    Traits::getTimeVector(timeVecTf, tf, 0);
+
+    A.block(constraintIdx, prevSplineColumn, 1, num_coeffs_spline) = timeVecTf;
+    b(constraintIdx) = knotValues[k];
+    constraintIdx++;
+
+    A.block(constraintIdx, nextSplineColumn, 1, num_coeffs_spline) = timeVec;
+    b(constraintIdx) = knotValues[k];
+    constraintIdx++;
+
+    for (int d = 1; d <= continuityOrder_; d++) {
+      Traits::getTimeVector(timeVec, 0.0, d);
+      Traits::getTimeVector(timeVecTf, tf, d);
+      A.block(constraintIdx, prevSplineColumn, 1, num_coeffs_spline) = timeVecTf;
+      A.block(constraintIdx, nextSplineColumn, 1, num_coeffs_spline) = -timeVec;
+      b(constraintIdx) = 0.0;
+      constraintIdx++;
+    }
+  }
+  /**********************************/
+
+  coeffs = A.colPivHouseholderQr().solve(b);
+
+  SplineType spline;
+  typename SplineType::SplineCoefficients coefficients;
+
+  for (unsigned int i = 0; i < num_splines; i++) {
+    for (unsigned int k = 0; k < num_coeffs_spline; k++) {
+      coefficients[k] = coeffs(i*num_coeffs_spline + num_coeffs_spline-1-k);
+    }
+    spline.setCoeffsAndDuration(coefficients, tfs[i]);
+    this->addSpline(spline);
+  }
+}
+
+template <int splineOrder_, int continuityOrder_>
+int PolynomialSplineContainer<splineOrder_, continuityOrder_>::getActiveSplineIndex() const
+{
+  return activeSplineIdx_;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::addSpline(const SplineType& spline)
+{
+  splines_.push_back(spline);
+  containerDuration_ += spline.getSplineDuration();
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::reset()
+{
+  splines_.clear();
+  activeSplineIdx_ = 0;
+  containerDuration_ = 0.0;
+  finalVelocity_ = 0.0;
+  finalAcceleration_ = 0.0;
+  resetTime();
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::resetTime()
+{
+  timeOffset_ = 0.0;
+  containerTime_ = 0.0;
+  activeSplineIdx_ = 0;
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getContainerDuration() const
+{
+  return containerDuration_;
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::getSplineExtrema(std::vector<PolynomialSplineExtrema>& splineExtrema,
+                                                                                 bool parallel) const
+{
+  const int num_splines = splines_.size();
+  splineExtrema.resize(num_splines);
+
+  std::vector<double> timeOffsets(num_splines, 0.0);
+  for (int i = 1; i < num_splines; i++) {
+    timeOffsets[i] = timeOffsets[i-1] + splines_[i-1].getSplineDuration();
+  }
+
+#pragma omp parallel for if(parallel)
+  for (int i = 0; i < num_splines; i++) {
+    PolynomialSplineExtrema& extrema = splineExtrema[i];
+    extrema = splines_[i].getExtrema();
+    extrema.position.time += timeOffsets[i];
+    extrema.velocity.time += timeOffsets[i];
+    extrema.acceleration.time += timeOffsets[i];
+    extrema.jerk.time += timeOffsets[i];
+  }
+}
+
+template <int splineOrder_, int continuityOrder_>
+PolynomialSplineExtrema PolynomialSplineContainer<splineOrder_, continuityOrder_>::getExtrema(bool parallel) const
+{
+  std::vector<PolynomialSplineExtrema> splineExtrema;
+  getSplineExtrema(splineExtrema, parallel);
+
+  PolynomialSplineExtrema extrema;
+  for (const auto& splineExtremum : splineExtrema) {
+    extrema.merge(splineExtremum);
+  }
+  return extrema;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::insertKnot(double t)
+{
+  // Knots closer than this to an existing knot are rejected.
+  const double knotTolerance = 1.0e-9;
+
+  double timeOffset = 0.0;
+  const int splineIdx = getActiveSplineIndexAtTime(t, timeOffset);
+  if (splineIdx < 0) return false;
+  const double tk = t - timeOffset;
+  if (tk < knotTolerance || tk > splines_[splineIdx].getSplineDuration() - knotTolerance) return false;
+
+  SplineType tail;
+  if (!splines_[splineIdx].split(tk, tail)) return false;
+  splines_.insert(splines_.begin() + splineIdx + 1, tail);
+
+  // Keep the playback on the same time.
+  if (splineIdx < activeSplineIdx_) {
+    activeSplineIdx_++;
+  } else if (splineIdx == activeSplineIdx_ && containerTime_ - timeOffset_ >= tk) {
+    activeSplineIdx_++;
+    timeOffset_ += tk;
+  }
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::getLevelCrossingTimes(double level, double t0, double t1,
+                                                                                      std::vector<double>& crossingTimes) const
+{
+  crossingTimes.clear();
+  appendLevelCrossingTimes(level, t0, t1, false, crossingTimes);
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::getFirstLevelCrossingTime(double level, double t0, double t1,
+                                                                                          double& crossingTime) const
+{
+  std::vector<double> crossingTimes;
+  appendLevelCrossingTimes(level, t0, t1, true, crossingTimes);
+  if (crossingTimes.empty()) return false;
+  crossingTime = crossingTimes.front();
+  return true;
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::appendLevelCrossingTimes(double level, double t0, double t1,
+                                                                                         bool stopAtFirst,
+                                                                                         std::vector<double>& crossingTimes) const
+{
+  // Crossings at a knot are found on both adjacent splines.
+  const double knotTolerance = 1.0e-9;
+
+  std::vector<double> coeffs(Traits::numCoefficients), roots;
+  double splineStartTime = 0.0;
+  for (const auto& spline : splines_) {
+    if (splineStartTime > t1) break;
+    const double duration = spline.getSplineDuration();
+    const double tBegin = std::max(t0 - splineStartTime, 0.0);
+    const double tEnd = std::min(t1 - splineStartTime, duration);
+
+    if (tBegin <= tEnd) {
+      std::copy(spline.getCoeffs().begin(), spline.getCoeffs().end(), coeffs.begin());
+      coeffs[0] -= level;
+      double minValue, maxValue;
+      getPolynomialBounds(coeffs, tBegin, tEnd, minValue, maxValue);
+
+      if (minValue <= 0.0 && maxValue >= 0.0) {
+        findPolynomialRoots(coeffs, tBegin, tEnd, roots);
+        for (const auto root : roots) {
+          const double time = splineStartTime + root;
+          if (crossingTimes.empty() || time > crossingTimes.back() + knotTolerance) {
+            crossingTimes.push_back(time);
+          }
+        }
+        if (stopAtFirst && !crossingTimes.empty()) return;
+      }
+    }
+    splineStartTime += duration;
+  }
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::scaleSplineDurations(const std::vector<double>& splineScales)
+{
+  CHECK_EQ(splineScales.size(), splines_.size());
+  const int num_splines = splines_.size();
+  if (num_splines == 0) return;
+
+  // Knot values of the current splines.
+  std::vector<double> knotValues(num_splines+1), knotVelocities(num_splines+1), knotAccelerations(num_splines+1);
+  for (int i = 0; i < num_splines; i++) {
+    knotValues[i] = splines_[i].getPositionAtTime(0.0);
+    knotVelocities[i] = splines_[i].getVelocityAtTime(0.0);
+    knotAccelerations[i] = splines_[i].getAccelerationAtTime(0.0);
+  }
+  const double lastDuration = splines_.back().getSplineDuration();
+  knotValues.back() = splines_.back().getPositionAtTime(lastDuration);
+  knotVelocities.back() = splines_.back().getVelocityAtTime(lastDuration);
+  knotAccelerations.back() = splines_.back().getAccelerationAtTime(lastDuration);
+
+  // The derivatives at a knot are shared by both adjacent splines.
+  for (int k = 0; k <= num_splines; k++) {
+    double knotScale = (k < num_splines) ? splineScales[k] : splineScales[k-1];
+    if (k > 0 && k < num_splines) knotScale = std::max(splineScales[k-1], splineScales[k]);
+    CHECK_GT(knotScale, 0.0);
+    knotVelocities[k] /= knotScale;
+    knotAccelerations[k] /= knotScale*knotScale;
+  }
+
+  containerDuration_ = 0.0;
+  for (int i = 0; i < num_splines; i++) {
+    PolynomialSplineBase::SplineOpts opts;
+    opts.tf = splines_[i].getSplineDuration() * splineScales[i];
+    opts.pos0 = knotValues[i];
+    opts.posT = knotValues[i+1];
+    opts.vel0 = knotVelocities[i];
+    opts.velT = knotVelocities[i+1];
+    opts.acc0 = knotAccelerations[i];
+    opts.accT = knotAccelerations[i+1];
+    CHECK(splines_[i].evalCoeffs(opts));
+    containerDuration_ += splines_[i].getSplineDuration();
+  }
+
+  finalVelocity_ = knotVelocities.back();
+  finalAcceleration_ = knotAccelerations.back();
+  resetTime();
+}
+
+template <int splineOrder_, int continuityOrder_>
+PolynomialSplineBase* PolynomialSplineContainer<splineOrder_, continuityOrder_>::getSpline(int splineIndex)
+{
+  return &splines_.at(splineIndex);
+}
+
+template <int splineOrder_, int continuityOrder_>
+const std::vector<typename PolynomialSplineContainer<splineOrder_, continuityOrder_>::SplineType>&
+PolynomialSplineContainer<splineOrder_, continuityOrder_>::getSplines() const
+{
+  return splines_;
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getContainerTime() const
+{
+  return containerTime_;
+}
+
+template <int splineOrder_, int continuityOrder_>
+bool PolynomialSplineContainer<splineOrder_, continuityOrder_>::isEmpty() const
+{
+  return splines_.empty();
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getPosition() const
+{
+  if (splines_.empty()) return 0.0;
+  if (activeSplineIdx_ == static_cast<int>(splines_.size()))
+    return splines_.at(activeSplineIdx_ - 1).getPositionAtTime(containerTime_ - timeOffset_);
+  return splines_.at(activeSplineIdx_).getPositionAtTime(containerTime_ - timeOffset_);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getVelocity() const
+{
+  if (splines_.empty()) return 0.0;
+  if (activeSplineIdx_ == static_cast<int>(splines_.size()))
+    return splines_.at(activeSplineIdx_ - 1).getVelocityAtTime(containerTime_ - timeOffset_);
+  return splines_.at(activeSplineIdx_).getVelocityAtTime(containerTime_ - timeOffset_);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getAcceleration() const
+{
+  if (splines_.empty()) return 0.0;
+  if (activeSplineIdx_ == static_cast<int>(splines_.size()))
+    return splines_.at(activeSplineIdx_ - 1).getAccelerationAtTime(containerTime_ - timeOffset_);
+  return splines_.at(activeSplineIdx_).getAccelerationAtTime(containerTime_ - timeOffset_);
+}
+
+template <int splineOrder_, int continuityOrder_>
+int PolynomialSplineContainer<splineOrder_, continuityOrder_>::getActiveSplineIndexAtTime(double t, double& timeOffset) const
+{
+  if (splines_.empty()) return -1;
+  timeOffset = 0.0;
+
+  for (size_t i = 0; i < splines_.size(); i++) {
+    if ((t - timeOffset < splines_[i].getSplineDuration()))
+      return i;
+    if (i < (splines_.size() - 1))
+      timeOffset += splines_[i].getSplineDuration();
+  }
+
+  return (splines_.size() - 1);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getPositionAtTime(double t) const
+{
+  double timeOffset = 0.0;
+  int activeSplineIdx = getActiveSplineIndexAtTime(t, timeOffset);
+  if (activeSplineIdx < 0) {
+    return splines_.at(0).getPositionAtTime(0.0);
+  }
+  return splines_.at(activeSplineIdx).getPositionAtTime(t - timeOffset);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getVelocityAtTime(double t) const
+{
+  double timeOffset = 0.0;
+  int activeSplineIdx = getActiveSplineIndexAtTime(t, timeOffset);
+  if (activeSplineIdx < 0) {
+    return splines_.at(0).getVelocityAtTime(0.0);
+  }
+  return splines_.at(activeSplineIdx).getVelocityAtTime(t - timeOffset);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getAccelerationAtTime(double t) const
+{
+  double timeOffset = 0.0;
+  int activeSplineIdx = getActiveSplineIndexAtTime(t, timeOffset);
+  if (activeSplineIdx < 0) {
+    return splines_.at(0).getAccelerationAtTime(0.0);
+  }
+  return splines_.at(activeSplineIdx).getAccelerationAtTime(t - timeOffset);
+}
+
+template <int splineOrder_, int continuityOrder_>
+void PolynomialSplineContainer<splineOrder_, continuityOrder_>::getStateAtTime(double t, PolynomialSplineState& state,
+                                                                               bool computeJerk) const
+{
+  double timeOffset = 0.0;
+  const int activeSplineIdx = getActiveSplineIndexAtTime(t, timeOffset);
+  if (activeSplineIdx < 0) {
+    state = PolynomialSplineState();
+    return;
+  }
+  splines_[activeSplineIdx].getStateAtTime(t - timeOffset, state, computeJerk);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getEndPosition() const
+{
+  double lastSplineDuration = splines_.at(splines_.size() - 1).getSplineDuration();
+  return splines_.at(splines_.size() - 1).getPositionAtTime(lastSplineDuration);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getEndVelocity() const
+{
+  double lastSplineDuration = splines_.at(splines_.size() - 1).getSplineDuration();
+  return splines_.at(splines_.size() - 1).getVelocityAtTime(lastSplineDuration);
+}
+
+template <int splineOrder_, int continuityOrder_>
+double PolynomialSplineContainer<splineOrder_, continuityOrder_>::getEndAcceleration() const
+{
+  double lastSplineDuration = splines_.at(splines_.size() - 1).getSplineDuration();
+  return splines_.at(splines_.size() - 1).getAccelerationAtTime(lastSplineDuration);
+}
+
+} /* namespace */
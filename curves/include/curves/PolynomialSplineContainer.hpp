@@ -7,20 +7,35 @@
 
 #pragma once
 
-#include "curves/PolynomialSplineQuintic.hpp"
+#include "curves/PolynomialSpline.hpp"
 #include <Eigen/Core>
 #include <Eigen/Dense>
 #include <limits>
+#include <vector>
 
 namespace curves {
 
+/*
+ * Container of polynomial splines of order splineOrder_ (linear, cubic, quintic, septic, ...).
+ * The splines are joined with continuity up to the derivative of order continuityOrder_.
+ */
+template <int splineOrder_, int continuityOrder_ = PolynomialSplineTraits<splineOrder_>::defaultContinuityOrder>
 class PolynomialSplineContainer {
  public:
+  typedef PolynomialSpline<splineOrder_> SplineType;
+  typedef PolynomialSplineTraits<splineOrder_> Traits;
+
+  static constexpr int splineOrder = splineOrder_;
+  static constexpr int continuityOrder = continuityOrder_;
+
+  static_assert(continuityOrder_ >= 0 && continuityOrder_ < splineOrder_,
+                "The continuity order of the container must be smaller than the spline order.");
+
   PolynomialSplineContainer();
   virtual ~PolynomialSplineContainer();
 
   bool advance(double dt);
-  bool addSpline(const PolynomialSplineQuintic& spline);
+  bool addSpline(const SplineType& spline);
   bool reset();
   bool resetTime();
 
@@ -34,6 +49,9 @@ class PolynomialSplineContainer {
   double getVelocityAtTime(double t) const;
   double getAccelerationAtTime(double t) const;
 
+  /// Position, velocity, acceleration and optionally jerk with a single spline lookup.
+  void getStateAtTime(double t, PolynomialSplineState& state, bool computeJerk = false) const;
+
   double getEndPosition() const;
   double getEndVelocity() const;
   double getEndAcceleration() const;
@@ -44,6 +62,11 @@ class PolynomialSplineContainer {
   int getActiveSplineIndexAtTime(double t, double& timeOffset) const;
   bool isEmpty() const;
 
+  /*
+   * Fits the splines through the knots. Position, velocity and acceleration are set
+   * at the first and the last knot (as far as the spline order allows), and the splines
+   * are joined with continuity up to the derivative of order continuityOrder_.
+   */
   virtual void setData(const std::vector<double>& knotPositions,
                        const std::vector<double>& knotValues,
                        double initialVelocity,
@@ -51,18 +74,113 @@ class PolynomialSplineContainer {
                        double finalVelocity,
                        double finalAcceleration);
 
+  /*
+   * Replaces the splines of the container by splines built from the boundary conditions
+   * in splineOpts, one spline per entry. Returns false if a spline could not be built.
+   */
+  bool setSplines(const std::vector<PolynomialSplineBase::SplineOpts>& splineOpts);
+
+  /*
+   * Fits the splines through the knots with the velocity and acceleration given at every knot.
+   * Every spline is computed independently from the values at its two knots (Hermite interpolation),
+   * optionally in parallel, such that no global system has to be solved. Splines of cubic order
+   * only use the velocities.
+   */
+  void setDataWithDerivatives(const std::vector<double>& knotPositions,
+                              const std::vector<double>& knotValues,
+                              const std::vector<double>& knotVelocities,
+                              const std::vector<double>& knotAccelerations,
+                              bool parallel = false);
+
+  /*
+   * Appends knots (positions relative to the start of the container) to the end of the container.
+   * Only the last numTailSplines splines are re-solved together with the new knots, such that the
+   * cost does not depend on the length of the container. The continuity of the container is kept
+   * at the start of the re-solved window, and the final velocity and acceleration of the last
+   * setData call are applied to the new end as far as the spline order allows.
+   */
+  void extendData(const std::vector<double>& knotPositions,
+                  const std::vector<double>& knotValues,
+                  unsigned int numTailSplines = defaultNumTailSplines);
+
+  /*
+   * Maximum absolute position, velocity, acceleration and jerk of every spline, computed analytically
+   * from the roots of the derivatives. The times are relative to the start of the container.
+   * The splines are processed in parallel if requested.
+   */
+  void getSplineExtrema(std::vector<PolynomialSplineExtrema>& splineExtrema, bool parallel = false) const;
+
+  /// Maximum absolute position, velocity, acceleration and jerk over the whole container.
+  PolynomialSplineExtrema getExtrema(bool parallel = false) const;
+
+  /*
+   * Inserts a knot at time t (relative to the start of the container) by splitting the active
+   * spline, without changing the shape of the container. Costs O(1) for the split plus the shift
+   * of the following splines. Returns false if t is outside of the container or at a knot.
+   */
+  bool insertKnot(double t);
+
+  /*
+   * Times in [t0, t1] (relative to the start of the container) at which the position equals level,
+   * in ascending order. Splines whose Bernstein bounds exclude the level are skipped, the others are
+   * solved with the polynomial root finder. Splines which are constant at the level have no isolated
+   * crossings and are not reported.
+   */
+  void getLevelCrossingTimes(double level, double t0, double t1, std::vector<double>& crossingTimes) const;
+
+  /// First time in [t0, t1] at which the position equals level, returns false if there is none.
+  bool getFirstLevelCrossingTime(double level, double t0, double t1, double& crossingTime) const;
+
+  /*
+   * Scales the duration of every spline by splineScales[i] without a global solve. The knot positions
+   * are kept, and the knot velocities and accelerations are scaled by the largest scale of the adjacent
+   * splines, such that the container stays continuous up to the acceleration (up to the velocity for
+   * cubic splines). Every spline is rebuilt in closed form from its two knots. Resets the container time.
+   */
+  void scaleSplineDurations(const std::vector<double>& splineScales);
+
   PolynomialSplineBase* getSpline(int splineIndex);
+  const std::vector<SplineType>& getSplines() const;
 
   void setContainerTime(double t);
 
   static constexpr double undefinedValue = std::numeric_limits<double>::quiet_NaN();
+  static constexpr unsigned int defaultNumTailSplines = 3;
 
  protected:
-  std::vector<PolynomialSplineQuintic> splines_;
+  /*
+   * Solves the splines through the knots and appends them to the container. The position and the
+   * given derivatives (velocity, acceleration, ...) are set at the first and the last knot.
+   */
+  void appendSplines(const std::vector<double>& knotPositions,
+                     const std::vector<double>& knotValues,
+                     const std::vector<double>& initialDerivatives,
+                     const std::vector<double>& finalDerivatives);
+
+  /// Appends the level crossings in [t0, t1], stops after the first spline with a crossing if requested.
+  void appendLevelCrossingTimes(double level, double t0, double t1, bool stopAtFirst,
+                                std::vector<double>& crossingTimes) const;
+
+  std::vector<SplineType> splines_;
   double timeOffset_;
   double containerTime_;
   double containerDuration_;
   int activeSplineIdx_;
+  double finalVelocity_;
+  double finalAcceleration_;
 };
 
+template <int splineOrder_, int continuityOrder_>
+constexpr double PolynomialSplineContainer<splineOrder_, continuityOrder_>::undefinedValue;
+
+template <int splineOrder_, int continuityOrder_>
+constexpr unsigned int PolynomialSplineContainer<splineOrder_, continuityOrder_>::defaultNumTailSplines;
+
+typedef PolynomialSplineContainer<1> PolynomialSplineContainerLinear;
+typedef PolynomialSplineContainer<3> PolynomialSplineContainerCubic;
+typedef PolynomialSplineContainer<5> PolynomialSplineContainerQuintic;
+typedef PolynomialSplineContainer<7> PolynomialSplineContainerSeptic;
+
 } /* namespace */
+
+#include "curves/PolynomialSplineContainer-inl.hpp"
@@ -0,0 +1,295 @@
+/*
+ * PolynomialSplineOptimizer-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/PolynomialSplineOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <Eigen/SparseLU>
+
+#include <glog/logging.h>
+
+namespace curves {
+
+template <int splineOrder_>
+PolynomialSplineOptimizer<splineOrder_>::PolynomialSplineOptimizer()
+    : cost_(0.0)
+{
+}
+
+template <int splineOrder_>
+PolynomialSplineOptimizer<splineOrder_>::~PolynomialSplineOptimizer()
+{
+}
+
+template <int splineOrder_>
+bool PolynomialSplineOptimizer<splineOrder_>::solve(const std::vector<double>& splineDurations,
+                                                    const std::vector<std::vector<double> >& knotValues,
+                                                    const std::vector<std::vector<double> >& initialDerivatives,
+                                                    const std::vector<std::vector<double> >& finalDerivatives)
+{
+  return solveSystem(splineDurations, knotValues, initialDerivatives, finalDerivatives);
+}
+
+template <int splineOrder_>
+bool PolynomialSplineOptimizer<splineOrder_>::solveWithTimeAllocation(
+    const std::vector<double>& initialSplineDurations,
+    const std::vector<std::vector<double> >& knotValues,
+    double timeWeight,
+    unsigned int maxIterations,
+    const std::vector<std::vector<double> >& initialDerivatives,
+    const std::vector<std::vector<double> >& finalDerivatives)
+{
+  CHECK_GT(timeWeight, 0.0) << "Without a time weight the durations grow unbounded.";
+  const double armijoFactor = 1.0e-4;
+  const double maxLogStep = 0.5;
+  const double relativeTolerance = 1.0e-10;
+
+  std::vector<double> durations(initialSplineDurations);
+  if (!solveSystem(durations, knotValues, initialDerivatives, finalDerivatives)) return false;
+  double objective = cost_ + timeWeight * std::accumulate(durations.begin(), durations.end(), 0.0);
+
+  const size_t numSplines = durations.size();
+  std::vector<double> logGradient(numSplines), trialDurations(numSplines);
+
+  for (unsigned int iteration = 0; iteration < maxIterations; ++iteration) {
+    // Gradient with respect to the logarithm of the durations.
+    double maxAbsLogGradient = 0.0, squaredNorm = 0.0;
+    for (size_t i = 0; i < numSplines; ++i) {
+      logGradient[i] = (costGradient_[i] + timeWeight) * durations[i];
+      maxAbsLogGradient = std::max(maxAbsLogGradient, std::abs(logGradient[i]));
+      squaredNorm += logGradient[i] * logGradient[i];
+    }
+    if (maxAbsLogGradient <= relativeTolerance * objective) break;
+
+    // Backtracking line search, a duration changes at most by a factor exp(maxLogStep).
+    double stepSize = maxLogStep / maxAbsLogGradient;
+    double trialObjective = objective;
+    bool isImproved = false;
+    while (stepSize * maxAbsLogGradient > relativeTolerance) {
+      for (size_t i = 0; i < numSplines; ++i) {
+        trialDurations[i] = durations[i] * std::exp(-stepSize * logGradient[i]);
+      }
+      if (!solveSystem(trialDurations, knotValues, initialDerivatives, finalDerivatives)) return false;
+      trialObjective = cost_ + timeWeight * std::accumulate(trialDurations.begin(), trialDurations.end(), 0.0);
+      if (trialObjective <= objective - armijoFactor * stepSize * squaredNorm) {
+        isImproved = true;
+        break;
+      }
+      stepSize *= 0.5;
+    }
+
+    if (!isImproved) {
+      // Restore the solution of the last accepted durations.
+      return solveSystem(durations, knotValues, initialDerivatives, finalDerivatives);
+    }
+
+    const bool isConverged = (objective - trialObjective) <= relativeTolerance * objective;
+    durations.swap(trialDurations);
+    objective = trialObjective;
+    if (isConverged) break;
+  }
+
+  return true;
+}
+
+template <int splineOrder_>
+double PolynomialSplineOptimizer<splineOrder_>::getCost() const
+{
+  return cost_;
+}
+
+template <int splineOrder_>
+const std::vector<double>& PolynomialSplineOptimizer<splineOrder_>::getCostGradient() const
+{
+  return costGradient_;
+}
+
+template <int splineOrder_>
+const std::vector<double>& PolynomialSplineOptimizer<splineOrder_>::getSplineDurations() const
+{
+  return splineDurations_;
+}
+
+template <int splineOrder_>
+unsigned int PolynomialSplineOptimizer<splineOrder_>::getNumDimensions() const
+{
+  return coefficients_.size();
+}
+
+template <int splineOrder_>
+template <int continuityOrder_>
+void PolynomialSplineOptimizer<splineOrder_>::getContainer(
+    PolynomialSplineContainer<splineOrder_, continuityOrder_>& container, unsigned int dimension) const
+{
+  CHECK_LT(dimension, coefficients_.size());
+  const int numCoeffsSpline = Traits::numCoefficients;
+
+  container.reset();
+  SplineType spline;
+  typename SplineType::SplineCoefficients coefficients;
+  for (size_t i = 0; i < splineDurations_.size(); ++i) {
+    for (int k = 0; k < numCoeffsSpline; ++k) {
+      coefficients[k] = coefficients_[dimension](i*numCoeffsSpline + numCoeffsSpline-1-k);
+    }
+    spline.setCoeffsAndDuration(coefficients, splineDurations_[i]);
+    container.addSpline(spline);
+  }
+}
+
+/*
+ * Constraint rows:
+ *  first knot:  position and derivatives 1, ..., r-1 of the first spline (r rows)
+ *  inner knots: end position of the previous spline, start position of the next spline and
+ *               continuity of the derivatives 1, ..., r-1 (r+1 rows per knot)
+ *  last knot:   position and derivatives 1, ..., r-1 of the last spline (r rows)
+ * with r = costDerivativeOrder.
+ */
+template <int splineOrder_>
+int PolynomialSplineOptimizer<splineOrder_>::getEndConstraintRow(int splineIdx, int numSplines, int derivativeOrder)
+{
+  const int r = costDerivativeOrder;
+  const int knotRow = r + splineIdx*(r+1);
+  if (splineIdx == numSplines-1) return knotRow + derivativeOrder;
+  return (derivativeOrder == 0) ? knotRow : knotRow + 1 + derivativeOrder;
+}
+
+/*
+ * With the cost c'Qc and the constraints Ac = b, the KKT system
+ *    [Q A'] [c]   [0]
+ *    [A 0 ] [mu] = [b]
+ * gives the optimal coefficients c. By the envelope theorem, the derivative of the optimal cost
+ * with respect to a duration is the partial derivative of the Lagrangian c'Qc + 2mu'(Ac - b),
+ * which only involves the value of the integrand and the constraints at the end of the spline.
+ */
+template <int splineOrder_>
+bool PolynomialSplineOptimizer<splineOrder_>::solveSystem(
+    const std::vector<double>& splineDurations,
+    const std::vector<std::vector<double> >& knotValues,
+    const std::vector<std::vector<double> >& initialDerivatives,
+    const std::vector<std::vector<double> >& finalDerivatives)
+{
+  const int r = costDerivativeOrder;
+  const int numCoeffsSpline = Traits::numCoefficients;
+  const int numSplines = splineDurations.size();
+  const size_t numDimensions = knotValues.size();
+
+  CHECK_GT(numSplines, 0);
+  CHECK_GT(numDimensions, 0);
+  CHECK(initialDerivatives.empty() || initialDerivatives.size() == numDimensions);
+  CHECK(finalDerivatives.empty() || finalDerivatives.size() == numDimensions);
+  for (size_t i = 0; i < numDimensions; ++i) {
+    CHECK_EQ(knotValues[i].size(), static_cast<size_t>(numSplines+1)) << "Dimension " << i << " needs a value for every knot.";
+    if (!initialDerivatives.empty()) {
+      CHECK_LT(initialDerivatives[i].size(), static_cast<size_t>(r));
+    }
+    if (!finalDerivatives.empty()) {
+      CHECK_LT(finalDerivatives[i].size(), static_cast<size_t>(r));
+    }
+  }
+  for (const auto duration : splineDurations) CHECK_GT(duration, 0.0);
+
+  const int numCoeffs = numSplines*numCoeffsSpline;
+  const int numConstraints = 2*r + (numSplines-1)*(r+1);
+
+  // Cost matrix, Q(i,j) = f_i f_j tf^(i+j-2r+1) / (i+j-2r+1) for the powers i, j >= r.
+  std::vector<Eigen::Triplet<double> > triplets;
+  for (int s = 0; s < numSplines; ++s) {
+    const double tf = splineDurations[s];
+    const int column = s*numCoeffsSpline;
+    for (int i = r; i <= splineOrder_; ++i) {
+      for (int j = r; j <= splineOrder_; ++j) {
+        const int power = i + j - 2*r + 1;
+        const double value = Traits::getDerivativeFactor(i, r) * Traits::getDerivativeFactor(j, r)
+            * std::pow(tf, power) / power;
+        triplets.push_back(Eigen::Triplet<double>(column + splineOrder_ - i, column + splineOrder_ - j, value));
+      }
+    }
+  }
+  SparseMatrix costMatrix(numCoeffs, numCoeffs);
+  costMatrix.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Constraints, added symmetrically to the KKT matrix.
+  typename Traits::TimeVector timeVec;
+  const auto addConstraint = [&](int row, int splineIdx, double tk, int derivativeOrder, double sign) {
+    Traits::getTimeVector(timeVec, tk, derivativeOrder);
+    for (int k = 0; k < numCoeffsSpline; ++k) {
+      if (timeVec(k) == 0.0) continue;
+      triplets.push_back(Eigen::Triplet<double>(numCoeffs + row, splineIdx*numCoeffsSpline + k, sign*timeVec(k)));
+      triplets.push_back(Eigen::Triplet<double>(splineIdx*numCoeffsSpline + k, numCoeffs + row, sign*timeVec(k)));
+    }
+  };
+
+  for (int d = 0; d < r; ++d) {
+    addConstraint(d, 0, 0.0, d, 1.0);
+  }
+  for (int k = 1; k < numSplines; ++k) {
+    const double tf = splineDurations[k-1];
+    addConstraint(getEndConstraintRow(k-1, numSplines, 0), k-1, tf, 0, 1.0);
+    addConstraint(getEndConstraintRow(k-1, numSplines, 0) + 1, k, 0.0, 0, 1.0);
+    for (int d = 1; d < r; ++d) {
+      addConstraint(getEndConstraintRow(k-1, numSplines, d), k-1, tf, d, 1.0);
+      addConstraint(getEndConstraintRow(k-1, numSplines, d), k, 0.0, d, -1.0);
+    }
+  }
+  for (int d = 0; d < r; ++d) {
+    addConstraint(getEndConstraintRow(numSplines-1, numSplines, d), numSplines-1, splineDurations.back(), d, 1.0);
+  }
+
+  SparseMatrix kktMatrix(numCoeffs + numConstraints, numCoeffs + numConstraints);
+  kktMatrix.setFromTriplets(triplets.begin(), triplets.end());
+
+  Eigen::SparseLU<SparseMatrix, Eigen::COLAMDOrdering<int> > solver;
+  solver.compute(kktMatrix);
+  if (solver.info() != Eigen::Success) return false;
+
+  splineDurations_ = splineDurations;
+  coefficients_.resize(numDimensions);
+  cost_ = 0.0;
+  costGradient_.assign(numSplines, 0.0);
+
+  Eigen::VectorXd rhs(numCoeffs + numConstraints);
+  for (size_t i = 0; i < numDimensions; ++i) {
+    const auto getBoundaryValue = [&](const std::vector<std::vector<double> >& derivatives, int d) -> double {
+      if (d == 0 || derivatives.empty() || d > static_cast<int>(derivatives[i].size())) return 0.0;
+      return derivatives[i][d-1];
+    };
+
+    rhs.setZero();
+    for (int d = 0; d < r; ++d) {
+      rhs(numCoeffs + d) = (d == 0) ? knotValues[i].front() : getBoundaryValue(initialDerivatives, d);
+      rhs(numCoeffs + getEndConstraintRow(numSplines-1, numSplines, d)) =
+          (d == 0) ? knotValues[i].back() : getBoundaryValue(finalDerivatives, d);
+    }
+    for (int k = 1; k < numSplines; ++k) {
+      const int row = numCoeffs + getEndConstraintRow(k-1, numSplines, 0);
+      rhs(row) = knotValues[i][k];
+      rhs(row + 1) = knotValues[i][k];
+    }
+
+    const Eigen::VectorXd solution = solver.solve(rhs);
+    if (solver.info() != Eigen::Success || !solution.allFinite()) return false;
+    coefficients_[i] = solution.head(numCoeffs);
+    cost_ += coefficients_[i].dot(costMatrix * coefficients_[i]);
+
+    for (int s = 0; s < numSplines; ++s) {
+      const auto splineCoeffs = coefficients_[i].segment(s*numCoeffsSpline, numCoeffsSpline);
+      Traits::getTimeVector(timeVec, splineDurations[s], r);
+      const double integrand = (timeVec * splineCoeffs).value();
+      double gradient = integrand * integrand;
+      for (int d = 0; d < r; ++d) {
+        Traits::getTimeVector(timeVec, splineDurations[s], d+1);
+        gradient += 2.0 * solution(numCoeffs + getEndConstraintRow(s, numSplines, d)) * (timeVec * splineCoeffs).value();
+      }
+      costGradient_[s] += gradient;
+    }
+  }
+
+  return true;
+}
+
+} /* namespace */
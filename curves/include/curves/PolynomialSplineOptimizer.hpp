@@ -0,0 +1,111 @@
+/*
+ * PolynomialSplineOptimizer.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineContainer.hpp"
+
+namespace curves {
+
+/*
+ * Minimum-derivative trajectories through knots: the splines of order splineOrder_ minimize the
+ * integral of the squared derivative of order costDerivativeOrder (jerk for quintic, snap for
+ * septic splines) over the whole trajectory. The splines pass through the knot values, are
+ * continuous up to the derivative of order costDerivativeOrder-1 at the inner knots (the optimum
+ * is continuous up to the order 2*costDerivativeOrder-2), and the derivatives up to the order
+ * costDerivativeOrder-1 are set at the first and the last knot.
+ *
+ * The cost and the equality constraints form a sparse KKT system which couples neighboring
+ * splines only, it is solved by a sparse LU decomposition in time linear in the number of splines.
+ * Multiple dimensions share the spline durations, and thereby one decomposition.
+ */
+template <int splineOrder_>
+class PolynomialSplineOptimizer {
+ public:
+  typedef PolynomialSpline<splineOrder_> SplineType;
+  typedef PolynomialSplineTraits<splineOrder_> Traits;
+
+  static constexpr int splineOrder = splineOrder_;
+  static constexpr int costDerivativeOrder = (splineOrder_ + 1) / 2;
+
+  static_assert(splineOrder_ % 2 == 1, "The spline order of the optimizer has to be odd.");
+
+  PolynomialSplineOptimizer();
+  virtual ~PolynomialSplineOptimizer();
+
+  /*
+   * Solves for the splines with the given durations. knotValues holds the values of the knots of
+   * every dimension (splineDurations.size()+1 per dimension). initialDerivatives and finalDerivatives
+   * optionally hold the derivatives 1, ..., costDerivativeOrder-1 of every dimension at the first and
+   * the last knot, missing derivatives are zero (rest to rest). Returns false if the system is singular.
+   */
+  bool solve(const std::vector<double>& splineDurations,
+             const std::vector<std::vector<double> >& knotValues,
+             const std::vector<std::vector<double> >& initialDerivatives = std::vector<std::vector<double> >(),
+             const std::vector<std::vector<double> >& finalDerivatives = std::vector<std::vector<double> >());
+
+  /*
+   * Optimizes the spline durations as well, minimizing cost + timeWeight * (sum of the durations),
+   * starting from the given durations. The gradient of the cost with respect to the durations follows
+   * from the KKT multipliers, and the durations are updated by a gradient descent in logarithmic scale
+   * with backtracking, such that they stay positive. Every iteration costs a few linear-time solves.
+   * Returns false if a solve failed.
+   */
+  bool solveWithTimeAllocation(const std::vector<double>& initialSplineDurations,
+                               const std::vector<std::vector<double> >& knotValues,
+                               double timeWeight,
+                               unsigned int maxIterations = 100,
+                               const std::vector<std::vector<double> >& initialDerivatives = std::vector<std::vector<double> >(),
+                               const std::vector<std::vector<double> >& finalDerivatives = std::vector<std::vector<double> >());
+
+  /// Integral of the squared derivative of order costDerivativeOrder, summed over the dimensions.
+  double getCost() const;
+
+  /// Gradient of the cost with respect to the spline durations.
+  const std::vector<double>& getCostGradient() const;
+
+  const std::vector<double>& getSplineDurations() const;
+  unsigned int getNumDimensions() const;
+
+  /// Replaces the splines of the container by the optimized splines of one dimension.
+  template <int continuityOrder_>
+  void getContainer(PolynomialSplineContainer<splineOrder_, continuityOrder_>& container,
+                    unsigned int dimension = 0) const;
+
+ protected:
+  typedef Eigen::SparseMatrix<double> SparseMatrix;
+
+  /// Row of the constraint on the derivative of order derivativeOrder at the end of a spline.
+  static int getEndConstraintRow(int splineIdx, int numSplines, int derivativeOrder);
+
+  bool solveSystem(const std::vector<double>& splineDurations,
+                   const std::vector<std::vector<double> >& knotValues,
+                   const std::vector<std::vector<double> >& initialDerivatives,
+                   const std::vector<std::vector<double> >& finalDerivatives);
+
+  std::vector<double> splineDurations_;
+
+  /// Coefficients of every dimension, ordered as in PolynomialSplineContainer (an, ..., a0 per spline).
+  std::vector<Eigen::VectorXd> coefficients_;
+
+  double cost_;
+  std::vector<double> costGradient_;
+};
+
+template <int splineOrder_>
+constexpr int PolynomialSplineOptimizer<splineOrder_>::costDerivativeOrder;
+
+typedef PolynomialSplineOptimizer<5> PolynomialSplineMinimumJerkOptimizer;
+typedef PolynomialSplineOptimizer<7> PolynomialSplineMinimumSnapOptimizer;
+
+} /* namespace */
+
+#include "curves/PolynomialSplineOptimizer-inl.hpp"
@@ -0,0 +1,134 @@
+/*
+ * PolynomialSplinePlayer-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/PolynomialSplinePlayer.hpp"
+
+namespace curves {
+
+template <int splineOrder_>
+PolynomialSplinePlayer<splineOrder_>::PolynomialSplinePlayer() noexcept
+    : splines_(nullptr),
+      numSplines_(0),
+      activeSplineIdx_(0),
+      duration_(0.0),
+      time_(0.0),
+      timeOffset_(0.0)
+{
+}
+
+template <int splineOrder_>
+template <int continuityOrder_>
+PolynomialSplinePlayer<splineOrder_>::PolynomialSplinePlayer(
+    const PolynomialSplineContainer<splineOrder_, continuityOrder_>& container) noexcept
+    : PolynomialSplinePlayer()
+{
+  setContainer(container);
+}
+
+template <int splineOrder_>
+template <int continuityOrder_>
+void PolynomialSplinePlayer<splineOrder_>::setContainer(
+    const PolynomialSplineContainer<splineOrder_, continuityOrder_>& container) noexcept
+{
+  splines_ = container.getSplines().data();
+  numSplines_ = container.getSplines().size();
+  duration_ = container.getContainerDuration();
+  rewind();
+}
+
+template <int splineOrder_>
+bool PolynomialSplinePlayer<splineOrder_>::advance(double dt) noexcept
+{
+  if (numSplines_ == 0 || time_ >= duration_) {
+    return false;
+  }
+
+  time_ += dt;
+  updateActiveSpline();
+  return true;
+}
+
+template <int splineOrder_>
+void PolynomialSplinePlayer<splineOrder_>::setTime(double t) noexcept
+{
+  time_ = t;
+  updateActiveSpline();
+}
+
+template <int splineOrder_>
+void PolynomialSplinePlayer<splineOrder_>::rewind() noexcept
+{
+  activeSplineIdx_ = 0;
+  time_ = 0.0;
+  timeOffset_ = 0.0;
+}
+
+template <int splineOrder_>
+double PolynomialSplinePlayer<splineOrder_>::getTime() const noexcept
+{
+  return time_;
+}
+
+template <int splineOrder_>
+double PolynomialSplinePlayer<splineOrder_>::getDuration() const noexcept
+{
+  return duration_;
+}
+
+template <int splineOrder_>
+int PolynomialSplinePlayer<splineOrder_>::getActiveSplineIndex() const noexcept
+{
+  return activeSplineIdx_;
+}
+
+template <int splineOrder_>
+bool PolynomialSplinePlayer<splineOrder_>::isEmpty() const noexcept
+{
+  return numSplines_ == 0;
+}
+
+template <int splineOrder_>
+bool PolynomialSplinePlayer<splineOrder_>::isFinished() const noexcept
+{
+  return time_ >= duration_;
+}
+
+template <int splineOrder_>
+PolynomialSplineState PolynomialSplinePlayer<splineOrder_>::getState() const noexcept
+{
+  PolynomialSplineState state;
+  getState(state);
+  return state;
+}
+
+template <int splineOrder_>
+void PolynomialSplinePlayer<splineOrder_>::getState(PolynomialSplineState& state) const noexcept
+{
+  if (numSplines_ == 0) {
+    state = PolynomialSplineState();
+    return;
+  }
+  splines_[activeSplineIdx_].getStateAtTime(time_ - timeOffset_, state);
+}
+
+template <int splineOrder_>
+void PolynomialSplinePlayer<splineOrder_>::updateActiveSpline() noexcept
+{
+  if (numSplines_ == 0) return;
+
+  while (activeSplineIdx_ > 0 && time_ < timeOffset_) {
+    activeSplineIdx_--;
+    timeOffset_ -= splines_[activeSplineIdx_].getSplineDuration();
+  }
+  if (activeSplineIdx_ == 0) timeOffset_ = 0.0;
+
+  while (activeSplineIdx_ < numSplines_ - 1 && time_ - timeOffset_ >= splines_[activeSplineIdx_].getSplineDuration()) {
+    timeOffset_ += splines_[activeSplineIdx_].getSplineDuration();
+    activeSplineIdx_++;
+  }
+}
+
+} /* namespace */
@@ -0,0 +1,72 @@
+/*
+ * PolynomialSplinePlayer.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineContainer.hpp"
+
+namespace curves {
+
+/*
+ * Playback cursor on the splines of a PolynomialSplineContainer. The player holds the playback
+ * time and the active spline instead of the container, such that any number of players (e.g. one
+ * per controller thread) can play back the same container, which is only read. A player is cheap
+ * to copy, never allocates and never throws.
+ *
+ * The player points to the splines of the container. It is invalidated by any change of the
+ * splines of the container (like an iterator), and has to be rebound with setContainer afterwards.
+ */
+template <int splineOrder_>
+class PolynomialSplinePlayer {
+ public:
+  typedef PolynomialSpline<splineOrder_> SplineType;
+
+  /// Player without splines, its state is zero.
+  PolynomialSplinePlayer() noexcept;
+
+  template <int continuityOrder_>
+  explicit PolynomialSplinePlayer(const PolynomialSplineContainer<splineOrder_, continuityOrder_>& container) noexcept;
+
+  /// Binds the player to the splines of the container and rewinds it.
+  template <int continuityOrder_>
+  void setContainer(const PolynomialSplineContainer<splineOrder_, continuityOrder_>& container) noexcept;
+
+  /*
+   * Advances the playback time by dt, possibly across several splines. Returns false without
+   * advancing if the player has no splines or already reached the end of the container.
+   */
+  bool advance(double dt) noexcept;
+
+  /// Sets the playback time (relative to the start of the container), searching from the active spline.
+  void setTime(double t) noexcept;
+  void rewind() noexcept;
+
+  double getTime() const noexcept;
+  double getDuration() const noexcept;
+  int getActiveSplineIndex() const noexcept;
+  bool isEmpty() const noexcept;
+  bool isFinished() const noexcept;
+
+  /// Position, velocity and acceleration at the playback time, clamped to the container.
+  PolynomialSplineState getState() const noexcept;
+  void getState(PolynomialSplineState& state) const noexcept;
+
+ private:
+  /// Moves the active spline such that it contains the playback time.
+  void updateActiveSpline() noexcept;
+
+  const SplineType* splines_;
+  int numSplines_;
+  int activeSplineIdx_;
+  double duration_;
+  double time_;
+  double timeOffset_;
+};
+
+} /* namespace */
+
+#include "curves/PolynomialSplinePlayer-inl.hpp"
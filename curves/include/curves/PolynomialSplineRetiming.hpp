@@ -0,0 +1,77 @@
+/*
+ * PolynomialSplineRetiming.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "curves/PolynomialSpline.hpp"
+
+namespace curves {
+
+/*
+ * Retimes polynomial spline containers which share their spline durations (one container per
+ * dimension) such that the velocity and acceleration of every dimension stay within the bounds.
+ *
+ * Scaling the duration of a spline by s scales its velocity by 1/s and its acceleration by 1/s^2,
+ * so the analytic extrema of every spline give the scale at which it saturates the tightest bound.
+ * The first pass sets every spline to this scale (shortening splines which are slower than needed),
+ * and the following passes only stretch the splines which still violate a bound after the knot
+ * derivatives have been made consistent between neighboring splines. The coefficients are rescaled
+ * in place, no global system is solved.
+ *
+ * Returns false if the bounds are not met within maxIterations passes.
+ */
+template <typename SplineContainer>
+bool retimeSplineContainers(const std::vector<SplineContainer*>& containers,
+                            const std::vector<double>& maxVelocities,
+                            const std::vector<double>& maxAccelerations,
+                            unsigned int maxIterations = 50,
+                            double tolerance = 1.0e-6)
+{
+  CHECK(!containers.empty());
+  CHECK_EQ(containers.size(), maxVelocities.size());
+  CHECK_EQ(containers.size(), maxAccelerations.size());
+
+  const size_t numSplines = containers.front()->getSplines().size();
+  std::vector<PolynomialSplineExtrema> splineExtrema;
+  std::vector<double> splineScales(numSplines);
+
+  for (unsigned int iteration = 0; iteration < maxIterations; ++iteration) {
+    std::fill(splineScales.begin(), splineScales.end(), 0.0);
+    for (size_t d = 0; d < containers.size(); ++d) {
+      CHECK_GT(maxVelocities[d], 0.0);
+      CHECK_GT(maxAccelerations[d], 0.0);
+      CHECK_EQ(containers[d]->getSplines().size(), numSplines) << "All dimensions need the same number of splines.";
+      containers[d]->getSplineExtrema(splineExtrema);
+      for (size_t i = 0; i < numSplines; ++i) {
+        const double velocityScale = splineExtrema[i].velocity.maxAbsValue / maxVelocities[d];
+        const double accelerationScale = std::sqrt(splineExtrema[i].acceleration.maxAbsValue / maxAccelerations[d]);
+        splineScales[i] = std::max(splineScales[i], std::max(velocityScale, accelerationScale));
+      }
+    }
+
+    bool isWithinBounds = true;
+    for (auto& scale : splineScales) {
+      if (scale > 1.0 + tolerance) isWithinBounds = false;
+      // Splines without motion and, after the first pass, splines within the bounds are kept.
+      if (scale <= 0.0 || (iteration > 0 && scale < 1.0)) scale = 1.0;
+    }
+    if (isWithinBounds && iteration > 0) return true;
+
+    for (auto container : containers) {
+      container->scaleSplineDurations(splineScales);
+    }
+  }
+
+  return false;
+}
+
+} /* namespace */
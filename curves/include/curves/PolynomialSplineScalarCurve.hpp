@@ -8,30 +8,44 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <glog/logging.h>
 
 #include "curves/Curve.hpp"
 #include "curves/ScalarCurveConfig.hpp"
+#include "curves/StaticCurve.hpp"
 #include "curves/PolynomialSplineContainer.hpp"
 #include "curves/PolynomialSplineBase.hpp"
-#include "curves/PolynomialSplineQuintic.hpp"
-#include "curves/PolynomialSplineCubic.hpp"
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineRetiming.hpp"
+#include "curves/PolynomialSplineSmoother.hpp"
+#include "curves/TimeAffineTransform.hpp"
 
 namespace curves {
 
-template<typename SplineType>
-class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
+template<typename SplineType,
+         int continuityOrder = PolynomialSplineTraits<SplineType::splineOrder>::defaultContinuityOrder>
+class PolynomialSplineScalarCurve
+    : public StaticCurve<PolynomialSplineScalarCurve<SplineType, continuityOrder>, Curve<ScalarCurveConfig> >
 {
  public:
-  typedef Curve<ScalarCurveConfig> Parent;
+  typedef StaticCurve<PolynomialSplineScalarCurve<SplineType, continuityOrder>, Curve<ScalarCurveConfig> > Parent;
   typedef typename Parent::ValueType ValueType;
   typedef typename Parent::DerivativeType DerivativeType;
+  typedef PolynomialSplineContainer<SplineType::splineOrder, continuityOrder> SplineContainerType;
+
+  /// Velocity, acceleration and jerk.
+  static constexpr unsigned maxDerivativeOrder = 3;
 
   PolynomialSplineScalarCurve()
-      : Curve<ScalarCurveConfig>(),
-        minTime_(0.0)
+      : Parent(),
+        minTime_(0.0),
+        numExtendSplines_(SplineContainerType::defaultNumTailSplines),
+        hasPendingKnot_(false),
+        pendingKnotTime_(0.0),
+        pendingKnotValue_(0.0)
   {
   }
 
@@ -39,6 +53,7 @@ class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
 
   virtual void print(const std::string& str = "") const
   {
+    if (container_.isEmpty()) return;
     const double minTime = getMinTime();
     const double maxTime = getMaxTime();
     double timeAtEval = minTime;
@@ -46,61 +61,158 @@ class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
     double timeDiff = (maxTime-minTime)/(nPoints-1);
 
     for (int i=0;i<nPoints;i++) {
-      double firstDerivative;
-      double secondDerivative;
       double value;
-      evaluate(value, timeAtEval);
-      evaluateDerivative(firstDerivative, timeAtEval, 1);
-      evaluateDerivative(secondDerivative, timeAtEval, 2);
+      std::array<double, 2> derivatives;
+      evaluateImpl<2>(value, derivatives, timeAtEval);
       printf("t: %lf, x: %lf dx: %lf dxx: %lf\n",
             timeAtEval,
             value,
-            firstDerivative,
-            secondDerivative);
+            derivatives[0],
+            derivatives[1]);
       timeAtEval += timeDiff;
     }
   }
 
   virtual Time getMinTime() const
   {
-    return minTime_;
+    return timeTransform_.fromCurveTime(minTime_);
   }
 
   virtual Time getMaxTime() const
   {
-    return container_.getContainerDuration() + minTime_;
+    return timeTransform_.fromCurveTime(container_.getContainerDuration() + minTime_);
   }
 
-  virtual bool evaluate(ValueType& value, Time time) const
+  /// Non-virtual evaluation, see StaticCurve.
+  bool evaluateImpl(ValueType& value, Time time) const
   {
-    time -= minTime_;
-    value = container_.getPositionAtTime(time);
+    value = container_.getPositionAtTime(getContainerTime(time));
     return true;
   }
 
-  virtual bool evaluateDerivative(DerivativeType& value, Time time, unsigned derivativeOrder) const
+  template <unsigned Order>
+  bool evaluateDerivativeImpl(DerivativeType& value, Time time) const
   {
-    time -= minTime_;
-    switch (derivativeOrder) {
-      case(1): {
-        value = container_.getVelocityAtTime(time);
-      } break;
+    static_assert(Order >= 1 && Order <= maxDerivativeOrder, "The curve does not provide derivatives of this order.");
+    const double containerTime = getContainerTime(time);
+    if (Order == 1) {
+      value = container_.getVelocityAtTime(containerTime);
+    } else if (Order == 2) {
+      value = container_.getAccelerationAtTime(containerTime);
+    } else if (Order == 3) {
+      PolynomialSplineState state;
+      container_.getStateAtTime(containerTime, state, true);
+      value = state.jerk;
+    }
 
-      case(2): {
-        value = container_.getAccelerationAtTime(time);
-      } break;
+    value *= timeTransform_.getDerivativeFactor(Order);
+    return true;
+  }
 
-      default:
-        return false;
+  template <unsigned MaxOrder>
+  bool evaluateImpl(ValueType& value, std::array<DerivativeType, MaxOrder>& derivatives, Time time) const
+  {
+    PolynomialSplineState state;
+    if (!evaluateState(state, time, MaxOrder >= 3)) return false;
+    const double stateDerivatives[] = {state.velocity, state.acceleration, state.jerk};
+    value = state.position;
+    for (unsigned d = 0; d < MaxOrder; ++d) derivatives[d] = stateDerivatives[d];
+    return true;
+  }
+
+  /// Position, velocity, acceleration and optionally jerk at one time, sharing the spline lookup
+  /// and the powers of the spline time (cheaper than evaluate and evaluateDerivative).
+  bool evaluateState(PolynomialSplineState& state, Time time, bool computeJerk = false) const
+  {
+    if (container_.isEmpty()) return false;
+    container_.getStateAtTime(getContainerTime(time), state, computeJerk);
+    if (!timeTransform_.isIdentity()) {
+      state.velocity *= timeTransform_.getDerivativeFactor(1);
+      state.acceleration *= timeTransform_.getDerivativeFactor(2);
+      state.jerk *= timeTransform_.getDerivativeFactor(3);
     }
+    return true;
+  }
 
+  /// Times in [t0, t1] at which the curve equals level, in ascending order
+  /// (see PolynomialSplineContainer::getLevelCrossingTimes).
+  void getLevelCrossingTimes(ValueType level, Time t0, Time t1, std::vector<Time>& crossingTimes) const
+  {
+    container_.getLevelCrossingTimes(level, getContainerTime(t0), getContainerTime(t1), crossingTimes);
+    for (auto& time : crossingTimes) time = timeTransform_.fromCurveTime(time + minTime_);
+  }
+
+  /// First time in [t0, t1] at which the curve equals level, returns false if there is none.
+  bool getFirstLevelCrossingTime(ValueType level, Time t0, Time t1, Time& crossingTime) const
+  {
+    if (!container_.getFirstLevelCrossingTime(level, getContainerTime(t0), getContainerTime(t1), crossingTime)) {
+      return false;
+    }
+    crossingTime = timeTransform_.fromCurveTime(crossingTime + minTime_);
     return true;
   }
 
+  /// Inserts a knot at the given time without changing the shape of the curve, returns false
+  /// if the time is outside of the curve or at a knot.
+  bool insertKnot(Time time)
+  {
+    return container_.insertKnot(getContainerTime(time));
+  }
+
+  /// Stretches and shifts the curve in time, t' = scale*t + offset, without refitting. The
+  /// transform is applied on every evaluation and composes with earlier calls, fitting resets it.
+  void transformTime(double scale, double offset)
+  {
+    timeTransform_.compose(scale, offset);
+  }
+
+  const TimeAffineTransform& getTimeTransform() const
+  {
+    return timeTransform_;
+  }
+
+  /// Appends knots to the curve. Only the last splines of the curve (see setNumExtendSplines)
+  /// are re-solved, such that the cost of an append does not depend on the length of the curve.
+  /// A single knot appended to an empty curve is held back until the next one arrives, the curve
+  /// stays empty until then.
   virtual void extend(const std::vector<Time>& times, const std::vector<ValueType>& values,
                       std::vector<Key>* outKeys)
   {
-    throw std::runtime_error("extend is not yet implemented!");
+    CHECK_EQ(times.size(), values.size());
+    if (times.empty()) return;
+
+    if (container_.isEmpty()) {
+      if (!hasPendingKnot_ && times.size() == 1) {
+        hasPendingKnot_ = true;
+        pendingKnotTime_ = times.front();
+        pendingKnotValue_ = values.front();
+        return;
+      }
+      if (!hasPendingKnot_) {
+        fitCurve(times, values, outKeys);
+        return;
+      }
+      CHECK_GT(times.front(), pendingKnotTime_) << "Knots have to be appended after the end of the curve.";
+      std::vector<Time> fitTimes(1, pendingKnotTime_);
+      std::vector<ValueType> fitValues(1, pendingKnotValue_);
+      fitTimes.insert(fitTimes.end(), times.begin(), times.end());
+      fitValues.insert(fitValues.end(), values.begin(), values.end());
+      hasPendingKnot_ = false;
+      fitCurve(fitTimes, fitValues, outKeys);
+      return;
+    }
+
+    CHECK_GT(times.front(), getMaxTime()) << "Knots have to be appended after the end of the curve.";
+    std::vector<double> knotPositions;
+    knotPositions.reserve(times.size());
+    for (const auto time : times) knotPositions.push_back(getContainerTime(time));
+    container_.extendData(knotPositions, values, numExtendSplines_);
+  }
+
+  /// Sets the number of splines at the end of the curve that are re-solved by extend.
+  void setNumExtendSplines(unsigned int numExtendSplines)
+  {
+    numExtendSplines_ = numExtendSplines;
   }
 
   virtual void fitCurve(const std::vector<Time>& times, const std::vector<ValueType>& values,
@@ -108,6 +220,7 @@ class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
   {
     container_.setData(times, values, 0.0, 0.0, 0.0, 0.0);
     minTime_ = times.front();
+    timeTransform_.reset();
   }
 
   virtual void fitCurve(const std::vector<Time>& times, const std::vector<ValueType>& values,
@@ -118,23 +231,65 @@ class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
     container_.setData(times, values, initialVelocity, initialAcceleration, finalVelocity,
                        finalAcceleration);
     minTime_ = times.front();
+    timeTransform_.reset();
+  }
+
+  /// Fits the curve through the values with the first and second derivatives given at every knot.
+  /// Every spline is computed independently (Hermite interpolation), optionally in parallel.
+  virtual void fitCurve(const std::vector<Time>& times, const std::vector<ValueType>& values,
+                        const std::vector<DerivativeType>& firstDerivatives,
+                        const std::vector<DerivativeType>& secondDerivatives,
+                        std::vector<Key>* outKeys = NULL,
+                        bool parallel = false)
+  {
+    container_.setDataWithDerivatives(times, values, firstDerivatives, secondDerivatives, parallel);
+    minTime_ = times.front();
+    timeTransform_.reset();
   }
 
   virtual void fitCurve(const std::vector<PolynomialSplineBase::SplineOpts>& values,
                         std::vector<Key>* outKeys = NULL)
   {
-    for (auto& value : values) {
-      PolynomialSplineQuintic spline;
-      spline.evalCoeffs(value);
-      container_.addSpline(spline);
-    }
+    CHECK(container_.setSplines(values)) << "Spline options with non-positive duration.";
     minTime_ = 0.0;
+    timeTransform_.reset();
+  }
+
+  /// Fits the curve to noisy samples instead of interpolating them: the splines between the knot
+  /// times minimize the weighted squared residuals plus roughnessWeight times the roughness of the
+  /// curve (see PolynomialSplineSmoother). Returns false if the fit is ill-posed.
+  bool fitCurveSmoothing(const std::vector<Time>& knotTimes, const std::vector<Time>& sampleTimes,
+                         const std::vector<ValueType>& sampleValues, double roughnessWeight,
+                         const std::vector<double>& sampleWeights = std::vector<double>())
+  {
+    PolynomialSplineSmoother<SplineType::splineOrder> smoother;
+    if (!smoother.fit(knotTimes, sampleTimes, std::vector<std::vector<double> >(1, sampleValues),
+                      roughnessWeight, sampleWeights)) {
+      return false;
+    }
+    smoother.getContainer(container_);
+    minTime_ = knotTimes.front();
+    timeTransform_.reset();
+    return true;
+  }
+
+  /// Rescales the spline durations such that the velocity and acceleration bounds are met with
+  /// minimal durations (see retimeSplineContainers). Returns false if the bounds could not be met.
+  /// The bounds refer to the transformed time (see transformTime).
+  bool retime(double maxVelocity, double maxAcceleration, unsigned int maxIterations = 50)
+  {
+    const double scale = timeTransform_.scale;
+    return retimeSplineContainers(std::vector<SplineContainerType*>(1, &container_),
+                                  std::vector<double>(1, maxVelocity * scale),
+                                  std::vector<double>(1, maxAcceleration * scale * scale), maxIterations);
   }
 
   virtual void clear()
   {
     container_.reset();
     minTime_ = 0.0;
+    timeTransform_.reset();
+    hasPendingKnot_ = false;
   }
 
   virtual void transformCurve(const ValueType T)
@@ -143,13 +298,27 @@ class PolynomialSplineScalarCurve : public Curve<ScalarCurveConfig>
   }
 
  private:
-  PolynomialSplineContainer container_;
+  /// Time relative to the start of the container.
+  Time getContainerTime(Time time) const
+  {
+    return timeTransform_.toCurveTime(time) - minTime_;
+  }
+
+  SplineContainerType container_;
   Time minTime_;
+  TimeAffineTransform timeTransform_;
+  unsigned int numExtendSplines_;
+
+  /// First knot appended to an empty curve, see extend.
+  bool hasPendingKnot_;
+  Time pendingKnotTime_;
+  ValueType pendingKnotValue_;
 };
 
+typedef PolynomialSplineScalarCurve<PolynomialSplineLinear> PolynomialSplineLinearScalarCurve;
+typedef PolynomialSplineScalarCurve<PolynomialSplineCubic> PolynomialSplineCubicScalarCurve;
 typedef PolynomialSplineScalarCurve<PolynomialSplineQuintic> PolynomialSplineQuinticScalarCurve;
-//typedef PolynomialSplineScalarCurve<PolynomialSplineCubic> PolynomialSplineCubicScalarCurve;
-//typedef PolynomialSplineScalarCurve<PolynomialSplineLinear> PolynomialSplineLinearScalarCurve;
+typedef PolynomialSplineScalarCurve<PolynomialSplineSeptic> PolynomialSplineSepticScalarCurve;
 
 } // namespace
 
@@ -0,0 +1,203 @@
+/*
+ * PolynomialSplineSmoother-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/PolynomialSplineSmoother.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <Eigen/SparseCholesky>
+
+#include <glog/logging.h>
+
+namespace curves {
+
+template <int splineOrder_>
+PolynomialSplineSmoother<splineOrder_>::PolynomialSplineSmoother()
+{
+}
+
+template <int splineOrder_>
+PolynomialSplineSmoother<splineOrder_>::~PolynomialSplineSmoother()
+{
+}
+
+template <int splineOrder_>
+bool PolynomialSplineSmoother<splineOrder_>::fit(const std::vector<double>& knotPositions,
+                                                 const std::vector<double>& sampleTimes,
+                                                 const std::vector<std::vector<double> >& sampleValues,
+                                                 double roughnessWeight,
+                                                 const std::vector<double>& sampleWeights)
+{
+  const int r = roughnessDerivativeOrder;
+  const int numCoeffsSpline = Traits::numCoefficients;
+  const int numKnots = knotPositions.size();
+  const size_t numSamples = sampleTimes.size();
+  const size_t numDimensions = sampleValues.size();
+
+  CHECK_GT(numKnots, 1);
+  CHECK_GT(numDimensions, 0);
+  CHECK_GE(roughnessWeight, 0.0);
+  CHECK(sampleWeights.empty() || sampleWeights.size() == numSamples);
+  for (size_t i = 0; i < numDimensions; ++i) {
+    CHECK_EQ(sampleValues[i].size(), numSamples) << "Dimension " << i << " needs a value for every sample.";
+  }
+  for (int k = 1; k < numKnots; ++k) {
+    CHECK_GT(knotPositions[k], knotPositions[k-1]) << "Knot positions have to increase strictly.";
+  }
+
+  const int numStates = numKnots*r;
+  const int numSplines = numKnots-1;
+  std::vector<Eigen::VectorXd> rhs(numDimensions, Eigen::VectorXd::Zero(numStates));
+
+  // Block of the normal equations of every spline, it couples the states of its two knots.
+  std::vector<HermiteMatrix, Eigen::aligned_allocator<HermiteMatrix> > blocks(numSplines);
+  std::vector<HermiteMatrix, Eigen::aligned_allocator<HermiteMatrix> > hermiteMatrices(numSplines);
+
+  // Roughness, G(i,j) = f_i f_j tf^(i+j-2r+1) / (i+j-2r+1) for the powers i, j >= r, mapped to the
+  // knot states by the Hermite matrix.
+  HermiteMatrix gramMatrix;
+  for (int s = 0; s < numSplines; ++s) {
+    const double tf = knotPositions[s+1] - knotPositions[s];
+    getHermiteMatrix(hermiteMatrices[s], tf);
+    gramMatrix.setZero();
+    for (int i = r; i <= splineOrder_; ++i) {
+      for (int j = r; j <= splineOrder_; ++j) {
+        const int power = i + j - 2*r + 1;
+        gramMatrix(i, j) = Traits::getDerivativeFactor(i, r) * Traits::getDerivativeFactor(j, r)
+            * std::pow(tf, power) / power;
+      }
+    }
+    blocks[s].noalias() = roughnessWeight * hermiteMatrices[s].transpose() * gramMatrix * hermiteMatrices[s];
+  }
+
+  // Data residuals, the value of a sample is linear in the states of the knots around it.
+  typename Traits::TimeVector timeVec;
+  Eigen::Matrix<double, 1, Traits::numCoefficients> sampleRow;
+  for (size_t j = 0; j < numSamples; ++j) {
+    const double t = sampleTimes[j];
+    CHECK(t >= knotPositions.front() && t <= knotPositions.back()) << "Sample time " << t << " is outside of the knots.";
+    const int s = std::min<int>(std::upper_bound(knotPositions.begin(), knotPositions.end(), t) - knotPositions.begin() - 1,
+                                numSplines-1);
+    const double weight = sampleWeights.empty() ? 1.0 : sampleWeights[j];
+    CHECK_GE(weight, 0.0);
+
+    Traits::getTimeVector(timeVec, t - knotPositions[s], 0);
+    sampleRow.noalias() = timeVec.reverse() * hermiteMatrices[s];
+    blocks[s].noalias() += weight * sampleRow.transpose() * sampleRow;
+    for (size_t d = 0; d < numDimensions; ++d) {
+      rhs[d].template segment<Traits::numCoefficients>(s*r) += (weight*sampleValues[d][j]) * sampleRow.transpose();
+    }
+  }
+
+  std::vector<Eigen::Triplet<double> > triplets;
+  triplets.reserve(numSplines*numCoeffsSpline*numCoeffsSpline);
+  for (int s = 0; s < numSplines; ++s) {
+    for (int i = 0; i < numCoeffsSpline; ++i) {
+      for (int k = 0; k < numCoeffsSpline; ++k) {
+        triplets.push_back(Eigen::Triplet<double>(s*r + i, s*r + k, blocks[s](i, k)));
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<double> normalMatrix(numStates, numStates);
+  normalMatrix.setFromTriplets(triplets.begin(), triplets.end());
+
+  // The band is preserved without reordering.
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Lower, Eigen::NaturalOrdering<int> > solver;
+  solver.compute(normalMatrix);
+  if (solver.info() != Eigen::Success) return false;
+  for (int i = 0; i < numStates; ++i) {
+    if (!(solver.vectorD()(i) > 0.0)) return false;
+  }
+
+  knotPositions_ = knotPositions;
+  knotStates_.resize(numDimensions);
+  for (size_t d = 0; d < numDimensions; ++d) {
+    knotStates_[d] = solver.solve(rhs[d]);
+    if (solver.info() != Eigen::Success) return false;
+  }
+  return true;
+}
+
+template <int splineOrder_>
+const std::vector<double>& PolynomialSplineSmoother<splineOrder_>::getKnotPositions() const
+{
+  return knotPositions_;
+}
+
+template <int splineOrder_>
+unsigned int PolynomialSplineSmoother<splineOrder_>::getNumDimensions() const
+{
+  return knotStates_.size();
+}
+
+template <int splineOrder_>
+double PolynomialSplineSmoother<splineOrder_>::getKnotState(unsigned int dimension, unsigned int knotIdx,
+                                                            unsigned int derivativeOrder) const
+{
+  CHECK_LT(dimension, knotStates_.size());
+  CHECK_LT(knotIdx, knotPositions_.size());
+  CHECK_LT(derivativeOrder, static_cast<unsigned int>(roughnessDerivativeOrder));
+  return knotStates_[dimension](knotIdx*roughnessDerivativeOrder + derivativeOrder);
+}
+
+template <int splineOrder_>
+template <int continuityOrder_>
+void PolynomialSplineSmoother<splineOrder_>::getContainer(
+    PolynomialSplineContainer<splineOrder_, continuityOrder_>& container, unsigned int dimension) const
+{
+  CHECK_LT(dimension, knotStates_.size());
+  const int r = roughnessDerivativeOrder;
+
+  container.reset();
+  SplineType spline;
+  typename SplineType::SplineCoefficients coefficients;
+  HermiteMatrix hermiteMatrix;
+  Eigen::Matrix<double, Traits::numCoefficients, 1> splineCoeffs;
+  for (size_t s = 0; s + 1 < knotPositions_.size(); ++s) {
+    const double tf = knotPositions_[s+1] - knotPositions_[s];
+    getHermiteMatrix(hermiteMatrix, tf);
+    splineCoeffs.noalias() = hermiteMatrix * knotStates_[dimension].template segment<Traits::numCoefficients>(s*r);
+    for (int k = 0; k < Traits::numCoefficients; ++k) {
+      coefficients[k] = splineCoeffs(k);
+    }
+    spline.setCoeffsAndDuration(coefficients, tf);
+    container.addSpline(spline);
+  }
+}
+
+/*
+ * The lower coefficients follow from the start state, a_d = s0_d / d!. The upper coefficients
+ * follow from the residuals of the end state with the normalized boundary matrix inverse (see
+ * PolynomialSplineTraits::getBoundaryMatrixInverse).
+ */
+template <int splineOrder_>
+void PolynomialSplineSmoother<splineOrder_>::getHermiteMatrix(HermiteMatrix& hermiteMatrix, double duration)
+{
+  const int m = Traits::numSplineBoundaryConstraints;
+  const typename Traits::BoundaryMatrix& boundaryInverse = Traits::getBoundaryMatrixInverse();
+
+  hermiteMatrix.setZero();
+  Eigen::Matrix<double, m, Traits::numCoefficients> residuals;
+  residuals.setZero();
+  for (int d = 0; d < m; ++d) {
+    hermiteMatrix(d, d) = 1.0 / Traits::getDerivativeFactor(d, d);
+  }
+  for (int d = 0; d < m; ++d) {
+    residuals(d, m + d) = std::pow(duration, d);
+    // Contribution of the lower coefficients to the end state.
+    for (int i = d; i < m; ++i) {
+      residuals.row(d) -= std::pow(duration, d) * Traits::getDerivativeFactor(i, d) * std::pow(duration, i - d)
+          * hermiteMatrix.row(i);
+    }
+  }
+  hermiteMatrix.bottomRows(m).noalias() = boundaryInverse * residuals;
+  for (int j = 0; j < m; ++j) {
+    hermiteMatrix.row(m + j) /= std::pow(duration, m + j);
+  }
+}
+
+} /* namespace */
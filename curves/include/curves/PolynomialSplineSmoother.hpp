@@ -0,0 +1,85 @@
+/*
+ * PolynomialSplineSmoother.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineContainer.hpp"
+
+namespace curves {
+
+/*
+ * Smoothing least-squares fit of splines of order splineOrder_ to noisy samples. Instead of
+ * interpolating the samples, the splines minimize
+ *    sum_j w_j (s(t_j) - y_j)^2 + roughnessWeight * integral of s^(r)(t)^2
+ * with r = roughnessDerivativeOrder (acceleration for cubic, jerk for quintic splines) over a knot
+ * schedule which is usually much coarser than the samples.
+ *
+ * The unknowns are the position and the derivatives up to the order r-1 at every knot, every
+ * spline is the Hermite interpolation of the states of its two knots, so the fit is continuous up
+ * to the derivative of order r-1. A sample and the roughness of a spline only couple the states of
+ * two neighboring knots, hence the normal equations are banded and are solved by a sparse LDLT
+ * decomposition without reordering in time linear in the number of knots and samples.
+ * Multiple dimensions share the knots, the samples and thereby one decomposition.
+ */
+template <int splineOrder_>
+class PolynomialSplineSmoother {
+ public:
+  typedef PolynomialSpline<splineOrder_> SplineType;
+  typedef PolynomialSplineTraits<splineOrder_> Traits;
+
+  static constexpr int splineOrder = splineOrder_;
+  static constexpr int roughnessDerivativeOrder = Traits::numSplineBoundaryConstraints;
+
+  PolynomialSplineSmoother();
+  virtual ~PolynomialSplineSmoother();
+
+  /*
+   * Fits the splines between the strictly increasing knot positions to the samples. sampleValues
+   * holds the samples of every dimension (sampleTimes.size() per dimension), the sample times
+   * have to lie within the knots. sampleWeights optionally weights the samples (e.g. the inverse
+   * variances), by default all samples have the weight one. Returns false if the normal equations
+   * are singular, e.g. if a spline has too few samples without a roughness weight.
+   */
+  bool fit(const std::vector<double>& knotPositions,
+           const std::vector<double>& sampleTimes,
+           const std::vector<std::vector<double> >& sampleValues,
+           double roughnessWeight,
+           const std::vector<double>& sampleWeights = std::vector<double>());
+
+  const std::vector<double>& getKnotPositions() const;
+  unsigned int getNumDimensions() const;
+
+  /// Fitted derivative of order derivativeOrder < roughnessDerivativeOrder at a knot.
+  double getKnotState(unsigned int dimension, unsigned int knotIdx, unsigned int derivativeOrder = 0) const;
+
+  /// Replaces the splines of the container by the fitted splines of one dimension.
+  template <int continuityOrder_>
+  void getContainer(PolynomialSplineContainer<splineOrder_, continuityOrder_>& container,
+                    unsigned int dimension = 0) const;
+
+ protected:
+  typedef Eigen::Matrix<double, Traits::numCoefficients, Traits::numCoefficients> HermiteMatrix;
+
+  /// Maps the states of the start and the end knot of a spline to its coefficients (a0, ..., an).
+  static void getHermiteMatrix(HermiteMatrix& hermiteMatrix, double duration);
+
+  std::vector<double> knotPositions_;
+
+  /// Knot states of every dimension, ordered by knot and derivative.
+  std::vector<Eigen::VectorXd> knotStates_;
+};
+
+template <int splineOrder_>
+constexpr int PolynomialSplineSmoother<splineOrder_>::roughnessDerivativeOrder;
+
+} /* namespace */
+
+#include "curves/PolynomialSplineSmoother-inl.hpp"
@@ -0,0 +1,101 @@
+/*
+ * PolynomialSplineTraits.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+namespace curves {
+
+/// Compile-time properties of a polynomial spline
+///   s(t) = a_n*t^n + ... + a_1*t + a_0,   n = splineOrder.
+template <int splineOrder>
+struct PolynomialSplineTraits {
+  static_assert(splineOrder >= 1 && splineOrder % 2 == 1,
+                "Polynomial splines need an odd order (linear, cubic, quintic, septic, ...).");
+
+  /// Number of coefficients of one spline.
+  static constexpr int numCoefficients = splineOrder + 1;
+
+  /// Number of derivatives which are constrained (besides the position) at each end
+  /// of a single spline, such that the boundary-value problem is square.
+  static constexpr int numSplineBoundaryDerivatives = (splineOrder - 1) / 2;
+
+  /// Number of derivatives which are constrained (besides the position) at the first
+  /// and the last knot of a container. Only velocity and acceleration are given.
+  static constexpr int numBoundaryDerivatives =
+      (numSplineBoundaryDerivatives < 2) ? numSplineBoundaryDerivatives : 2;
+
+  /// Default continuity order at the junctions of a container: C0 for linear,
+  /// C2 for cubic and quintic, and C3 and higher for septic and higher order splines.
+  static constexpr int defaultContinuityOrder =
+      (splineOrder < 3) ? splineOrder - 1 : ((numSplineBoundaryDerivatives < 2) ? 2 : numSplineBoundaryDerivatives);
+
+  /// Number of constraints at each end of a single spline (position and derivatives).
+  static constexpr int numSplineBoundaryConstraints = numSplineBoundaryDerivatives + 1;
+
+  typedef Eigen::Matrix<double, 1, numCoefficients> TimeVector;
+  typedef Eigen::Matrix<double, numSplineBoundaryConstraints, numSplineBoundaryConstraints> BoundaryMatrix;
+
+  /// Falling factorial k!/(k-d)!, i.e. the factor of the d-th derivative of t^k.
+  static double getDerivativeFactor(int power, int derivativeOrder)
+  {
+    double factor = 1.0;
+    for (int k = 0; k < derivativeOrder; ++k) {
+      factor *= static_cast<double>(power - k);
+    }
+    return factor;
+  }
+
+  /*
+   * Once the lower coefficients a_0 ... a_(m-1) are given by the initial conditions, the upper
+   * coefficients follow from the final conditions. With the normalized unknowns x_j = a_(m+j)*tf^(m+j)
+   * and the normalized residuals r_d*tf^d of the final derivatives, the system matrix
+   *  M(d,j) = (m+j)!/(m+j-d)!
+   * does not depend on the spline duration, so its inverse is computed only once.
+   */
+  static const BoundaryMatrix& getBoundaryMatrixInverse()
+  {
+    static const BoundaryMatrix inverse = computeBoundaryMatrixInverse();
+    return inverse;
+  }
+
+  /*
+   * Time vector of the derivative of order d, sorted by decreasing power:
+   *  tau(tk)   = [ tk^n        tk^(n-1)          ...  tk  1 ]
+   *  dtau(tk)  = [ n*tk^(n-1)  (n-1)*tk^(n-2)    ...  1   0 ]
+   *  ddtau(tk) = [ n*(n-1)*tk^(n-2)              ...  0   0 ]
+   */
+  static void getTimeVector(TimeVector& timeVec, double tk, int derivativeOrder)
+  {
+    double tkPower = 1.0;
+    for (int power = 0; power <= splineOrder; ++power) {
+      const int idx = splineOrder - power;
+      if (power < derivativeOrder) {
+        timeVec(idx) = 0.0;
+        continue;
+      }
+      timeVec(idx) = getDerivativeFactor(power, derivativeOrder) * tkPower;
+      tkPower *= tk;
+    }
+  }
+
+ private:
+  static BoundaryMatrix computeBoundaryMatrixInverse()
+  {
+    const int m = numSplineBoundaryConstraints;
+    BoundaryMatrix M;
+    for (int d = 0; d < m; ++d) {
+      for (int j = 0; j < m; ++j) {
+        M(d, j) = getDerivativeFactor(m + j, d);
+      }
+    }
+    return M.fullPivLu().inverse();
+  }
+};
+
+} /* namespace */
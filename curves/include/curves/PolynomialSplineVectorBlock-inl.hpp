@@ -0,0 +1,220 @@
+/*
+ * PolynomialSplineVectorBlock-inl.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "curves/PolynomialSplineVectorBlock.hpp"
+
+#include <algorithm>
+
+#include <glog/logging.h>
+
+namespace curves {
+
+template <int splineOrder_, int N>
+PolynomialSplineVectorBlock<splineOrder_, N>::PolynomialSplineVectorBlock()
+{
+  clear();
+}
+
+template <int splineOrder_, int N>
+PolynomialSplineVectorBlock<splineOrder_, N>::~PolynomialSplineVectorBlock()
+{
+}
+
+template <int splineOrder_, int N>
+template <int continuityOrder_>
+void PolynomialSplineVectorBlock<splineOrder_, N>::setFromContainers(
+    const std::vector<PolynomialSplineContainer<splineOrder_, continuityOrder_> >& containers)
+{
+  CHECK_EQ(containers.size(), N);
+  clear();
+
+  const size_t numSegments = containers.front().getSplines().size();
+  for (size_t i = 1; i < N; ++i) {
+    CHECK_EQ(containers[i].getSplines().size(), numSegments) << "All dimensions need the same number of splines.";
+  }
+
+  coefficients_.resize(numSegments);
+  knotTimes_.reserve(numSegments + 1);
+  for (size_t s = 0; s < numSegments; ++s) {
+    for (size_t i = 0; i < N; ++i) {
+      const auto& splineCoeffs = containers[i].getSplines()[s].getCoeffs();
+      for (int k = 0; k < Traits::numCoefficients; ++k) {
+        coefficients_[s](i, k) = splineCoeffs[k];
+      }
+    }
+    knotTimes_.push_back(knotTimes_.back() + containers.front().getSplines()[s].getSplineDuration());
+  }
+}
+
+template <int splineOrder_, int N>
+void PolynomialSplineVectorBlock<splineOrder_, N>::clear()
+{
+  coefficients_.clear();
+  knotTimes_.assign(1, 0.0);
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::isEmpty() const
+{
+  return coefficients_.empty();
+}
+
+template <int splineOrder_, int N>
+int PolynomialSplineVectorBlock<splineOrder_, N>::getNumSegments() const
+{
+  return coefficients_.size();
+}
+
+template <int splineOrder_, int N>
+double PolynomialSplineVectorBlock<splineOrder_, N>::getDuration() const
+{
+  return knotTimes_.back();
+}
+
+template <int splineOrder_, int N>
+int PolynomialSplineVectorBlock<splineOrder_, N>::getSegmentIndexAtTime(double t, double& segmentTime) const
+{
+  if (coefficients_.empty()) return -1;
+
+  // Binary search on the inner knots, times outside of the block belong to the first or last segment.
+  const int segmentIdx = std::upper_bound(knotTimes_.begin() + 1, knotTimes_.end() - 1, t) - (knotTimes_.begin() + 1);
+
+  // Clamp the time to the segment as the scalar splines do.
+  segmentTime = std::max(0.0, std::min(t - knotTimes_[segmentIdx], knotTimes_[segmentIdx + 1] - knotTimes_[segmentIdx]));
+  return segmentIdx;
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getPositionAtTime(ValueType& position, double t) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  position = coeffs.col(splineOrder_);
+  for (int k = splineOrder_ - 1; k >= 0; --k) {
+    position = position*tk + coeffs.col(k);
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getVelocityAtTime(ValueType& velocity, double t) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  velocity = double(splineOrder_)*coeffs.col(splineOrder_);
+  for (int k = splineOrder_ - 1; k >= 1; --k) {
+    velocity = velocity*tk + double(k)*coeffs.col(k);
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getAccelerationAtTime(ValueType& acceleration, double t) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  acceleration = double(splineOrder_*(splineOrder_ - 1))*coeffs.col(splineOrder_);
+  for (int k = splineOrder_ - 1; k >= 2; --k) {
+    acceleration = acceleration*tk + double(k*(k - 1))*coeffs.col(k);
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getDerivativeAtTime(ValueType& derivative, double t, int derivativeOrder) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  derivative.setZero();
+  for (int k = splineOrder_; k >= derivativeOrder; --k) {
+    derivative = derivative*tk + Traits::getDerivativeFactor(k, derivativeOrder)*coeffs.col(k);
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+template <int derivativeOrder>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getDerivativeAtTime(ValueType& derivative, double t) const
+{
+  static_assert(derivativeOrder >= 0, "The derivative order has to be non-negative.");
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  derivative.setZero();
+  for (int k = splineOrder_; k >= derivativeOrder; --k) {
+    derivative = derivative*tk + Traits::getDerivativeFactor(k, derivativeOrder)*coeffs.col(k);
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+template <int maxDerivativeOrder>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getDerivativesAtTime(
+    ValueType& position, std::array<ValueType, maxDerivativeOrder>& derivatives, double t) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  // Horner's scheme for the Taylor coefficients p^(d)(tk)/d! (see getStateAtTime), d = 1 is stored
+  // at derivatives[0].
+  position = coeffs.col(splineOrder_);
+  for (int d = 0; d < maxDerivativeOrder; ++d) derivatives[d].setZero();
+  for (int k = splineOrder_ - 1; k >= 0; --k) {
+    for (int d = maxDerivativeOrder - 1; d > 0; --d) {
+      derivatives[d] = derivatives[d]*tk + derivatives[d - 1];
+    }
+    if (maxDerivativeOrder > 0) derivatives[0] = derivatives[0]*tk + position;
+    position = position*tk + coeffs.col(k);
+  }
+  double factorial = 1.0;
+  for (int d = 0; d < maxDerivativeOrder; ++d) {
+    factorial *= d + 1;
+    derivatives[d] *= factorial;
+  }
+  return true;
+}
+
+template <int splineOrder_, int N>
+bool PolynomialSplineVectorBlock<splineOrder_, N>::getStateAtTime(State& state, double t, bool computeJerk) const
+{
+  double tk;
+  const int segmentIdx = getSegmentIndexAtTime(t, tk);
+  if (segmentIdx < 0) return false;
+  const SegmentCoefficients& coeffs = coefficients_[segmentIdx];
+
+  // Horner's scheme for the Taylor coefficients p^(d)(tk)/d!, scaled at the end.
+  state.position = coeffs.col(splineOrder_);
+  state.velocity.setZero();
+  state.acceleration.setZero();
+  state.jerk.setZero();
+  for (int k = splineOrder_ - 1; k >= 0; --k) {
+    if (computeJerk) state.jerk = state.jerk*tk + state.acceleration;
+    state.acceleration = state.acceleration*tk + state.velocity;
+    state.velocity = state.velocity*tk + state.position;
+    state.position = state.position*tk + coeffs.col(k);
+  }
+  state.acceleration *= 2.0;
+  state.jerk *= 6.0;
+  return true;
+}
+
+} /* namespace */
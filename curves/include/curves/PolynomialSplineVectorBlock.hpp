@@ -0,0 +1,86 @@
+/*
+ * PolynomialSplineVectorBlock.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineContainer.hpp"
+
+namespace curves {
+
+/*
+ * Polynomial splines of N dimensions which share their knot times. The coefficients are
+ * stored as one contiguous [segment][power][dim] block, such that an evaluation needs a
+ * single segment lookup and one Horner pass over all dimensions.
+ */
+template <int splineOrder_, int N>
+class PolynomialSplineVectorBlock {
+ public:
+  typedef PolynomialSplineTraits<splineOrder_> Traits;
+  typedef Eigen::Matrix<double, N, 1> ValueType;
+
+  /// Coefficients of one segment, column k holds the coefficients of t^k of all dimensions.
+  typedef Eigen::Matrix<double, N, Traits::numCoefficients> SegmentCoefficients;
+
+  /// Position, velocity, acceleration and (if requested) jerk of all dimensions at one time.
+  struct State {
+    ValueType position;
+    ValueType velocity;
+    ValueType acceleration;
+    ValueType jerk;
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  };
+
+  PolynomialSplineVectorBlock();
+  virtual ~PolynomialSplineVectorBlock();
+
+  /// Copies the coefficients of N scalar containers with identical spline durations.
+  template <int continuityOrder_>
+  void setFromContainers(const std::vector<PolynomialSplineContainer<splineOrder_, continuityOrder_> >& containers);
+
+  void clear();
+  bool isEmpty() const;
+
+  int getNumSegments() const;
+  double getDuration() const;
+
+  /// Index of the segment active at time t (relative to the start), and the time within the segment.
+  int getSegmentIndexAtTime(double t, double& segmentTime) const;
+
+  bool getPositionAtTime(ValueType& position, double t) const;
+  bool getVelocityAtTime(ValueType& velocity, double t) const;
+  bool getAccelerationAtTime(ValueType& acceleration, double t) const;
+
+  /// Derivative of arbitrary order, zero for orders higher than the spline order.
+  bool getDerivativeAtTime(ValueType& derivative, double t, int derivativeOrder) const;
+
+  /// Derivative of compile-time order, zero for orders higher than the spline order.
+  template <int derivativeOrder>
+  bool getDerivativeAtTime(ValueType& derivative, double t) const;
+
+  /// Position and the derivatives of the orders 1 to maxDerivativeOrder with one segment lookup
+  /// and one Horner pass.
+  template <int maxDerivativeOrder>
+  bool getDerivativesAtTime(ValueType& position, std::array<ValueType, maxDerivativeOrder>& derivatives,
+                            double t) const;
+
+  /// Position, velocity, acceleration and optionally jerk with one segment lookup and one Horner pass.
+  bool getStateAtTime(State& state, double t, bool computeJerk = false) const;
+
+ protected:
+  /// Start times of the segments and the end time of the last segment.
+  std::vector<double> knotTimes_;
+  std::vector<SegmentCoefficients, Eigen::aligned_allocator<SegmentCoefficients> > coefficients_;
+};
+
+} /* namespace */
+
+#include "curves/PolynomialSplineVectorBlock-inl.hpp"
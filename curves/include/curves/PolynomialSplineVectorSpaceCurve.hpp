@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <Eigen/Core>
@@ -15,23 +16,35 @@
 
 #include "curves/Curve.hpp"
 #include "curves/VectorSpaceCurve.hpp"
+#include "curves/StaticCurve.hpp"
 #include "curves/PolynomialSplineContainer.hpp"
 #include "curves/PolynomialSplineBase.hpp"
-#include "curves/PolynomialSplineQuintic.hpp"
-#include "curves/PolynomialSplineCubic.hpp"
+#include "curves/PolynomialSpline.hpp"
+#include "curves/PolynomialSplineVectorBlock.hpp"
+#include "curves/PolynomialSplineRetiming.hpp"
+#include "curves/PolynomialSplineSmoother.hpp"
+#include "curves/TimeAffineTransform.hpp"
 
 namespace curves {
 
-template<typename SplineType, int N>
-class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
+template<typename SplineType, int N,
+         int continuityOrder = PolynomialSplineTraits<SplineType::splineOrder>::defaultContinuityOrder>
+class PolynomialSplineVectorSpaceCurve
+    : public StaticCurve<PolynomialSplineVectorSpaceCurve<SplineType, N, continuityOrder>, VectorSpaceCurve<N> >
 {
  public:
-  typedef VectorSpaceCurve<N> Parent;
+  typedef StaticCurve<PolynomialSplineVectorSpaceCurve<SplineType, N, continuityOrder>, VectorSpaceCurve<N> > Parent;
   typedef typename Parent::ValueType ValueType;
   typedef typename Parent::DerivativeType DerivativeType;
+  typedef PolynomialSplineContainer<SplineType::splineOrder, continuityOrder> SplineContainerType;
+  typedef PolynomialSplineVectorBlock<SplineType::splineOrder, N> SplineBlockType;
+  typedef typename SplineBlockType::State StateType;
+
+  /// Velocity, acceleration and jerk.
+  static constexpr unsigned maxDerivativeOrder = 3;
 
   PolynomialSplineVectorSpaceCurve()
-      : VectorSpaceCurve<N>(),
+      : Parent(),
         minTime_(0)
   {
     containers_.resize(N);
@@ -47,37 +60,118 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
 
   virtual Time getMinTime() const
   {
-    return minTime_;
+    return timeTransform_.fromCurveTime(minTime_);
   }
 
   virtual Time getMaxTime() const
   {
-    return containers_.at(0).getContainerDuration();
+    return timeTransform_.fromCurveTime(block_.getDuration() + minTime_);
   }
 
-  virtual bool evaluate(ValueType& value, Time time) const
+  /// Non-virtual evaluation, see StaticCurve.
+  bool evaluateImpl(ValueType& value, Time time) const
   {
-    for (size_t i = 0; i < N; ++i) {
-      value(i) = containers_.at(i).getPositionAtTime(time);
+    return block_.getPositionAtTime(value, getBlockTime(time));
+  }
+
+  template <unsigned Order>
+  bool evaluateDerivativeImpl(DerivativeType& value, Time time) const
+  {
+    if (!block_.template getDerivativeAtTime<Order>(value, getBlockTime(time))) return false;
+    value *= timeTransform_.getDerivativeFactor(Order);
+    return true;
+  }
+
+  template <unsigned MaxOrder>
+  bool evaluateImpl(ValueType& value, std::array<DerivativeType, MaxOrder>& derivatives, Time time) const
+  {
+    if (!block_.template getDerivativesAtTime<MaxOrder>(value, derivatives, getBlockTime(time))) return false;
+    if (!timeTransform_.isIdentity()) {
+      for (unsigned d = 0; d < MaxOrder; ++d) derivatives[d] *= timeTransform_.getDerivativeFactor(d + 1);
     }
     return true;
   }
 
-  virtual bool evaluateDerivative(DerivativeType& value, Time time, unsigned derivativeOrder) const
+  /// Position, velocity, acceleration and optionally jerk at one time, sharing the segment lookup
+  /// and one Horner pass over all dimensions (cheaper than evaluate and evaluateDerivative).
+  bool evaluateState(StateType& state, Time time, bool computeJerk = false) const
+  {
+    if (!block_.getStateAtTime(state, getBlockTime(time), computeJerk)) return false;
+    if (!timeTransform_.isIdentity()) {
+      state.velocity *= timeTransform_.getDerivativeFactor(1);
+      state.acceleration *= timeTransform_.getDerivativeFactor(2);
+      state.jerk *= timeTransform_.getDerivativeFactor(3);
+    }
+    return true;
+  }
+
+  /// Times in [t0, t1] at which one dimension of the curve equals level, in ascending order
+  /// (see PolynomialSplineContainer::getLevelCrossingTimes).
+  void getLevelCrossingTimes(unsigned int dimension, double level, Time t0, Time t1,
+                             std::vector<Time>& crossingTimes) const
+  {
+    containers_.at(dimension).getLevelCrossingTimes(level, getBlockTime(t0), getBlockTime(t1), crossingTimes);
+    for (auto& time : crossingTimes) time = timeTransform_.fromCurveTime(time + minTime_);
+  }
+
+  /// First time in [t0, t1] at which one dimension of the curve equals level, returns false if there is none.
+  bool getFirstLevelCrossingTime(unsigned int dimension, double level, Time t0, Time t1, Time& crossingTime) const
+  {
+    if (!containers_.at(dimension).getFirstLevelCrossingTime(level, getBlockTime(t0), getBlockTime(t1), crossingTime)) {
+      return false;
+    }
+    crossingTime = timeTransform_.fromCurveTime(crossingTime + minTime_);
+    return true;
+  }
+
+  /// Inserts a knot at the given time in all dimensions without changing the shape of the curve,
+  /// returns false if the time is outside of the curve or at a knot.
+  bool insertKnot(Time time)
+  {
+    const Time blockTime = getBlockTime(time);
+    // All dimensions share the knots, so they either all accept or all reject the knot.
+    if (!containers_.front().insertKnot(blockTime)) return false;
+    for (size_t i = 1; i < containers_.size(); ++i) {
+      containers_[i].insertKnot(blockTime);
+    }
+    block_.setFromContainers(containers_);
+    return true;
+  }
+
+  /// Stretches and shifts the curve in time, t' = scale*t + offset, without refitting. The
+  /// transform is applied on every evaluation and composes with earlier calls, fitting resets it.
+  void transformTime(double scale, double offset)
+  {
+    timeTransform_.compose(scale, offset);
+  }
+
+  const TimeAffineTransform& getTimeTransform() const
   {
+    return timeTransform_;
+  }
 
+  /// Maximum absolute position, velocity, acceleration and jerk of every dimension, computed
+  /// analytically from the roots of the derivatives. The splines are processed in parallel if requested.
+  /// Values and times refer to the transformed time.
+  std::vector<PolynomialSplineExtrema> getExtrema(bool parallel = false) const
+  {
+    std::vector<PolynomialSplineExtrema> extrema;
     for (size_t i = 0; i < N; ++i) {
-      if (derivativeOrder == 1) {
-        value(i) = containers_.at(i).getVelocityAtTime(time);
-      }
-      else if (derivativeOrder == 2) {
-        value(i) = containers_.at(i).getAccelerationAtTime(time);
-      }
-      else {
-        return false;
+      extrema.push_back(containers_.at(i).getExtrema(parallel));
+      PolynomialSplineExtremum* derivatives[] = {&extrema.back().position, &extrema.back().velocity,
+                                                 &extrema.back().acceleration, &extrema.back().jerk};
+      for (unsigned int d = 0; d < 4; ++d) {
+        derivatives[d]->maxAbsValue *= timeTransform_.getDerivativeFactor(d);
+        derivatives[d]->time = timeTransform_.fromCurveTime(derivatives[d]->time + minTime_);
       }
     }
-    return true;
+    return extrema;
+  }
+
+  /// Coefficients of all dimensions in one block, used for the evaluation.
+  const SplineBlockType& getSplineBlock() const
+  {
+    return block_;
   }
 
   virtual void extend(const std::vector<Time>& times, const std::vector<ValueType>& values,
@@ -90,12 +184,14 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
                         std::vector<Key>* outKeys = NULL)
   {
     minTime_ = times.front();
+    timeTransform_.reset();
     for (size_t i = 0; i < N; ++i) {
       std::vector<double> scalarValues;
       scalarValues.reserve(times.size());
       for (size_t t = 0; t < times.size(); ++t) scalarValues.push_back(values.at(t)(i));
       containers_.at(i).setData(times, scalarValues, 0.0, 0.0, 0.0, 0.0);
     }
+    block_.setFromContainers(containers_);
   }
 
   virtual void fitCurve(const std::vector<Time>& times,
@@ -106,6 +202,7 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
                         const DerivativeType& finalAcceleration)
   {
     minTime_ = times.front();
+    timeTransform_.reset();
     for (size_t i = 0; i < N; ++i) {
       std::vector<double> scalarValues;
       scalarValues.reserve(times.size());
@@ -113,35 +210,96 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
       containers_.at(i).setData(times, scalarValues, initialVelocity(i), initialAcceleration(i),
                                 finalVelocity(i), finalAcceleration(i));
     }
+    block_.setFromContainers(containers_);
   }
 
+  /// Fits the curve through the values with the first and second derivatives given at every knot.
+  /// Every spline is computed independently (Hermite interpolation), optionally in parallel.
   virtual void fitCurve(const std::vector<Time>& times, const std::vector<ValueType>& values,
                         const std::vector<DerivativeType>& firstDerivatives,
                         const std::vector<DerivativeType>& secondDerivatives,
-                        std::vector<Key>* outKeys = NULL)
+                        std::vector<Key>* outKeys = NULL,
+                        bool parallel = false)
   {
     minTime_ = times.front();
+    timeTransform_.reset();
     for (size_t i = 0; i < N; ++i) {
       std::vector<double> scalarValues, scalarFirstDerivates, scalarSecondDerivates;
       scalarValues.reserve(times.size());
+      scalarFirstDerivates.reserve(times.size());
+      scalarSecondDerivates.reserve(times.size());
       for (size_t t = 0; t < times.size(); ++t) {
         scalarValues.push_back(values.at(t)(i));
         scalarFirstDerivates.push_back(firstDerivatives.at(t)(i));
         scalarSecondDerivates.push_back(secondDerivatives.at(t)(i));
       }
-      // TODO Copy all derivates, right now only first and last are supported.
-      containers_.at(i).setData(times, scalarValues,
-                                *(scalarFirstDerivates.begin()), *(scalarSecondDerivates.begin()),
-                                *(scalarFirstDerivates.end() - 1), *(scalarSecondDerivates.end() - 1));
+      containers_.at(i).setDataWithDerivatives(times, scalarValues, scalarFirstDerivates,
+                                               scalarSecondDerivates, parallel);
     }
+    block_.setFromContainers(containers_);
   }
 
-
+  /// Builds the curve from spline options given per dimension, one block of
+  /// values.size()/N splines after the other (all splines of dimension 0 first).
   virtual void fitCurve(const std::vector<PolynomialSplineBase::SplineOpts>& values,
                         std::vector<Key>* outKeys = NULL)
   {
-    // TODO
-    throw std::runtime_error("PolynomialSplineVectorSpaceCurve::fitCurve is not yet implemented!");
+    CHECK_EQ(values.size() % N, 0) << "The number of spline options has to be a multiple of the dimension.";
+    const size_t numSplines = values.size() / N;
+    for (size_t i = 0; i < N; ++i) {
+      const std::vector<PolynomialSplineBase::SplineOpts> scalarValues(values.begin() + i*numSplines,
+                                                                       values.begin() + (i+1)*numSplines);
+      for (size_t k = 0; k < numSplines; ++k) {
+        CHECK_EQ(scalarValues[k].tf, values[k].tf) << "The spline durations have to agree in all dimensions.";
+      }
+      CHECK(containers_.at(i).setSplines(scalarValues)) << "Spline options with non-positive duration.";
+    }
+    block_.setFromContainers(containers_);
+    minTime_ = 0.0;
+    timeTransform_.reset();
+  }
+
+  /// Fits the curve to noisy samples instead of interpolating them, all dimensions share the knot
+  /// times and one decomposition (see PolynomialSplineSmoother). Returns false if the fit is ill-posed.
+  bool fitCurveSmoothing(const std::vector<Time>& knotTimes, const std::vector<Time>& sampleTimes,
+                         const std::vector<ValueType>& sampleValues, double roughnessWeight,
+                         const std::vector<double>& sampleWeights = std::vector<double>())
+  {
+    CHECK_EQ(sampleTimes.size(), sampleValues.size());
+    std::vector<std::vector<double> > scalarValues(N, std::vector<double>(sampleValues.size()));
+    for (size_t t = 0; t < sampleValues.size(); ++t) {
+      for (size_t i = 0; i < N; ++i) scalarValues[i][t] = sampleValues[t](i);
+    }
+
+    PolynomialSplineSmoother<SplineType::splineOrder> smoother;
+    if (!smoother.fit(knotTimes, sampleTimes, scalarValues, roughnessWeight, sampleWeights)) {
+      return false;
+    }
+    for (size_t i = 0; i < N; ++i) {
+      smoother.getContainer(containers_.at(i), i);
+    }
+    block_.setFromContainers(containers_);
+    minTime_ = knotTimes.front();
+    timeTransform_.reset();
+    return true;
+  }
+
+  /// Rescales the spline durations such that the velocity and acceleration bounds of every dimension
+  /// are met with minimal durations (see retimeSplineContainers). Returns false if the bounds could not be met.
+  /// The bounds refer to the transformed time (see transformTime).
+  bool retime(const DerivativeType& maxVelocity, const DerivativeType& maxAcceleration,
+              unsigned int maxIterations = 50)
+  {
+    std::vector<SplineContainerType*> containers;
+    for (auto& container : containers_) containers.push_back(&container);
+    const double scale = timeTransform_.scale;
+    const DerivativeType maxCurveVelocity = maxVelocity * scale;
+    const DerivativeType maxCurveAcceleration = maxAcceleration * (scale * scale);
+    const bool isWithinBounds = retimeSplineContainers(
+        containers, std::vector<double>(maxCurveVelocity.data(), maxCurveVelocity.data() + N),
+        std::vector<double>(maxCurveAcceleration.data(), maxCurveAcceleration.data() + N), maxIterations);
+    block_.setFromContainers(containers_);
+    return isWithinBounds;
   }
 
   virtual void clear()
@@ -149,6 +307,9 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
     for (size_t i = 0; i < N; ++i) {
       containers_.at(i).reset();
     }
+    block_.clear();
+    minTime_ = 0.0;
+    timeTransform_.reset();
   }
 
   virtual void transformCurve(const ValueType T)
@@ -157,11 +318,21 @@ class PolynomialSplineVectorSpaceCurve : public VectorSpaceCurve<N>
   }
 
  private:
-  std::vector<PolynomialSplineContainer> containers_;
+  /// Time relative to the start of the spline block.
+  Time getBlockTime(Time time) const
+  {
+    return timeTransform_.toCurveTime(time) - minTime_;
+  }
+
+  std::vector<SplineContainerType> containers_;
+  SplineBlockType block_;
   Time minTime_;
+  TimeAffineTransform timeTransform_;
 };
 
+typedef PolynomialSplineVectorSpaceCurve<PolynomialSplineCubic, 3> PolynomialSplineCubicVector3Curve;
 typedef PolynomialSplineVectorSpaceCurve<PolynomialSplineQuintic, 3> PolynomialSplineQuinticVector3Curve;
+typedef PolynomialSplineVectorSpaceCurve<PolynomialSplineSeptic, 3> PolynomialSplineSepticVector3Curve;
 
 } // namespace
 
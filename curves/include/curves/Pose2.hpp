@@ -0,0 +1,105 @@
+/*
+ * Pose2.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <cmath>
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+namespace curves {
+
+/// Planar rigid transformation T_a_b, takes points from Frame b to Frame a: p_a = R p_b + t.
+/// Replaces gtsam::Pose2 for the SE2 curves, with the accessors of the kindr transformations.
+class Pose2 {
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  typedef Eigen::Vector2d Position;
+  typedef Eigen::Rotation2Dd Rotation;
+
+  Pose2()
+      : position_(Position::Zero()),
+        rotation_(0.0) {
+  }
+
+  Pose2(const Position& position, const Rotation& rotation)
+      : position_(position),
+        rotation_(rotation) {
+  }
+
+  Pose2(double x, double y, double theta)
+      : position_(x, y),
+        rotation_(theta) {
+  }
+
+  const Position& getPosition() const {
+    return position_;
+  }
+
+  Position& getPosition() {
+    return position_;
+  }
+
+  const Rotation& getRotation() const {
+    return rotation_;
+  }
+
+  Rotation& getRotation() {
+    return rotation_;
+  }
+
+  double x() const {
+    return position_.x();
+  }
+
+  double y() const {
+    return position_.y();
+  }
+
+  /// Heading in (-pi, pi].
+  double theta() const {
+    return rotation_.smallestAngle();
+  }
+
+  Pose2 operator*(const Pose2& other) const {
+    return Pose2(position_ + rotation_ * other.position_, rotation_ * other.rotation_);
+  }
+
+  Pose2 inverted() const {
+    const Rotation inverse = rotation_.inverse();
+    return Pose2(-(inverse * position_), inverse);
+  }
+
+  Position transform(const Position& position) const {
+    return position_ + rotation_ * position;
+  }
+
+  /// Global difference (t - t_other, log(R R_other^-1)), such that other.boxPlus(boxMinus(other)) == *this.
+  Eigen::Vector3d boxMinus(const Pose2& other) const {
+    return Eigen::Vector3d(position_.x() - other.position_.x(), position_.y() - other.position_.y(),
+                           getAngleDifference(rotation_, other.rotation_));
+  }
+
+  Pose2 boxPlus(const Eigen::Vector3d& delta) const {
+    return Pose2(position_ + delta.head<2>(), Rotation(rotation_.angle() + delta(2)));
+  }
+
+  bool isNear(const Pose2& other, double tolerance) const {
+    return (position_ - other.position_).norm() <= tolerance
+        && std::abs(getAngleDifference(rotation_, other.rotation_)) <= tolerance;
+  }
+
+  /// Angle of R_a R_b^-1 in (-pi, pi].
+  static double getAngleDifference(const Rotation& a, const Rotation& b) {
+    return Rotation(a.angle() - b.angle()).smallestAngle();
+  }
+
+ private:
+  Position position_;
+  Rotation rotation_;
+};
+
+} // namespace curves
@@ -8,14 +8,16 @@
 #define SE2CONFIG_H_
 
 #include <Eigen/Core>
-#include "gtsam/geometry/Pose2.h"
+#include "curves/Pose2.hpp"
 
 namespace curves {
 
 typedef Eigen::Matrix<double, 3, 1> Vector3d;
 
+/// The derivatives are global twists (linear velocity (0,1) of the origin of Frame b and angular
+/// velocity (2)) and their time derivatives, expressed in Frame a.
 struct SE2Config {
-  typedef gtsam::Pose2 ValueType;
+  typedef Pose2 ValueType;
   typedef Vector3d DerivativeType;
 };
 
@@ -7,6 +7,9 @@
 #ifndef SE2_CURVE_H_
 #define SE2_CURVE_H_
 
+#include <string>
+#include <vector>
+
 #include "SE2Config.hpp"
 #include "Curve.hpp"
 
@@ -28,6 +31,21 @@ class SE2Curve : public Curve<SE2Config> {
   typedef Parent::ValueType ValueType;
   typedef Parent::DerivativeType DerivativeType;
 
+  /// Pose, twist and its time derivative at one time.
+  struct State {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    ValueType value;
+    DerivativeType velocity;
+    DerivativeType acceleration;
+  };
+
+  /// Pose, twist and its time derivative with a single segment lookup (cheaper than evaluate and
+  /// evaluateDerivative).
+  virtual bool evaluateState(State& state, Time time) const = 0;
+
+  /// Evaluate the curve at increasing times, with one sweep through the segments.
+  /// Returns false if a time is out of bounds.
+  virtual bool evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const = 0;
 };
 
 }  // namespace curves
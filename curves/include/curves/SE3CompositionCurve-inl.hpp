@@ -4,22 +4,19 @@
  * @author Renaud Dubé, Abel Gawel, Mike Bosse
  */
 
-// COMPOSITION_STRATEGY is used to select the strategy for composing the
-// correction curve with the base curve at the evaluation time t:
-// (1) corr(t) * base(t) is implemented
-// (2) corr is evaluated at the coefficient times (t1, t2) where the interpolation
-//     on base is computed resulting in
-//     interpolation(corr(t1) * base(t1), corr(t2) * base(t2), alpha)
-
-#define COMPOSITION_STRATEGY 1
+#include <algorithm>
+#include <iterator>
 
+#include "curves/CubicHermiteSE3Interpolation.hpp"
 #include "curves/SE3CompositionCurve.hpp"
 #include "curves/helpers.hpp"
 
 namespace curves{
 
 template <class C1, class C2>
-SE3CompositionCurve<C1, C2>::SE3CompositionCurve() {
+SE3CompositionCurve<C1, C2>::SE3CompositionCurve(CompositionStrategy compositionStrategy)
+    : compositionStrategy_(compositionStrategy),
+      isCorrectionHeld_(false) {
 
 }
 
@@ -45,7 +42,8 @@ void SE3CompositionCurve<C1, C2>::saveCurves(const std::string& filename) const
 
   std::vector<Eigen::VectorXd> baseCurveValues;
   for (size_t i = 0; i < baseCurveTimes.size(); ++i) {
-    ValueType val = baseCurve_.evaluate(baseCurveTimes[i]);
+    ValueType val;
+    baseCurve_.evaluate(val, baseCurveTimes[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     baseCurveValues.push_back(v);
@@ -55,7 +53,8 @@ void SE3CompositionCurve<C1, C2>::saveCurves(const std::string& filename) const
   correctionCurve_.manager_.getTimes(&correctionCurveTimes);
   std::vector<Eigen::VectorXd> correctionCurveValues;
   for (size_t i = 0; i < correctionCurveTimes.size(); ++i) {
-    ValueType val = correctionCurve_.evaluate(correctionCurveTimes[i]);
+    ValueType val;
+    correctionCurve_.evaluate(val, correctionCurveTimes[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     correctionCurveValues.push_back(v);
@@ -63,7 +62,8 @@ void SE3CompositionCurve<C1, C2>::saveCurves(const std::string& filename) const
 
   std::vector<Eigen::VectorXd> combinedCurveValues;
   for (size_t i = 0; i < baseCurveTimes.size(); ++i) {
-    ValueType val = this->evaluate(baseCurveTimes[i]);
+    ValueType val;
+    this->evaluate(val, baseCurveTimes[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     combinedCurveValues.push_back(v);
@@ -106,179 +106,437 @@ int SE3CompositionCurve<C1, C2>::correctionSize() const{
   return correctionCurve_.size();
 }
 
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::setCompositionStrategy(CompositionStrategy compositionStrategy) {
+  if (compositionStrategy != compositionStrategy_) {
+    compositionStrategy_ = compositionStrategy;
+    rebuildComposedKnots();
+  }
+}
+
+template <class C1, class C2>
+typename SE3CompositionCurve<C1, C2>::CompositionStrategy SE3CompositionCurve<C1, C2>::getCompositionStrategy() const{
+  return compositionStrategy_;
+}
+
+template <class C1, class C2>
+const C1& SE3CompositionCurve<C1, C2>::getBaseCurve() const{
+  return baseCurve_;
+}
+
+template <class C1, class C2>
+const C2& SE3CompositionCurve<C1, C2>::getCorrectionCurve() const{
+  return correctionCurve_;
+}
+
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setMinSamplingPeriod(const Time minSamplingPeriod) {
   baseCurve_.setMinSamplingPeriod(0);
   correctionCurve_.setMinSamplingPeriod(minSamplingPeriod);
+  correctionPolicy_.setMinSamplingPeriod(minSamplingPeriod);
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setSamplingRatio(const int ratio) {
   baseCurve_.setSamplingRatio(1);
   correctionCurve_.setSamplingRatio(ratio);
+  correctionPolicy_.setMinimumMeasurements(ratio);
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::extend(const std::vector<Time>& times,
                                          const std::vector<typename SE3CompositionCurve<C1, C2>::ValueType>& values,
                                          std::vector<Key>* outKeys) {
-  //todo: Treat case when times.size() != 1
-  CHECK_EQ(times.size(), 1) << "Extend was called with more than one time.";
-  CHECK_EQ(values.size(), 1) << "Extend was called with more than one value.";
+  CHECK_EQ(times.size(), values.size()) << "Extend was called with a different number of times and values.";
+  if (times.empty()) {
+    return;
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    CHECK_GT(times[i], times[i-1]) << "Extend times have to be increasing.";
+  }
 
   // Find the new limit times of the curve
-  Time newMaxTime, newMinTime;
+  Time newMinTime = times.front();
+  Time newMaxTime = times.back();
+  if (!baseCurve_.isEmpty()) {
+    newMinTime = std::min(newMinTime, baseCurve_.getMinTime());
+    newMaxTime = std::max(newMaxTime, baseCurve_.getMaxTime());
+  }
 
-  if (baseCurve_.isEmpty()) {
-    newMaxTime = 0;
-    newMinTime = 0;
-  } else {
-    newMaxTime = baseCurve_.getMaxTime();
-    newMinTime  = baseCurve_.getMinTime();
+  // Appending only changes the last coefficients of both curves, and the composed knots in their
+  // support.
+  const bool isAppending = !baseCurve_.isEmpty() && !correctionCurve_.isEmpty()
+      && times.front() > baseCurve_.getMaxTime() && correctionCurve_.getMinTime() <= newMinTime;
+  Time composedBegTime = newMinTime;
+  if (isAppending) {
+    Time baseBegTime, correctionBegTime, supportEndTime;
+    getCoefficientSupport(baseCurve_.manager_, baseCurve_.manager_.getMaxTime(), baseCurve_.manager_.getMaxTime(),
+                          &baseBegTime, &supportEndTime);
+    getCoefficientSupport(correctionCurve_.manager_, correctionCurve_.manager_.getMaxTime(),
+                          correctionCurve_.manager_.getMaxTime(), &correctionBegTime, &supportEndTime);
+    composedBegTime = std::min(baseBegTime, correctionBegTime);
   }
 
-  for (std::vector<Time>::const_iterator it = times.begin(); it != times.end(); ++it) {
-    if (newMaxTime < *it) {
-      newMaxTime = *it;
+  // Extend the correction curve to these times, constant beyond its limits. The coefficients are
+  // inserted directly such that the correction within its previous limits is unchanged. At the
+  // end, the correction sampling decides between adding a coefficient and moving the one which
+  // holds the correction constant.
+  typename CorrectionTraits::CoefficientManager& correctionManager = correctionCurve_.manager_;
+  ValueType correctionValue;
+  if (correctionCurve_.isEmpty()) {
+    const ValueType identity(ValueType::Position(0,0,0), ValueType::Rotation(1,0,0,0));
+    correctionManager.insertCoefficient(newMinTime, CorrectionTraits::fromValue(identity, DerivativeType()));
+    if (newMaxTime > newMinTime) {
+      correctionManager.insertCoefficient(newMaxTime, CorrectionTraits::fromValue(identity, DerivativeType()));
+      isCorrectionHeld_ = true;
+    }
+    correctionPolicy_.setLastExtendTime(newMaxTime);
+    CorrectionTraits::onKnotsChanged(&correctionCurve_, newMinTime);
+  } else {
+    if (correctionCurve_.getMaxTime() < newMaxTime) {
+      const Time correctionMaxTime = correctionCurve_.getMaxTime();
+      if (isCorrectionHeld_ && !sampleCorrection(newMaxTime)) {
+        typename CorrectionTraits::CoefficientManager::TimeToKeyCoefficientMap::iterator last =
+            --correctionManager.coefficientEnd();
+        correctionManager.modifyCoefficient(last, newMaxTime, last->second.coefficient);
+      } else {
+        CHECK(correctionCurve_.evaluate(correctionValue, correctionCurve_.getMaxTime()));
+        correctionManager.insertCoefficient(newMaxTime, CorrectionTraits::fromValue(correctionValue, DerivativeType()));
+        correctionPolicy_.setLastExtendTime(newMaxTime);
+        isCorrectionHeld_ = true;
+      }
+      CorrectionTraits::onKnotsChanged(&correctionCurve_, correctionMaxTime);
     }
-    if (newMinTime > *it) {
-      newMinTime = *it;
+    if (correctionCurve_.getMinTime() > newMinTime) {
+      CHECK(correctionCurve_.evaluate(correctionValue, correctionCurve_.getMinTime()));
+      correctionManager.insertCoefficient(newMinTime, CorrectionTraits::fromValue(correctionValue, DerivativeType()));
+      CorrectionTraits::onKnotsChanged(&correctionCurve_, newMinTime);
     }
   }
 
-  // Extend the correction curves to these times
-  std::vector<Time> correctionTimes;
-  std::vector<ValueType> correctionValues;
+  // Compute the base curve updates accounting for the corrections, in one sweep through the
+  // correction segments.
+  typename CorrectionTraits::CoefficientManager::CoefficientIter a = correctionManager.coefficientBegin();
+  typename CorrectionTraits::CoefficientManager::CoefficientIter b = a;
+  if (correctionManager.size() > 1) {
+    CHECK(correctionManager.getCoefficientsAt(times.front(), &a, &b));
+  }
+  std::vector<ValueType> newValues;
+  newValues.reserve(values.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    while (b->first < times[i] && std::next(b) != correctionManager.coefficientEnd()) {
+      a = b;
+      ++b;
+    }
+    CHECK(CorrectionTraits::interpolate(correctionCurve_, a, b, times[i], correctionValue));
+    newValues.push_back(correctionValue.inverted() * values[i]);
+  }
+  baseCurve_.extend(times, newValues, outKeys);
+  if (isAppending) {
+    rebuildComposedKnots(composedBegTime, newMaxTime);
+  } else {
+    rebuildComposedKnots();
+  }
+}
 
-  if (correctionCurve_.isEmpty()) {
-    correctionTimes.push_back(newMinTime);
-    correctionValues.push_back(ValueType(ValueType::Position(0,0,0), ValueType::Rotation(1,0,0,0)));
-    correctionCurve_.extend(correctionTimes, correctionValues);
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::foldInCorrections() {
+  if (!correctionCurve_.isEmpty()) {
+    foldInCorrections(correctionCurve_.getMinTime(), correctionCurve_.getMaxTime());
   }
+}
 
-  if (correctionCurve_.getMaxTime() < newMaxTime) {
-    correctionTimes.push_back(newMaxTime);
-    correctionValues.push_back(correctionCurve_.evaluate(correctionCurve_.getMaxTime()));
-    correctionCurve_.extend(correctionTimes, correctionValues);
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::foldInCorrections(Time begTime, Time endTime) {
+  CHECK_LE(begTime, endTime);
+  if (baseCurve_.isEmpty() || correctionCurve_.isEmpty()) {
+    return;
   }
 
-  if (correctionCurve_.getMinTime() > newMinTime) {
-    correctionTimes.push_back(newMinTime);
-    correctionValues.push_back(correctionCurve_.evaluate(correctionCurve_.getMinTime()));
-    correctionCurve_.extend(correctionTimes, correctionValues);
+  // Correction coefficients which are reset to identity.
+  std::vector<Time> correctionTimes;
+  correctionCurve_.manager_.getTimesInWindow(&correctionTimes, begTime, endTime);
+  if (correctionTimes.empty()) {
+    return;
   }
 
-  //Compute the base curve updates accounting for the corrections
-  std::vector<ValueType> newValues;
-  std::vector<ValueType>::const_iterator itValues = values.begin();
-  for (std::vector<Time>::const_iterator it = times.begin(); it != times.end(); ++it) {
-    newValues.push_back(correctionCurve_.evaluate(*it).inverted() * (*itValues));
-    ++itValues;
+  // Resetting them changes the correction up to the neighboring coefficients, the base
+  // coefficients in between absorb the change such that the composition stays the same at them.
+  Time supportBegTime, supportEndTime;
+  getCoefficientSupport(correctionCurve_.manager_, correctionTimes.front(), correctionTimes.back(),
+                        &supportBegTime, &supportEndTime);
+  std::vector<Time> baseTimes;
+  baseCurve_.manager_.getTimesInWindow(&baseTimes, supportBegTime, supportEndTime);
+
+  std::vector<ValueType> composedValues(baseTimes.size());
+  std::vector<DerivativeType> composedDerivatives(baseTimes.size());
+  for (size_t i = 0; i < baseTimes.size(); ++i) {
+    CHECK(composeAtTime(composedValues[i], &composedDerivatives[i], baseTimes[i]));
   }
-  baseCurve_.extend(times, newValues, outKeys);
-}
 
-template <class C1, class C2>
-void SE3CompositionCurve<C1, C2>::foldInCorrections() {
-  std::cout << "foldincorrections" << std::endl;
-  std::vector<Time> times;
-  std::vector<ValueType> newValues;
-  baseCurve_.manager_.getTimes(&times);
-  for (std::vector<Time>::const_iterator it = times.begin(); it != times.end(); ++it) {
-    newValues.push_back(this->evaluate(*it));
+  const std::vector<typename CorrectionTraits::Coefficient> identities(
+      correctionTimes.size(),
+      CorrectionTraits::fromValue(ValueType(ValueType::Position(0,0,0), ValueType::Rotation(1,0,0,0)), DerivativeType()));
+  releaseCorrectionHold(correctionTimes.back());
+  correctionCurve_.manager_.modifyCoefficientsValuesInBatch(correctionTimes, identities);
+
+  // base = corr^-1 * composed, the twist follows from inverting the product rule (see composeAtTime):
+  // w_base = R_corr^T (w - w_corr), v_base = R_corr^T (v - v_corr - w_corr x (p - p_corr))
+  std::vector<typename BaseTraits::Coefficient> baseCoefficients;
+  baseCoefficients.reserve(baseTimes.size());
+  ValueType correction;
+  DerivativeType correctionDerivative;
+  for (size_t i = 0; i < baseTimes.size(); ++i) {
+    CHECK(StaticCurveTraits<C2>::evaluate(correctionCurve_, correction, baseTimes[i]));
+    CHECK(StaticCurveTraits<C2>::evaluateDerivative(correctionCurve_, correctionDerivative, baseTimes[i], 1));
+    const Eigen::Vector3d& correctionAngularVelocity = correctionDerivative.getRotationalVelocity().vector();
+    const Eigen::Vector3d relativePosition = composedValues[i].getPosition().vector() - correction.getPosition().vector();
+    const Eigen::Vector3d linearVelocity = correction.getRotation().inverseRotate(
+        composedDerivatives[i].getTranslationalVelocity().vector() - correctionDerivative.getTranslationalVelocity().vector()
+        - correctionAngularVelocity.cross(relativePosition));
+    const Eigen::Vector3d angularVelocity = correction.getRotation().inverseRotate(
+        composedDerivatives[i].getRotationalVelocity().vector() - correctionAngularVelocity);
+    baseCoefficients.push_back(BaseTraits::fromValue(correction.inverted() * composedValues[i],
+                                                     DerivativeType(linearVelocity, angularVelocity)));
   }
-  baseCurve_.clear();
-  baseCurve_.extend(times,newValues);
-  times.clear();
-  newValues.clear();
-  correctionCurve_.manager_.getTimes(&times);
-  for (std::vector<Time>::const_iterator it = times.begin(); it != times.end(); ++it) {
-    newValues.push_back(ValueType(ValueType::Position(0,0,0), ValueType::Rotation(1,0,0,0)));
+  baseCurve_.manager_.modifyCoefficientsValuesInBatch(baseTimes, baseCoefficients);
+
+  updateComposedKnots(correctionCurve_.manager_, correctionTimes.front(), correctionTimes.back());
+  if (!baseTimes.empty()) {
+    updateComposedKnots(baseCurve_.manager_, baseTimes.front(), baseTimes.back());
   }
-  correctionCurve_.clear();
-  correctionCurve_.extend(times,newValues);
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::fitCurve(const std::vector<Time>& times,
                                            const std::vector<typename SE3CompositionCurve<C1, C2>::ValueType>& values,
                                            std::vector<Key>* outKeys){
-  extend(times, values, outKeys);
+  clear();
+  if (times.empty()) {
+    return;
+  }
+  baseCurve_.fitCurve(times, values, outKeys);
+  std::vector<Time> correctionTimes;
+  correctionTimes.push_back(baseCurve_.getMinTime());
+  if (baseCurve_.getMaxTime() > baseCurve_.getMinTime()) {
+    correctionTimes.push_back(baseCurve_.getMaxTime());
+  }
+  resetCorrectionCurve(correctionTimes);
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setCorrectionTimes(const std::vector<Time>& times) {
   // Evaluate the correction curve at these times
-  std::vector<ValueType> values;
+  std::vector<ValueType> values(times.size());
   for (size_t i = 0; i < times.size(); ++i) {
-    values.push_back(correctionCurve_.evaluate(times[i]));
+    CHECK(correctionCurve_.evaluate(values[i], times[i]));
   }
 
   // Redefine the correction curve
+  isCorrectionHeld_ = false;
   correctionCurve_.clear();
   correctionCurve_.extend(times, values);
+  rebuildComposedKnots();
 
   CHECK_EQ(correctionCurve_.getMinTime(), baseCurve_.getMinTime()) << "Min time of correction curve and base curve are different";
   CHECK_EQ(correctionCurve_.getMaxTime(), baseCurve_.getMaxTime()) << "Min time of correction curve and base curve are different";
 }
 
 template <class C1, class C2>
-typename SE3CompositionCurve<C1, C2>::ValueType SE3CompositionCurve<C1, C2>::evaluate(Time time) const{
+bool SE3CompositionCurve<C1, C2>::evaluate(ValueType& value, Time time) const{
 
-#if COMPOSITION_STRATEGY == 1
-  // (1) corr(t) * base(t) is implemented
-  return correctionCurve_.evaluate(time) * baseCurve_.evaluate(time);
-#elif COMPOSITION_STRATEGY == 2
-  // (2) corr is evaluated at the coefficient times (t1, t2) where the interpolation
-  //     on base is computed resulting in
-  //     interpolation(corr(t1) * base(t1), corr(t2) * base(t2), alpha)
-  if (time == 0) {
-    return correctionCurve_.evaluate(time) * baseCurve_.evaluate(time);
+  if (!usesComposedKnots()) {
+    return composeAtTime(value, NULL, time);
   }
 
-  typename C2::CoefficientIter it1, it2;
-  baseCurve_.manager_.getCoefficientsAt(time, &it1, &it2);
-  //todo Is it true that the value of a curve at a time where a coefficient
-  // is defined is always only dependent on this coefficient?
-  if(it1->first == time || it2->first == time) {
-    return correctionCurve_.evaluate(time) * baseCurve_.evaluate(time);
-  } else {
-    Time tA, tB;
-    ValueType A, B, dA, dB, T_W_A, T_W_B;
-    //if the iterators returned are in order ( last element bug)
-    if (it1->first < it2->first) {
-      tA = it1->first;
-      tB = it2->first;
-    } else {
-      tA = it2->first;
-      tB = it1->first;
+  // Interpolated from the composed knots
+  size_t index;
+  if (!getComposedSegment(time, &index)) {
+    return false;
+  }
+  if (composedTimes_.size() == 1) {
+    value = composedKnots_[0].value;
+    return true;
+  }
+  const ComposedKnot& a = composedKnots_[index];
+  const ComposedKnot& b = composedKnots_[index + 1];
+  const double dt = composedTimes_[index + 1] - composedTimes_[index];
+  interpolateCubicHermiteSE3(value, a.value, a.derivative, b.value, b.derivative, dt,
+                             (time - composedTimes_[index]) / dt);
+  return true;
+}
+
+template <class C1, class C2>
+bool SE3CompositionCurve<C1, C2>::evaluateDerivative(DerivativeType& derivative, Time time,
+                                                     unsigned derivativeOrder) const{
+  if (derivativeOrder != 1) {
+    return false;
+  }
+  if (!usesComposedKnots()) {
+    ValueType value;
+    return composeAtTime(value, &derivative, time);
+  }
+
+  size_t index;
+  if (!getComposedSegment(time, &index)) {
+    return false;
+  }
+  if (composedTimes_.size() == 1) {
+    derivative = composedKnots_[0].derivative;
+    return true;
+  }
+  const ComposedKnot& a = composedKnots_[index];
+  const ComposedKnot& b = composedKnots_[index + 1];
+  const double dt = composedTimes_[index + 1] - composedTimes_[index];
+  interpolateCubicHermiteSE3Derivative(derivative, a.value, a.derivative, b.value, b.derivative, dt,
+                                       (time - composedTimes_[index]) / dt);
+  return true;
+}
+
+template <class C1, class C2>
+bool SE3CompositionCurve<C1, C2>::composeAtTime(ValueType& value, DerivativeType* derivative, Time time) const {
+  ValueType base, correction;
+  if (!StaticCurveTraits<C1>::evaluate(baseCurve_, base, time)
+      || !StaticCurveTraits<C2>::evaluate(correctionCurve_, correction, time)) {
+    return false;
+  }
+  value = correction * base;
+
+  if (derivative != NULL) {
+    DerivativeType baseDerivative, correctionDerivative;
+    if (!StaticCurveTraits<C1>::evaluateDerivative(baseCurve_, baseDerivative, time, 1)
+        || !StaticCurveTraits<C2>::evaluateDerivative(correctionCurve_, correctionDerivative, time, 1)) {
+      return false;
     }
+    // Product rule for the global twist of corr * base:
+    // v = v_corr + w_corr x (R_corr p_base) + R_corr v_base, w = w_corr + R_corr w_base
+    const Eigen::Vector3d& correctionAngularVelocity = correctionDerivative.getRotationalVelocity().vector();
+    const Eigen::Vector3d rotatedBasePosition = correction.getRotation().rotate(base.getPosition().vector());
+    const Eigen::Vector3d linearVelocity = correctionDerivative.getTranslationalVelocity().vector()
+        + correctionAngularVelocity.cross(rotatedBasePosition)
+        + correction.getRotation().rotate(baseDerivative.getTranslationalVelocity().vector());
+    const Eigen::Vector3d angularVelocity = correctionAngularVelocity
+        + correction.getRotation().rotate(baseDerivative.getRotationalVelocity().vector());
+    *derivative = DerivativeType(linearVelocity, angularVelocity);
+  }
+  return true;
+}
+
+template <class C1, class C2>
+bool SE3CompositionCurve<C1, C2>::usesComposedKnots() const {
+  return kIsC1Composition && compositionStrategy_ == kInterpolateComposedKnots;
+}
+
+template <class C1, class C2>
+bool SE3CompositionCurve<C1, C2>::getComposedSegment(Time time, size_t* index) const {
+  if (composedTimes_.empty() || time < composedTimes_.front() || time > composedTimes_.back()) {
+    return false;
+  }
+  if (composedTimes_.size() == 1) {
+    *index = 0;
+    return composedKnots_[0].isValid;
+  }
+  const size_t upper = std::upper_bound(composedTimes_.begin(), composedTimes_.end(), time) - composedTimes_.begin();
+  *index = std::min(upper - 1, composedTimes_.size() - 2);
+  return composedKnots_[*index].isValid && composedKnots_[*index + 1].isValid;
+}
+
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::rebuildComposedKnots() {
+  composedTimes_.clear();
+  composedKnots_.clear();
+  if (!baseCurve_.isEmpty()) {
+    rebuildComposedKnots(baseCurve_.getMinTime(), baseCurve_.getMaxTime());
+  }
+}
 
-    double alpha = double(time - tA)/double(tB - tA);
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::rebuildComposedKnots(Time begTime, Time endTime) {
+  if (!usesComposedKnots() || baseCurve_.isEmpty() || correctionCurve_.isEmpty()) {
+    composedTimes_.clear();
+    composedKnots_.clear();
+    return;
+  }
+  begTime = std::max(begTime, baseCurve_.getMinTime());
+  endTime = std::min(endTime, baseCurve_.getMaxTime());
+  if (begTime > endTime) {
+    return;
+  }
 
-    A = baseCurve_.evaluate(tA);
-    B = baseCurve_.evaluate(tB);
-    dA = correctionCurve_.evaluate(tA);
-    dB = correctionCurve_.evaluate(tB);
+  // Union of the knot times of both curves in the window.
+  std::vector<Time> baseTimes, correctionTimes, windowTimes;
+  baseCurve_.manager_.getTimesInWindow(&baseTimes, begTime, endTime);
+  correctionCurve_.manager_.getTimesInWindow(&correctionTimes, begTime, endTime);
+  windowTimes.reserve(baseTimes.size() + correctionTimes.size());
+  std::set_union(baseTimes.begin(), baseTimes.end(), correctionTimes.begin(), correctionTimes.end(),
+                 std::back_inserter(windowTimes));
+  std::vector<ComposedKnot, Eigen::aligned_allocator<ComposedKnot> > windowKnots(windowTimes.size());
+  for (size_t i = 0; i < windowTimes.size(); ++i) {
+    ComposedKnot& knot = windowKnots[i];
+    knot.isValid = composeAtTime(knot.value, &knot.derivative, windowTimes[i]);
+  }
 
-    T_W_A = dA * A;
-    T_W_B = dB * B;
+  const size_t begIndex = std::lower_bound(composedTimes_.begin(), composedTimes_.end(), begTime) - composedTimes_.begin();
+  const size_t endIndex = std::upper_bound(composedTimes_.begin(), composedTimes_.end(), endTime) - composedTimes_.begin();
+  composedTimes_.erase(composedTimes_.begin() + begIndex, composedTimes_.begin() + endIndex);
+  composedTimes_.insert(composedTimes_.begin() + begIndex, windowTimes.begin(), windowTimes.end());
+  composedKnots_.erase(composedKnots_.begin() + begIndex, composedKnots_.begin() + endIndex);
+  composedKnots_.insert(composedKnots_.begin() + begIndex, windowKnots.begin(), windowKnots.end());
+}
 
-    //Implementation of T_W_I = T_W_A*exp(alpha*log(inv(T_W_A)*T_W_B))
-    using namespace kindr::minimal;
-    ValueType T_A_B = invertAndComposeImplementation(T_W_A, T_W_B, boost::none, boost::none);
-    gtsam::Vector6 log_T_A_B = transformationLogImplementation(T_A_B, boost::none);
-    gtsam::Vector6 log_T_A_I = vectorScalingImplementation<int(6)>(log_T_A_B, alpha, boost::none, boost::none);
-    ValueType T_A_I = transformationExpImplementation(log_T_A_I, boost::none);
-    return composeImplementation(T_W_A, T_A_I, boost::none, boost::none);
+template <class C1, class C2>
+template <class Manager>
+void SE3CompositionCurve<C1, C2>::updateComposedKnots(const Manager& manager, Time begTime, Time endTime) {
+  if (composedTimes_.empty()) {
+    return;
+  }
+  getCoefficientSupport(manager, begTime, endTime, &begTime, &endTime);
+  const size_t begIndex = std::lower_bound(composedTimes_.begin(), composedTimes_.end(), begTime) - composedTimes_.begin();
+  const size_t endIndex = std::upper_bound(composedTimes_.begin(), composedTimes_.end(), endTime) - composedTimes_.begin();
+  for (size_t i = begIndex; i < endIndex; ++i) {
+    ComposedKnot& knot = composedKnots_[i];
+    knot.isValid = composeAtTime(knot.value, &knot.derivative, composedTimes_[i]);
   }
-#endif
 }
 
 template <class C1, class C2>
-typename SE3CompositionCurve<C1, C2>::DerivativeType SE3CompositionCurve<C1, C2>::evaluateDerivative(Time time,
-                                                                                                     unsigned derivativeOrder) const{
-  //todo
+bool SE3CompositionCurve<C1, C2>::sampleCorrection(Time time) {
+  // Like the sampling policies of the curves: the first of every ratio extends samples.
+  const bool isSampled = correctionPolicy_.getMeasurementsSinceLastExtend() == 0
+      && time - correctionPolicy_.getLastExtendTime() >= correctionPolicy_.getMinSamplingPeriod();
+  correctionPolicy_.incrementMeasurementsTaken(1);
+  if (correctionPolicy_.getMeasurementsSinceLastExtend() >= correctionPolicy_.getMinimumMeasurements()) {
+    correctionPolicy_.setMeasurementsSinceLastExtend_(0);
+  }
+  return isSampled;
+}
+
+template <class C1, class C2>
+void SE3CompositionCurve<C1, C2>::releaseCorrectionHold(Time time) {
+  const typename CorrectionTraits::CoefficientManager& correctionManager = correctionCurve_.manager_;
+  if (isCorrectionHeld_ && correctionManager.size() > 1) {
+    typename CorrectionTraits::CoefficientManager::CoefficientIter beforeLast = correctionManager.coefficientEnd();
+    std::advance(beforeLast, -2);
+    isCorrectionHeld_ = time < beforeLast->first;
+  }
+}
+
+template <class C1, class C2>
+template <class Manager>
+void SE3CompositionCurve<C1, C2>::getCoefficientSupport(const Manager& manager, Time begTime, Time endTime,
+                                                        Time* supportBegTime, Time* supportEndTime) {
+  *supportBegTime = begTime;
+  *supportEndTime = endTime;
+  typename Manager::CoefficientIter it0, it1;
+  if (manager.getCoefficientsAt(begTime, &it0, &it1)) {
+    if (it0->first == begTime && it0 != manager.coefficientBegin()) {
+      --it0;
+    }
+    *supportBegTime = it0->first;
+  }
+  if (manager.getCoefficientsAt(endTime, &it0, &it1)) {
+    *supportEndTime = it1->first;
+  }
 }
 
 template <class C1, class C2>
@@ -348,19 +606,33 @@ Vector6d SE3CompositionCurve<C1, C2>::evaluateDerivativeB(unsigned derivativeOrd
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::clear(){
+  isCorrectionHeld_ = false;
+  correctionPolicy_.setMeasurementsSinceLastExtend_(0);
   baseCurve_.clear();
   correctionCurve_.clear();
+  rebuildComposedKnots();
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::removeCorrectionCoefficientAtTime(Time time) {
   CHECK(correctionCurve_.manager_.hasCoefficientAtTime(time));
+  releaseCorrectionHold(time);
+  Time supportBegTime, supportEndTime;
+  getCoefficientSupport(correctionCurve_.manager_, time, time, &supportBegTime, &supportEndTime);
   correctionCurve_.manager_.removeCoefficientAtTime(time);
+  CorrectionTraits::onKnotsChanged(&correctionCurve_, time);
+  rebuildComposedKnots(supportBegTime, supportEndTime);
 }
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setCorrectionCoefficientAtTime(Time time, ValueType value) {
   CHECK(correctionCurve_.manager_.hasCoefficientAtTime(time));
-  correctionCurve_.manager_.insertCoefficient(time, value);
+  typename CorrectionTraits::CoefficientManager::CoefficientIter it0, it1;
+  CHECK(correctionCurve_.manager_.getCoefficientsAt(time, &it0, &it1));
+  const DerivativeType derivative = CorrectionTraits::getDerivative(
+      it0->first == time ? it0->second.coefficient : it1->second.coefficient);
+  releaseCorrectionHold(time);
+  correctionCurve_.manager_.insertCoefficient(time, CorrectionTraits::fromValue(value, derivative));
+  updateComposedKnots(correctionCurve_.manager_, time, time);
 }
 
 template <class C1, class C2>
@@ -368,6 +640,7 @@ void SE3CompositionCurve<C1, C2>::transformCurve(const ValueType T) {
   // Apply the transformation on the left side
   // todo here we assume that the correctionCurve is identity.
   baseCurve_.transformCurve(T);
+  rebuildComposedKnots();
 }
 
 template <class C1, class C2>
@@ -378,7 +651,9 @@ void SE3CompositionCurve<C1, C2>::resetCorrectionCurve(const std::vector<Time>&
   }
 
   // Redefine the correction curve
+  isCorrectionHeld_ = false;
   correctionCurve_.fitCurve(times, values);
+  rebuildComposedKnots();
 
   CHECK_EQ(correctionCurve_.getMinTime(), baseCurve_.getMinTime()) << "Min time of correction curve and base curve are different";
   CHECK_EQ(correctionCurve_.getMaxTime(), baseCurve_.getMaxTime()) << "Min time of correction curve and base curve are different";
@@ -387,20 +662,53 @@ void SE3CompositionCurve<C1, C2>::resetCorrectionCurve(const std::vector<Time>&
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setBaseCurve(const std::vector<Time>& times, const std::vector<ValueType>& values) {
   baseCurve_.fitCurve(times, values);
+  rebuildComposedKnots();
   CHECK_EQ(correctionCurve_.getMinTime(), baseCurve_.getMinTime()) << "Min time of correction curve and base curve are different";
   CHECK_EQ(correctionCurve_.getMaxTime(), baseCurve_.getMaxTime()) << "Min time of correction curve and base curve are different";
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::setBaseCurvePart(const std::vector<Time>& times, const std::vector<ValueType>& values) {
-  baseCurve_.setCurve(times, values);
+  CHECK_EQ(times.size(), values.size());
+  // Coefficients keep their derivatives, new ones take the derivative of the curve.
+  typename BaseTraits::CoefficientManager::CoefficientIter it0, it1;
+  for (size_t i = 0; i < times.size(); ++i) {
+    DerivativeType derivative;
+    if (baseCurve_.manager_.getCoefficientsAt(times[i], &it0, &it1)
+        && (it0->first == times[i] || it1->first == times[i])) {
+      derivative = BaseTraits::getDerivative(it0->first == times[i] ? it0->second.coefficient : it1->second.coefficient);
+    } else if (!baseCurve_.evaluateDerivative(derivative, times[i], 1)) {
+      derivative.setZero();
+    }
+    baseCurve_.manager_.insertCoefficient(times[i], BaseTraits::fromValue(values[i], derivative));
+    BaseTraits::onKnotsChanged(&baseCurve_, times[i]);
+  }
+  rebuildComposedKnots();
   CHECK_EQ(correctionCurve_.getMinTime(), baseCurve_.getMinTime()) << "Min time of correction curve and base curve are different";
   CHECK_EQ(correctionCurve_.getMaxTime(), baseCurve_.getMaxTime()) << "Min time of correction curve and base curve are different";
 }
 
 template <class C1, class C2>
 void SE3CompositionCurve<C1, C2>::modifyBaseCoefficientsValuesInBatch(const std::vector<Time>& times, const std::vector<ValueType>& values) {
-  baseCurve_.manager_.modifyCoefficientsValuesInBatch(times, values);
+  CHECK_EQ(times.size(), values.size());
+  if (times.empty()) {
+    return;
+  }
+  // The coefficients keep their derivatives.
+  std::vector<typename BaseTraits::Coefficient> coefficients;
+  coefficients.reserve(times.size());
+  typename BaseTraits::CoefficientManager::CoefficientIter it, it1;
+  CHECK(baseCurve_.manager_.getCoefficientsAt(times.front(), &it, &it1));
+  if (it->first != times.front()) {
+    it = it1;
+  }
+  for (size_t i = 0; i < times.size(); ++i, ++it) {
+    CHECK(it != baseCurve_.manager_.coefficientEnd());
+    CHECK_EQ(it->first, times[i]);
+    coefficients.push_back(BaseTraits::fromValue(values[i], BaseTraits::getDerivative(it->second.coefficient)));
+  }
+  baseCurve_.manager_.modifyCoefficientsValuesInBatch(times, coefficients);
+  updateComposedKnots(baseCurve_.manager_, times.front(), times.back());
   CHECK_EQ(correctionCurve_.getMinTime(), baseCurve_.getMinTime()) << "Min time of correction curve and base curve are different";
   CHECK_EQ(correctionCurve_.getMaxTime(), baseCurve_.getMaxTime()) << "Min time of correction curve and base curve are different";
 }
@@ -420,7 +728,7 @@ void SE3CompositionCurve<C1, C2>::saveCurveAtTimes(const std::string& filename,
   std::vector<Eigen::VectorXd> curveValues;
   ValueType val;
   for (size_t i = 0; i < times.size(); ++i) {
-    val = evaluate(times[i]);
+    evaluate(val, times[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     curveValues.push_back(v);
@@ -444,7 +752,7 @@ void SE3CompositionCurve<C1, C2>::saveCorrectionCurveAtTimes(const std::string&
   std::vector<Eigen::VectorXd> curveValues;
   ValueType val;
   for (size_t i = 0; i < times.size(); ++i) {
-    val = correctionCurve_.evaluate(times[i]);
+    correctionCurve_.evaluate(val, times[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     curveValues.push_back(v);
@@ -4,29 +4,143 @@
  * @author Renaud Dubé, Abel Gawel, Mike Bosse
  */
 
+#include <vector>
+#include <Eigen/StdVector>
+
+#include "curves/LocalSupport2CoefficientManager.hpp"
 #include "curves/SE3Curve.hpp"
+#include "curves/SamplingPolicy.hpp"
+#include "curves/StaticCurve.hpp"
 
 #pragma once
 
 namespace curves {
 
+// Conversion between the values of an SE3 curve and the coefficients of its manager, used by
+// SE3CompositionCurve to modify the coefficients of its curves. The default suits curves whose
+// coefficients are their values (e.g. SlerpSE3Curve), curves which store more per knot specialize it.
+template <class C>
+struct SE3CompositionCoefficientTraits {
+  typedef typename C::Coefficient Coefficient;
+  typedef LocalSupport2CoefficientManager<Coefficient> CoefficientManager;
+
+  /// Whether the curve is continuously differentiable at its knots, only then the composition
+  /// can be interpolated from the composed poses and twists at the knots.
+  static const bool kIsC1 = false;
+
+  static Coefficient fromValue(const SE3Curve::ValueType& value, const SE3Curve::DerivativeType& derivative) {
+    return value;
+  }
+
+  static SE3Curve::DerivativeType getDerivative(const Coefficient& coefficient) {
+    return SE3Curve::DerivativeType();
+  }
+
+  /// Value of the curve at a time between the coefficients a and b of its manager, a == b if
+  /// the curve has a single coefficient. Specializations interpolate without searching the segment.
+  static bool interpolate(const C& curve, typename CoefficientManager::CoefficientIter a,
+                          typename CoefficientManager::CoefficientIter b, Time time,
+                          SE3Curve::ValueType& value) {
+    return StaticCurveTraits<C>::evaluate(curve, value, time);
+  }
+
+  /// Called after SE3CompositionCurve added, removed or moved coefficients at or after begTime in
+  /// the manager of the curve, for curves which index their knots (e.g. DiscreteSE3Curve).
+  static void onKnotsChanged(C* curve, Time begTime) {}
+};
+
 // SE3CompositionCurve is a curve composed of a base and a correction curve.
 // The corrections can be sampled at a lower frequency than the base curve,
 // therefore reducing the optimization state space. The corrections are applied
 // on the left side.
+//
+// The composition at an evaluation time t is selected per curve with CompositionStrategy:
+// (1) kComposeCurves (default) evaluates corr(t) * base(t), which is exact but costs two curve
+//     evaluations.
+// (2) kInterpolateComposedKnots materializes the composition as a cubic Hermite curve
+//     through the composed poses and twists at the knots of both curves. An evaluation then costs
+//     one search in the sorted knot times. The composed knots are computed by the functions
+//     modifying the curve, only the ones in the support of modified, added or removed coefficients
+//     (e.g. the end of the curve for extend). Operations moving all knots of a curve recompute
+//     all of them. The composed curve matches corr(t) * base(t) at the knots; in between, it
+//     deviates by the fourth order of the knot spacing for smooth curves. This needs both curves
+//     to be C1 (SE3CompositionCoefficientTraits::kIsC1), other curves (e.g. SlerpSE3Curve) have
+//     kinks at their knots that the interpolation would smooth out and are composed as with (1).
+// Evaluation does not modify the composition, it can run concurrently if the evaluation of both
+// curves can.
 
 template <class C1, class C2>
 class SE3CompositionCurve : public SE3Curve {
 
  private:
+  typedef SE3CompositionCoefficientTraits<C1> BaseTraits;
+  typedef SE3CompositionCoefficientTraits<C2> CorrectionTraits;
+
+  /// Composed pose and twist at a knot of the base or of the correction curve.
+  struct ComposedKnot {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    SE3Curve::ValueType value;
+    SE3Curve::DerivativeType derivative;
+    bool isValid;
+
+    ComposedKnot() : isValid(false) {}
+  };
+
+  /// The composition of curves with kinks at their knots is not interpolated.
+  static const bool kIsC1Composition = BaseTraits::kIsC1 && CorrectionTraits::kIsC1;
+
   C1 baseCurve_;
   C2 correctionCurve_;
 
+  /// Union of the knot times of both curves within the base curve, empty unless the composed
+  /// knots are used.
+  std::vector<Time> composedTimes_;
+  std::vector<ComposedKnot, Eigen::aligned_allocator<ComposedKnot> > composedKnots_;
+
+  /// corr(t) * base(t) and optionally its twist, from evaluating both curves.
+  bool composeAtTime(SE3Curve::ValueType& value, SE3Curve::DerivativeType* derivative, Time time) const;
+
+  bool usesComposedKnots() const;
+
+  /// Index of the composed segment that contains the time.
+  bool getComposedSegment(Time time, size_t* index) const;
+
+  /// Recomputes the knot times and all composed knots, e.g. after the knots of a curve changed.
+  void rebuildComposedKnots();
+
+  /// Replaces the composed knots in [begTime, endTime], after the knots of the curves changed only
+  /// within this window.
+  void rebuildComposedKnots(Time begTime, Time endTime);
+
+  /// Recomputes the composed knots that depend on the coefficients of a curve in [begTime, endTime],
+  /// i.e. the ones up to the neighboring coefficients (local support 2). The knot times of the
+  /// curve have to be unchanged.
+  template <class Manager>
+  void updateComposedKnots(const Manager& manager, Time begTime, Time endTime);
+
+  /// Whether extend adds a correction coefficient at the time, see setSamplingRatio and
+  /// setMinSamplingPeriod.
+  bool sampleCorrection(Time time);
+
+  /// Clears isCorrectionHeld_ if the correction coefficients from the time on are modified.
+  void releaseCorrectionHold(Time time);
+
+  /// Time window in which a curve depends on its coefficients in [begTime, endTime].
+  template <class Manager>
+  static void getCoefficientSupport(const Manager& manager, Time begTime, Time endTime,
+                                    Time* supportBegTime, Time* supportEndTime);
+
  public:
   typedef SE3Curve::ValueType ValueType;
   typedef SE3Curve::DerivativeType DerivativeType;
 
-  SE3CompositionCurve();
+  /// Strategy for composing the correction curve with the base curve at the evaluation time.
+  enum CompositionStrategy {
+    kComposeCurves = 1,
+    kInterpolateComposedKnots = 2
+  };
+
+  SE3CompositionCurve(CompositionStrategy compositionStrategy = kComposeCurves);
   ~SE3CompositionCurve();
 
     /// \brief Print the value of the base and corrections curves coefficients
@@ -53,8 +167,20 @@ class SE3CompositionCurve : public SE3Curve {
     /// \brief Returns the number of coefficients in the correction curve
     int correctionSize() const;
 
+    void setCompositionStrategy(CompositionStrategy compositionStrategy);
+
+    CompositionStrategy getCompositionStrategy() const;
+
+    const C1& getBaseCurve() const;
+
+    const C2& getCorrectionCurve() const;
+
     /// \brief Extend the curve so that it can be evaluated at these times by
     ///        using a default correction sampling policy.
+    ///        The times have to be increasing. The correction curve is extended once, held constant
+    ///        beyond its previous limits, and the base curve is extended with all values in one call.
+    ///        At the end, the correction coefficients are sampled with setSamplingRatio and
+    ///        setMinSamplingPeriod, in between the coefficient holding the correction is moved.
     virtual void extend(const std::vector<Time>& times,
                         const std::vector<ValueType>& values,
                         std::vector<Key>* outKeys = NULL);
@@ -71,10 +197,15 @@ class SE3CompositionCurve : public SE3Curve {
     ///        correction curve coefficients to identity transformations.
     void foldInCorrections();
 
+    /// \brief Fold in the correction coefficients in [begTime, endTime] and reset them to identity.
+    ///        Only the base coefficients up to the neighboring correction coefficients are modified,
+    ///        in place, such that the composed pose and twist at them are preserved.
+    void foldInCorrections(Time begTime, Time endTime);
+
     /// \brief Fit a new curve to these data points.
     ///
-    /// The existing curve will be cleared.
-    /// Underneath the curve should have some default policy for fitting.
+    /// The existing curve will be cleared, the base curve is fitted to the data points and the
+    /// correction curve is reset to identity at its first and last time.
     virtual void fitCurve(const std::vector<Time>& times,
                           const std::vector<ValueType>& values,
                           std::vector<Key>* outKeys = NULL);
@@ -83,16 +214,10 @@ class SE3CompositionCurve : public SE3Curve {
     void setCorrectionTimes(const std::vector<Time>& times);
 
     /// Evaluate the ambient space of the curve.
-    virtual ValueType evaluate(Time time) const;
+    virtual bool evaluate(ValueType& value, Time time) const;
 
-    /// Evaluate the curve derivatives.
-    /// linear 1st derivative has following behaviour:
-    /// - time is out of bound --> error
-    /// - time is between 2 coefficients --> take slope between the 2 coefficients
-    /// - time is on coefficient (not last coefficient) --> take slope between coefficient and next coefficients
-    /// - time is on last coefficient --> take slope between last-1 and last coefficient
-    /// derivatives of order >1 equal 0
-    virtual DerivativeType evaluateDerivative(Time time, unsigned derivativeOrder) const;
+    /// Evaluate the curve derivatives, only the twist (first derivative) is supported.
+    virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const;
 
     virtual void setTimeRange(Time minTime, Time maxTime);
 
@@ -180,6 +305,17 @@ class SE3CompositionCurve : public SE3Curve {
     void getBaseCurveTimesInWindow(std::vector<Time>* outTimes, Time begTime, Time endTime) const;
 
     void getCurveTimes(std::vector<Time>* outTimes) const;
+
+ private:
+  CompositionStrategy compositionStrategy_;
+
+  /// Sampling of the correction coefficients added by extend.
+  SamplingPolicy correctionPolicy_;
+
+  /// Whether the last correction coefficient was added by extend to hold the correction constant
+  /// and the last segment of the correction curve is unmodified since, it is then moved to the new
+  /// end of the curve instead of adding a coefficient.
+  bool isCorrectionHeld_;
 };
 
 } // namespace curves
@@ -10,23 +10,169 @@
 #include "SE3Curve.hpp"
 #include "SlerpSE3Curve.hpp"
 #include "DiscreteSE3Curve.hpp"
-#include "SemiDiscreteSE3Curve.hpp"
+#include "CubicHermiteSE3Curve.hpp"
 #include "SE3CompositionCurve.hpp"
 
+#include <deque>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Core>
 
 namespace curves {
 
+/// The curve types the factory can create. The creation paths that take a type do no string
+/// comparison, resolve names once with SE3CurveFactory::getCurveType.
+enum SE3CurveType {
+  kSlerpSE3Curve = 0,
+  kDiscreteSE3Curve,
+  kCubicHermiteSE3Curve,
+  kSlerpCompositionCurve,
+  kSlerpHermiteCompositionCurve,
+  kDiscreteCompositionCurve,
+  kNumSE3CurveTypes
+};
+
+/// Registration of a curve type: the class and the name used by SE3CurveFactory::create_curve.
+/// Every SE3CurveType has to be specialized, missing ones fail to compile.
+template <SE3CurveType Type>
+struct SE3CurveTypeTraits;
+
+template <>
+struct SE3CurveTypeTraits<kSlerpSE3Curve> {
+  typedef SlerpSE3Curve Curve;
+  static const char* getName() { return "slerp_curve"; }
+};
+
+template <>
+struct SE3CurveTypeTraits<kDiscreteSE3Curve> {
+  typedef DiscreteSE3Curve Curve;
+  static const char* getName() { return "discrete_curve"; }
+};
+
+template <>
+struct SE3CurveTypeTraits<kCubicHermiteSE3Curve> {
+  typedef CubicHermiteSE3Curve Curve;
+  static const char* getName() { return "cubic_hermite_curve"; }
+};
+
+template <>
+struct SE3CurveTypeTraits<kSlerpCompositionCurve> {
+  typedef SE3CompositionCurve<SlerpSE3Curve, SlerpSE3Curve> Curve;
+  static const char* getName() { return "composition_curve"; }
+};
+
+template <>
+struct SE3CurveTypeTraits<kSlerpHermiteCompositionCurve> {
+  typedef SE3CompositionCurve<SlerpSE3Curve, CubicHermiteSE3Curve> Curve;
+  static const char* getName() { return "slerp_hermite_composition_curve"; }
+};
+
+template <>
+struct SE3CurveTypeTraits<kDiscreteCompositionCurve> {
+  typedef SE3CompositionCurve<DiscreteSE3Curve, DiscreteSE3Curve> Curve;
+  static const char* getName() { return "discrete_composition_curve"; }
+};
+
+namespace internal {
+
+/// Largest size and alignment of the registered curve types.
+template <int Type>
+struct SE3CurveTypeLayout {
+  typedef typename SE3CurveTypeTraits<static_cast<SE3CurveType>(Type)>::Curve Curve;
+  typedef SE3CurveTypeLayout<Type + 1> Next;
+  static const size_t kSize = sizeof(Curve) > Next::kSize ? sizeof(Curve) : Next::kSize;
+  static const size_t kAlignment = std::alignment_of<Curve>::value > Next::kAlignment ?
+      std::alignment_of<Curve>::value : Next::kAlignment;
+};
+
+template <>
+struct SE3CurveTypeLayout<kNumSE3CurveTypes> {
+  static const size_t kSize = 0;
+  static const size_t kAlignment = 1;
+};
+
+} // namespace internal
+
 class SE3CurveFactory {
 
  public:
+  /// Storage large enough and aligned for any registered curve type.
+  typedef std::aligned_storage<internal::SE3CurveTypeLayout<0>::kSize,
+      internal::SE3CurveTypeLayout<0>::kAlignment>::type Storage;
 
   SE3CurveFactory() {};
   ~SE3CurveFactory() {};
 
+  /// \brief Create a curve by name, see SE3CurveTypeTraits for the names.
   static std::shared_ptr<SE3Curve> create_curve(const std::string& curveType);
 
+  /// \brief Create a curve of this type.
+  static std::shared_ptr<SE3Curve> createCurve(SE3CurveType type);
+
+  /// \brief Construct a curve in caller-provided storage, without allocating.
+  /// The curve has to be destroyed with destroyCurve before the storage is reused or freed.
+  static SE3Curve* constructCurve(SE3CurveType type, Storage* storage);
+
+  static void destroyCurve(SE3Curve* curve);
+
+  /// \brief Look up the type of a registered name, e.g. once when reading a configuration.
+  /// Returns false if no curve type is registered under this name.
+  static bool getCurveType(const std::string& name, SE3CurveType* type);
+
+  static const char* getCurveName(SE3CurveType type);
+
 }; // class SE3CurveFactory
-} // namespace ctsm
+
+/// Recycles the storage of curves that are created and released at a high rate. The pool grows by
+/// a chunk of blocks when no block is free and never shrinks. It is not thread-safe, use one pool
+/// per thread.
+class SE3CurvePool {
+
+ public:
+  typedef SE3CurveFactory::Storage Storage;
+
+  /// Destroys the curve and returns its block to the pool.
+  class Deleter {
+   public:
+    Deleter() : pool_(NULL), storage_(NULL) {}
+    Deleter(SE3CurvePool* pool, Storage* storage) : pool_(pool), storage_(storage) {}
+
+    void operator()(SE3Curve* curve) const;
+
+   private:
+    SE3CurvePool* pool_;
+    Storage* storage_;
+  };
+
+  typedef std::unique_ptr<SE3Curve, Deleter> CurvePtr;
+
+  explicit SE3CurvePool(size_t blocksPerChunk = 64);
+
+  /// All curves of the pool have to be released before.
+  ~SE3CurvePool();
+
+  CurvePtr createCurve(SE3CurveType type);
+
+  /// Number of blocks, in use or free.
+  size_t getCapacity() const;
+
+  size_t getNumFreeBlocks() const;
+
+ private:
+  void release(Storage* storage);
+
+  typedef std::vector<Storage, Eigen::aligned_allocator<Storage> > Chunk;
+
+  // A deque does not move the chunks when growing, the free blocks point into them.
+  std::deque<Chunk> chunks_;
+  std::vector<Storage*> freeBlocks_;
+  size_t blocksPerChunk_;
+
+}; // class SE3CurvePool
+
+} // namespace curves
 
 #endif // SE3_CURVE_FACTORY_HPP_
@@ -9,8 +9,6 @@
 
 #include "SE2Curve.hpp"
 #include "LocalSupport2CoefficientManager.hpp"
-//#include "SE2CompositionCurve.hpp"
-#include "gtsam/nonlinear/NonlinearFactorGraph.h"
 #include "SamplingPolicy.hpp"
 
 namespace curves {
@@ -18,13 +16,15 @@ namespace curves {
 /// Implements the Slerp (Spherical linear interpolation) curve class.
 /// The Slerp interpolation function is defined as, with the respective Jacobians regarding  A and B:
 /// \f[ T = A(A^{-1}B)^{\alpha} \f]
+/// where the power applies to the rotation and the translation separately (see transformationPower),
+/// i.e. the position is interpolated linearly and the heading along the shortest arc. The twist is
+/// therefore constant within a segment.
 class SlerpSE2Curve : public SE2Curve {
-  //friend class SE2CompositionCurve<SlerpSE2Curve, SlerpSE2Curve>;
-  //friend class SE2CompositionCurve<SlerpSE2Curve, CubicHermiteSE2Curve>;
   friend class SamplingPolicy;
  public:
   typedef SE2Curve::ValueType ValueType;
   typedef SE2Curve::DerivativeType DerivativeType;
+  typedef SE2Curve::State State;
   typedef ValueType Coefficient;
   typedef LocalSupport2CoefficientManager<Coefficient>::TimeToKeyCoefficientMap TimeToKeyCoefficientMap;
   typedef LocalSupport2CoefficientManager<Coefficient>::CoefficientIter CoefficientIter;
@@ -67,7 +67,9 @@ class SlerpSE2Curve : public SE2Curve {
                 const std::vector<ValueType>& values);
 
   /// Evaluate the ambient space of the curve.
-  virtual ValueType evaluate(Time time) const;
+  virtual bool evaluate(ValueType& value, Time time) const;
+
+  virtual bool evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const;
 
   /// Evaluate the curve derivatives.
   /// linear 1st derivative has following behaviour:
@@ -76,24 +78,12 @@ class SlerpSE2Curve : public SE2Curve {
   /// - time is on coefficient (not last coefficient) --> take slope between coefficient and next coefficients
   /// - time is on last coefficient --> take slope between last-1 and last coefficient
   /// derivatives of order >1 equal 0
-  virtual DerivativeType evaluateDerivative(Time time, unsigned derivativeOrder) const;
-
-  /// \brief Get an evaluator at this time
-  virtual gtsam::Expression<ValueType> getValueExpression(const Time& time) const;
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const;
 
-  virtual gtsam::Expression<DerivativeType> getDerivativeExpression(const Time& time, unsigned derivativeOrder) const;
+  virtual bool evaluateState(State& state, Time time) const;
 
   virtual void setTimeRange(Time minTime, Time maxTime);
 
-  /// Initialize a GTSAM values structure with the desired keys
-  virtual void initializeGTSAMValues(gtsam::KeySet keys, gtsam::Values* values) const;
-
-  /// Initialize a GTSAM values structure for all keys
-  virtual void initializeGTSAMValues(gtsam::Values* values) const;
-
-  // updates the relevant curve coefficients from the GTSAM values structure
-  virtual void updateFromGTSAMValues(const gtsam::Values& values);
-
   // set minimum sampling period
   void setMinSamplingPeriod(Time time);
 
@@ -103,23 +93,29 @@ class SlerpSE2Curve : public SE2Curve {
 
   virtual void clear();
 
-  /// \brief Add factors to constrain the variables active at this time.
-  void addPriorFactors(gtsam::NonlinearFactorGraph* graph, Time priorTime) const;
-
   /// \brief Perform a rigid transformation on the left side of the curve
   void transformCurve(const ValueType T);
 
-  virtual Time getTimeAtKey(gtsam::Key key) const;
+  virtual Time getTimeAtKey(Key key) const;
 
   void saveCurveTimesAndValues(const std::string& filename) const;
 
+  void getCurveTimes(std::vector<Time>* outTimes) const;
+
  private:
+  /// Segment that contains the time, a == b if the curve has a single coefficient.
+  bool getSegment(Time time, CoefficientIter* a, CoefficientIter* b) const;
+
+  /// Pose at the time and optionally the (constant) twist of the segment between a and b.
+  static void interpolate(CoefficientIter a, CoefficientIter b, Time time, ValueType& value,
+                          DerivativeType* derivative);
+
   LocalSupport2CoefficientManager<Coefficient> manager_;
   SamplingPolicy slerpPolicy_;
 };
 
-typedef gtsam::Pose2 SE2;
-typedef gtsam::Rot2 SO2;
+typedef Pose2 SE2;
+typedef Pose2::Rotation SO2;
 
 SE2 transformationPower(SE2  T, double alpha);
 
@@ -20,11 +20,16 @@ namespace curves {
 /// Implements the Slerp (Spherical linear interpolation) curve class.
 /// The Slerp interpolation function is defined as, with the respective Jacobians regarding  A and B:
 /// \f[ T = A(A^{-1}B)^{\alpha} \f]
+/// where the power applies to the rotation and the translation separately (see transformationPower),
+/// i.e. the position is interpolated linearly and the rotation along the geodesic. The twist is
+/// therefore constant within a segment. Evaluation does not modify the curve and can run
+/// concurrently, evaluateInBatch shares the relative motion of a segment between its times.
 class SlerpSE3Curve : public SE3Curve {
   friend class SE3CompositionCurve<SlerpSE3Curve, SlerpSE3Curve>;
   friend class SE3CompositionCurve<SlerpSE3Curve, CubicHermiteSE3Curve>;
   friend class SamplingPolicy;
  public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   typedef SE3Curve::ValueType ValueType;
   typedef SE3Curve::DerivativeType DerivativeType;
   typedef ValueType Coefficient;
@@ -69,7 +74,11 @@ class SlerpSE3Curve : public SE3Curve {
                 const std::vector<ValueType>& values);
 
   /// Evaluate the ambient space of the curve.
-  virtual ValueType evaluate(Time time) const;
+  virtual bool evaluate(ValueType& value, Time time) const;
+
+  /// Evaluate the curve at increasing times, with one search and one relative motion per segment.
+  /// Returns false if a time is out of bounds.
+  bool evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const;
 
   /// Evaluate the curve derivatives.
   /// linear 1st derivative has following behaviour:
@@ -78,7 +87,7 @@ class SlerpSE3Curve : public SE3Curve {
   /// - time is on coefficient (not last coefficient) --> take slope between coefficient and next coefficients
   /// - time is on last coefficient --> take slope between last-1 and last coefficient
   /// derivatives of order >1 equal 0
-  virtual DerivativeType evaluateDerivative(Time time, unsigned derivativeOrder) const;
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const;
 
   virtual void setTimeRange(Time minTime, Time maxTime);
 
@@ -189,6 +198,20 @@ class SlerpSE3Curve : public SE3Curve {
   void saveCorrectionCurveTimesAndValues(const std::string& filename) const {};
 
  private:
+  /// Relative motion between the coefficients of a segment, global rotation vector log(R_B R_A^-1).
+  struct Segment {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Time startTime;
+    Time endTime;
+    ValueType start;
+    ValueType end;
+    Eigen::Vector3d translation;
+    Eigen::Vector3d rotation;
+  };
+
+  static void computeSegment(CoefficientIter a, CoefficientIter b, Segment* segment);
+  static void interpolate(const Segment& segment, Time time, ValueType& value);
+
   LocalSupport2CoefficientManager<Coefficient> manager_;
   SamplingPolicy slerpPolicy_;
 };
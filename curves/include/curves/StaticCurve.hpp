@@ -0,0 +1,174 @@
+/*
+ * StaticCurve.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include "curves/Curve.hpp"
+
+namespace curves {
+
+namespace internal {
+
+/// Maps a derivative order known at runtime to the implementation of that order, orders
+/// outside of [Order, MaxOrder] are not provided.
+template <class Derived, unsigned Order, unsigned MaxOrder, bool isProvided = (Order <= MaxOrder)>
+struct DerivativeOrderDispatch {
+  template <class DerivativeType>
+  static bool evaluate(const Derived& curve, DerivativeType& derivative, Time time, unsigned derivativeOrder)
+  {
+    if (derivativeOrder == Order) {
+      return curve.template evaluateDerivativeImpl<Order>(derivative, time);
+    }
+    return DerivativeOrderDispatch<Derived, Order + 1, MaxOrder>::evaluate(curve, derivative, time, derivativeOrder);
+  }
+};
+
+template <class Derived, unsigned Order, unsigned MaxOrder>
+struct DerivativeOrderDispatch<Derived, Order, MaxOrder, false> {
+  template <class DerivativeType>
+  static bool evaluate(const Derived&, DerivativeType&, Time, unsigned)
+  {
+    return false;
+  }
+};
+
+} // namespace internal
+
+/*
+ * Static-dispatch interface of the curves (curiously recurring template pattern). The curve
+ * Derived implements in its header
+ *   static constexpr unsigned maxDerivativeOrder;
+ *   bool evaluateImpl(ValueType& value, Time time) const;
+ *   template <unsigned Order>
+ *   bool evaluateDerivativeImpl(DerivativeType& derivative, Time time) const;
+ *   template <unsigned MaxOrder>
+ *   bool evaluateImpl(ValueType& value, std::array<DerivativeType, MaxOrder>& derivatives, Time time) const;
+ * and StaticCurve implements the virtual evaluate and evaluateDerivative of the Interface
+ * (Curve<Config> or one of its subclasses) as thin adapters to them. Code which knows the type of
+ * the curve evaluates it through StaticCurveTraits, without virtual calls, such that the
+ * evaluation can be inlined into the calling loop. With the derivative order as a template
+ * argument, only the code of that order is compiled in, and orders the curve does not provide
+ * fail to compile.
+ */
+template <class Derived, class Interface>
+class StaticCurve : public Interface
+{
+ public:
+  typedef typename Interface::ValueType ValueType;
+  typedef typename Interface::DerivativeType DerivativeType;
+
+  StaticCurve() : Interface() {}
+  virtual ~StaticCurve() {}
+
+  virtual bool evaluate(ValueType& value, Time time) const
+  {
+    return derived().evaluateImpl(value, time);
+  }
+
+  /// Returns false for orders the curve does not provide (0 or above maxDerivativeOrder).
+  virtual bool evaluateDerivative(DerivativeType& derivative, Time time, unsigned derivativeOrder) const
+  {
+    return internal::DerivativeOrderDispatch<Derived, 1, Derived::maxDerivativeOrder>::evaluate(
+        derived(), derivative, time, derivativeOrder);
+  }
+
+  /// Value and the derivatives of the orders 1 to MaxOrder at one time, sharing the segment
+  /// lookup and the intermediate results between the orders.
+  template <unsigned MaxOrder>
+  bool evaluate(ValueType& value, std::array<DerivativeType, MaxOrder>& derivatives, Time time) const
+  {
+    static_assert(MaxOrder <= Derived::maxDerivativeOrder, "The curve does not provide derivatives of this order.");
+    return derived().template evaluateImpl<MaxOrder>(value, derivatives, time);
+  }
+
+  template <unsigned Order>
+  bool evaluateDerivative(DerivativeType& derivative, Time time) const
+  {
+    static_assert(Order >= 1 && Order <= Derived::maxDerivativeOrder,
+                  "The curve does not provide derivatives of this order.");
+    return derived().template evaluateDerivativeImpl<Order>(derivative, time);
+  }
+
+ protected:
+  const Derived& derived() const
+  {
+    return static_cast<const Derived&>(*this);
+  }
+};
+
+/// Evaluation of a curve of known type, for curve templates and batch algorithms. The calls are
+/// qualified and therefore bound at compile time: for a StaticCurve they inline down to the
+/// implementation of the curve, for other curves they save the virtual call but stay out-of-line
+/// if the curve is implemented in a translation unit.
+template <class CurveType>
+struct StaticCurveTraits {
+  static_assert(!std::is_abstract<CurveType>::value, "Static dispatch needs the concrete type of the curve.");
+
+  typedef typename CurveType::ValueType ValueType;
+  typedef typename CurveType::DerivativeType DerivativeType;
+
+  static bool evaluate(const CurveType& curve, ValueType& value, Time time)
+  {
+    return curve.CurveType::evaluate(value, time);
+  }
+
+  static bool evaluateDerivative(const CurveType& curve, DerivativeType& derivative, Time time,
+                                 unsigned derivativeOrder)
+  {
+    return curve.CurveType::evaluateDerivative(derivative, time, derivativeOrder);
+  }
+
+  /// Evaluates the curve at all times, returns false if it could not be evaluated at one of them.
+  template <class Allocator>
+  static bool evaluateInBatch(const CurveType& curve, const std::vector<Time>& times,
+                              std::vector<ValueType, Allocator>& values)
+  {
+    values.resize(times.size());
+    bool success = true;
+    for (size_t i = 0; i < times.size(); ++i) {
+      success &= evaluate(curve, values[i], times[i]);
+    }
+    return success;
+  }
+
+  template <class Allocator>
+  static bool evaluateDerivativeInBatch(const CurveType& curve, const std::vector<Time>& times,
+                                        unsigned derivativeOrder,
+                                        std::vector<DerivativeType, Allocator>& derivatives)
+  {
+    derivatives.resize(times.size());
+    bool success = true;
+    for (size_t i = 0; i < times.size(); ++i) {
+      success &= evaluateDerivative(curve, derivatives[i], times[i], derivativeOrder);
+    }
+    return success;
+  }
+
+  /// Derivative of compile-time order, needs a StaticCurve.
+  template <unsigned Order>
+  static bool evaluateDerivative(const CurveType& curve, DerivativeType& derivative, Time time)
+  {
+    return curve.template evaluateDerivative<Order>(derivative, time);
+  }
+
+  template <unsigned Order, class Allocator>
+  static bool evaluateDerivativeInBatch(const CurveType& curve, const std::vector<Time>& times,
+                                        std::vector<DerivativeType, Allocator>& derivatives)
+  {
+    derivatives.resize(times.size());
+    bool success = true;
+    for (size_t i = 0; i < times.size(); ++i) {
+      success &= curve.template evaluateDerivative<Order>(derivatives[i], times[i]);
+    }
+    return success;
+  }
+};
+
+} // namespace
@@ -0,0 +1,71 @@
+/*
+ * TimeAffineTransform.hpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include "curves/Curve.hpp"
+
+namespace curves {
+
+/*
+ * Affine reparametrization t' = scale*t + offset between the time t in which a curve was fitted
+ * and the time t' in which it is evaluated. A curve which stores this transform can be stretched
+ * and shifted without touching its coefficients: the query time is mapped back before the lookup
+ * and a derivative of order n is multiplied by scale^-n (chain rule).
+ */
+struct TimeAffineTransform {
+  TimeAffineTransform()
+      : scale(1.0),
+        offset(0.0)
+  {
+  }
+
+  /// Fitted time of the evaluation time t'.
+  Time toCurveTime(Time time) const
+  {
+    return (time - offset) / scale;
+  }
+
+  /// Evaluation time of the fitted time t.
+  Time fromCurveTime(Time time) const
+  {
+    return scale * time + offset;
+  }
+
+  /// Factor d^n t / dt'^n of the n-th derivative.
+  double getDerivativeFactor(unsigned int derivativeOrder) const
+  {
+    double factor = 1.0;
+    for (unsigned int i = 0; i < derivativeOrder; ++i) factor /= scale;
+    return factor;
+  }
+
+  /// Applies t'' = a*t' + b on top of the current transform.
+  void compose(double a, double b)
+  {
+    CHECK_GT(a, 0.0) << "Time scale has to be positive.";
+    scale *= a;
+    offset = a * offset + b;
+  }
+
+  bool isIdentity() const
+  {
+    return scale == 1.0 && offset == 0.0;
+  }
+
+  void reset()
+  {
+    scale = 1.0;
+    offset = 0.0;
+  }
+
+  double scale;
+  double offset;
+};
+
+} /* namespace */
@@ -0,0 +1,291 @@
+/*
+ * CubicHermiteSE2Curve.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <iostream>
+#include <iterator>
+
+#include "curves/CubicHermiteSE2Curve.hpp"
+#include "curves/helpers.hpp"
+
+namespace curves {
+
+CubicHermiteSE2Curve::CubicHermiteSE2Curve() : SE2Curve() {}
+
+CubicHermiteSE2Curve::~CubicHermiteSE2Curve() {}
+
+void CubicHermiteSE2Curve::print(const std::string& str) const {
+  std::cout << "=========================================" << std::endl;
+  std::cout << "======= Cubic Hermite SE2 CURVE =========" << std::endl;
+  std::cout << str << std::endl;
+  std::cout << "num of coefficients: " << manager_.size() << std::endl;
+  std::cout << "dimension: " << 3 << std::endl;
+  std::cout << "curve defined between times: " << manager_.getMinTime() <<
+      " and " << manager_.getMaxTime() <<std::endl;
+  std::cout <<"=========================================" <<std::endl;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    const Coefficient& coefficient = it->second.coefficient;
+    std::cout << "coefficient " << it->second.key << ": x " << coefficient.value.x() << " y "
+        << coefficient.value.y() << " theta " << coefficient.value.theta() << " twist "
+        << coefficient.derivative.transpose();
+    std::cout << " | time: " << it->first;
+    std::cout << std::endl;
+  }
+  std::cout <<"=========================================" <<std::endl;
+}
+
+Time CubicHermiteSE2Curve::getMaxTime() const {
+  return manager_.getMaxTime();
+}
+
+Time CubicHermiteSE2Curve::getMinTime() const {
+  return manager_.getMinTime();
+}
+
+bool CubicHermiteSE2Curve::isEmpty() const {
+  return manager_.size() == 0;
+}
+
+int CubicHermiteSE2Curve::size() const {
+  return manager_.size();
+}
+
+CubicHermiteSE2Curve::DerivativeType CubicHermiteSE2Curve::calculateSlope(Time timeA, Time timeB,
+                                                                          const ValueType& T_W_A,
+                                                                          const ValueType& T_W_B) const {
+  // note: unit of derivative is m/s for first 2 and rad/s for the last entry
+  return T_W_B.boxMinus(T_W_A) / (timeB - timeA);
+}
+
+void CubicHermiteSE2Curve::fitCurve(const std::vector<Time>& times,
+                                    const std::vector<ValueType>& values,
+                                    std::vector<Key>* outKeys) {
+  fitCurveWithDerivatives(times, values, DerivativeType::Zero(), DerivativeType::Zero(), outKeys);
+}
+
+void CubicHermiteSE2Curve::fitCurveWithDerivatives(const std::vector<Time>& times,
+                                                   const std::vector<ValueType>& values,
+                                                   const DerivativeType& initialDerivative,
+                                                   const DerivativeType& finalDerivative,
+                                                   std::vector<Key>* outKeys) {
+  CHECK_EQ(times.size(), values.size());
+  clear();
+
+  // use Catmull-Rom interpolation for derivatives on knot points
+  std::vector<Coefficient> coefficients;
+  coefficients.reserve(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    DerivativeType derivative;
+    if (i == 0) {
+      derivative = initialDerivative;
+    } else if (i == times.size() - 1) {
+      derivative = finalDerivative;
+    } else {
+      derivative = calculateSlope(times[i-1], times[i+1], values[i-1], values[i+1]);
+    }
+    coefficients.push_back(Coefficient(values[i], derivative));
+  }
+
+  manager_.insertCoefficients(times, coefficients, outKeys);
+}
+
+void CubicHermiteSE2Curve::extend(const std::vector<Time>& times,
+                                  const std::vector<ValueType>& values,
+                                  std::vector<Key>* outKeys) {
+  CHECK_EQ(times.size(), values.size()) << "number of times and number of coefficients don't match";
+  if (times.empty()) {
+    return;
+  }
+  for (size_t i = 0; i < times.size(); ++i) {
+    CHECK((i == 0 && manager_.size() == 0) || times[i] > (i == 0 ? manager_.getMaxTime() : times[i-1]))
+        << "curve can only be extended into the future. Requested = " << times[i];
+  }
+
+  // Same knots as fitCurve with all values, the previous last knot becomes an inner knot.
+  Time previousTime = times[0];
+  ValueType previousValue = values[0];
+  if (manager_.size() > 0) {
+    CoefficientIter last = --manager_.coefficientEnd();
+    previousTime = last->first;
+    previousValue = last->second.coefficient.value;
+    if (manager_.size() > 1) {
+      CoefficientIter beforeLast = last;
+      --beforeLast;
+      manager_.updateCoefficientByKey(last->second.key, Coefficient(previousValue,
+          calculateSlope(beforeLast->first, times[0], beforeLast->second.coefficient.value, values[0])));
+    }
+  }
+
+  std::vector<Coefficient> coefficients;
+  coefficients.reserve(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    DerivativeType derivative = DerivativeType::Zero();
+    if (i + 1 < times.size() && (i > 0 || manager_.size() > 0)) {
+      derivative = calculateSlope(previousTime, times[i+1], previousValue, values[i+1]);
+    }
+    coefficients.push_back(Coefficient(values[i], derivative));
+    previousTime = times[i];
+    previousValue = values[i];
+  }
+  manager_.insertCoefficients(times, coefficients, outKeys);
+}
+
+bool CubicHermiteSE2Curve::evaluate(ValueType& value, Time time) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
+  }
+  interpolate(a, b, time, value, NULL, NULL);
+  return true;
+}
+
+bool CubicHermiteSE2Curve::evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const {
+  values.resize(times.size());
+  if (times.empty()) {
+    return true;
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    CHECK_GE(times[i], times[i-1]) << "The times have to be increasing.";
+  }
+  if (manager_.empty() || times.front() < manager_.getMinTime() || times.back() > manager_.getMaxTime()) {
+    return false;
+  }
+
+  CoefficientIter a, b;
+  CHECK(getSegment(times.front(), &a, &b));
+  const CoefficientIter end = manager_.coefficientEnd();
+  for (size_t i = 0; i < times.size(); ++i) {
+    while (b->first < times[i] && std::next(b) != end) {
+      a = b;
+      ++b;
+    }
+    interpolate(a, b, times[i], values[i], NULL, NULL);
+  }
+  return true;
+}
+
+bool CubicHermiteSE2Curve::evaluateDerivative(DerivativeType& derivative, Time time,
+                                              unsigned derivativeOrder) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
+  }
+  ValueType value;
+  switch (derivativeOrder) {
+    case 1:
+      interpolate(a, b, time, value, &derivative, NULL);
+      break;
+    case 2:
+      interpolate(a, b, time, value, NULL, &derivative);
+      break;
+    default:
+      derivative.setZero();
+  }
+  return true;
+}
+
+bool CubicHermiteSE2Curve::evaluateState(State& state, Time time) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
+  }
+  interpolate(a, b, time, state.value, &state.velocity, &state.acceleration);
+  return true;
+}
+
+bool CubicHermiteSE2Curve::getSegment(Time time, CoefficientIter* a, CoefficientIter* b) const {
+  if (manager_.empty() || time < manager_.getMinTime() || time > manager_.getMaxTime()) {
+    return false;
+  }
+  // The curve is only defined at this one time.
+  if (manager_.size() == 1) {
+    *a = *b = manager_.coefficientBegin();
+    return true;
+  }
+  return manager_.getCoefficientsAt(time, a, b);
+}
+
+void CubicHermiteSE2Curve::interpolate(CoefficientIter a, CoefficientIter b, Time time, ValueType& value,
+                                       DerivativeType* velocity, DerivativeType* acceleration) {
+  const Coefficient& coefficientA = a->second.coefficient;
+  if (a == b) {
+    value = coefficientA.value;
+    if (velocity != NULL) {
+      *velocity = coefficientA.derivative;
+    }
+    if (acceleration != NULL) {
+      acceleration->setZero();
+    }
+    return;
+  }
+  const Coefficient& coefficientB = b->second.coefficient;
+  const double dt = b->first - a->first;
+  const double s = (time - a->first) / dt;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+
+  // Control points relative to A, the h00 term vanishes.
+  const Eigen::Vector3d startSlope = coefficientA.derivative * dt;
+  const Eigen::Vector3d delta = coefficientB.value.boxMinus(coefficientA.value);
+  const Eigen::Vector3d endSlope = coefficientB.derivative * dt;
+
+  value = coefficientA.value.boxPlus((s3 - 2.0 * s2 + s) * startSlope + (-2.0 * s3 + 3.0 * s2) * delta
+                                     + (s3 - s2) * endSlope);
+  if (velocity != NULL) {
+    *velocity = ((3.0 * s2 - 4.0 * s + 1.0) * startSlope + (-6.0 * s2 + 6.0 * s) * delta
+                 + (3.0 * s2 - 2.0 * s) * endSlope) / dt;
+  }
+  if (acceleration != NULL) {
+    *acceleration = ((6.0 * s - 4.0) * startSlope + (-12.0 * s + 6.0) * delta
+                     + (6.0 * s - 2.0) * endSlope) / (dt * dt);
+  }
+}
+
+void CubicHermiteSE2Curve::setTimeRange(Time minTime, Time maxTime) {
+  CHECK(false) << "Not implemented";
+}
+
+void CubicHermiteSE2Curve::clear() {
+  manager_.clear();
+}
+
+void CubicHermiteSE2Curve::transformCurve(const ValueType T) {
+  std::vector<Time> coefTimes;
+  std::vector<Coefficient> coefValues;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    // Apply a rigid transformation to every coefficient (on the left side), the global twist is
+    // rotated into the new frame.
+    const Coefficient& coefficient = it->second.coefficient;
+    DerivativeType derivative;
+    derivative.head<2>() = T.getRotation() * coefficient.derivative.head<2>();
+    derivative(2) = coefficient.derivative(2);
+    coefTimes.push_back(it->first);
+    coefValues.push_back(Coefficient(T * coefficient.value, derivative));
+  }
+  manager_.modifyCoefficientsValuesInBatch(coefTimes, coefValues);
+}
+
+void CubicHermiteSE2Curve::saveCurveTimesAndValues(const std::string& filename) const {
+  std::vector<Time> curveTimes;
+  manager_.getTimes(&curveTimes);
+
+  Eigen::VectorXd v(3);
+
+  std::vector<Eigen::VectorXd> curveValues;
+  ValueType val;
+  for (size_t i = 0; i < curveTimes.size(); ++i) {
+    evaluate(val, curveTimes[i]);
+    v << val.x(), val.y(), val.theta();
+    curveValues.push_back(v);
+  }
+
+  writeTimeVectorCSV(filename, curveTimes, curveValues);
+}
+
+void CubicHermiteSE2Curve::getCurveTimes(std::vector<Time>* outTimes) const {
+  manager_.getTimes(outTimes);
+}
+
+} // namespace curves
@@ -6,9 +6,13 @@
  *   Institute: ETH Zurich, Autonomous Systems Lab
  */
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 #include "curves/CubicHermiteSE3Curve.hpp"
+#include "curves/CubicHermiteSE3Interpolation.hpp"
+#include "curves/PolynomialSplineSmoother.hpp"
 #include "curves/SlerpSE3Curve.hpp"
 
 namespace curves {
@@ -83,17 +87,15 @@ bool CubicHermiteSE3Curve::writeEvalToFile(const std::string& filename, int nSam
 }
 
 Time CubicHermiteSE3Curve::getMaxTime() const {
-  return manager_.getMaxTime();
+  return timeTransform_.fromCurveTime(manager_.getMaxTime());
 }
 
 Time CubicHermiteSE3Curve::getMinTime() const {
-  return manager_.getMinTime();
+  return timeTransform_.fromCurveTime(manager_.getMinTime());
 }
 
 bool CubicHermiteSE3Curve::isEmpty() const {
-  std::vector<Time> outTimes;
-  manager_.getTimes(&outTimes);
-  return outTimes.empty();
+  return manager_.size() == 0;
 }
 
 int CubicHermiteSE3Curve::size() const {
@@ -157,6 +159,90 @@ void CubicHermiteSE3Curve::fitPeriodicCurve(const std::vector<Time>& times,
   fitCurveWithDerivatives(times, values, derivative, derivative, outKeys);
 }
 
+bool CubicHermiteSE3Curve::fitCurveSmoothing(const std::vector<Time>& knotTimes,
+                                             const std::vector<Time>& sampleTimes,
+                                             const std::vector<ValueType>& sampleValues,
+                                             double roughnessWeight,
+                                             const std::vector<double>& sampleWeights,
+                                             std::vector<Key>* outKeys)
+{
+  CHECK_EQ(sampleTimes.size(), sampleValues.size());
+  CHECK(sampleWeights.empty() || sampleWeights.size() == sampleTimes.size());
+  const size_t numKnots = knotTimes.size();
+  const size_t numSamples = sampleTimes.size();
+  if (numSamples == 0) return false;
+
+  // Translation: the Hermite coefficients are the knot positions and velocities of a smoothing cubic spline.
+  std::vector<std::vector<double> > positions(3, std::vector<double>(numSamples));
+  for (size_t j = 0; j < numSamples; ++j) {
+    for (int i = 0; i < 3; ++i) positions[i][j] = sampleValues[j].getPosition()(i);
+  }
+  PolynomialSplineSmoother<3> smoother;
+  if (!smoother.fit(knotTimes, sampleTimes, positions, roughnessWeight, sampleWeights)) {
+    return false;
+  }
+
+  // Rotation: for every knot, fit rotation(t) = exp(a + b*(t - t_k)) * R_ref to the samples between the
+  // neighboring knots, weighted by a hat function. The global angular velocity at the knot is b.
+  std::vector<size_t> order(numSamples);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sampleTimes[a] < sampleTimes[b]; });
+  std::vector<Time> sortedTimes(numSamples);
+  for (size_t j = 0; j < numSamples; ++j) sortedTimes[j] = sampleTimes[order[j]];
+
+  std::vector<Coefficient> coefficients;
+  coefficients.reserve(numKnots);
+  for (size_t k = 0; k < numKnots; ++k) {
+    const Time knotTime = knotTimes[k];
+    const Time windowStart = (k > 0) ? knotTimes[k-1] : knotTime;
+    const Time windowEnd = (k + 1 < numKnots) ? knotTimes[k+1] : knotTime;
+    const size_t begin = ((k > 0) ? std::upper_bound(sortedTimes.begin(), sortedTimes.end(), windowStart)
+                                  : std::lower_bound(sortedTimes.begin(), sortedTimes.end(), knotTime)) - sortedTimes.begin();
+    const size_t end = ((k + 1 < numKnots) ? std::lower_bound(sortedTimes.begin(), sortedTimes.end(), windowEnd)
+                                           : std::upper_bound(sortedTimes.begin(), sortedTimes.end(), knotTime)) - sortedTimes.begin();
+    if (begin >= end) return false;
+
+    // Reference rotation of the sample closest to the knot.
+    const size_t closest = std::lower_bound(sortedTimes.begin(), sortedTimes.end(), knotTime) - sortedTimes.begin();
+    size_t reference = closest;
+    if (closest == numSamples || (closest > 0 && knotTime - sortedTimes[closest-1] < sortedTimes[closest] - knotTime)) {
+      reference = closest - 1;
+    }
+    const SO3 referenceRotation = sampleValues[order[reference]].getRotation();
+
+    Eigen::Matrix2d normalMatrix = Eigen::Matrix2d::Zero();
+    Eigen::Matrix<double, 2, 3> rhs = Eigen::Matrix<double, 2, 3>::Zero();
+    for (size_t j = begin; j < end; ++j) {
+      const double dt = sortedTimes[j] - knotTime;
+      const double halfWidth = (dt < 0.0) ? knotTime - windowStart : windowEnd - knotTime;
+      const double hat = (dt == 0.0) ? 1.0 : 1.0 - std::abs(dt) / halfWidth;
+      const double weight = (sampleWeights.empty() ? 1.0 : sampleWeights[order[j]]) * hat;
+      const Eigen::Vector3d phi = sampleValues[order[j]].getRotation().boxMinus(referenceRotation);
+      const Eigen::Vector2d row(1.0, dt);
+      normalMatrix += weight * row * row.transpose();
+      rhs += weight * row * phi.transpose();
+    }
+
+    Eigen::Vector3d offset = Eigen::Vector3d::Zero(), angularVelocity = Eigen::Vector3d::Zero();
+    if (normalMatrix.determinant() > 1.0e-12 * normalMatrix.squaredNorm()) {
+      const Eigen::Matrix<double, 2, 3> solution = normalMatrix.ldlt().solve(rhs);
+      offset = solution.row(0).transpose();
+      angularVelocity = solution.row(1).transpose();
+    } else if (normalMatrix(0, 0) > 0.0) {
+      offset = rhs.row(0).transpose() / normalMatrix(0, 0);
+    }
+
+    const SE3::Position position(smoother.getKnotState(0, k), smoother.getKnotState(1, k), smoother.getKnotState(2, k));
+    const Eigen::Vector3d velocity(smoother.getKnotState(0, k, 1), smoother.getKnotState(1, k, 1), smoother.getKnotState(2, k, 1));
+    coefficients.push_back(Coefficient(SE3(position, referenceRotation.boxPlus(offset)),
+                                       DerivativeType(velocity, angularVelocity)));
+  }
+
+  clear();
+  manager_.insertCoefficients(knotTimes, coefficients, outKeys);
+  return true;
+}
+
 CubicHermiteSE3Curve::DerivativeType CubicHermiteSE3Curve::calculateSlope(const Time& timeA,
                                                                           const Time& timeB,
                                                                           const ValueType& T_W_A,
@@ -174,25 +260,74 @@ CubicHermiteSE3Curve::DerivativeType CubicHermiteSE3Curve::calculateSlope(const
 void CubicHermiteSE3Curve::extend(const std::vector<Time>& times,
                                   const std::vector<ValueType>& values,
                                   std::vector<Key>* outKeys) {
+  CHECK_EQ(times.size(), values.size()) << "number of times and number of coefficients don't match";
+  if (times.empty()) {
+    return;
+  }
 
-  // New values in extend first need to be checked if they can be added to curve
-  // otherwise the most recent coefficient will be an interpolation based on the last
-  // coefficient and the requested time-value pair
+  // The coefficients are appended like fitCurve would have set them for all values: Catmull-Rom
+  // slopes at the inner knots and a zero twist at the last knot. The previous last knot becomes
+  // an inner knot, its slope is updated (a single knot keeps its initial derivative).
+  std::vector<Time> curveTimes(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    curveTimes[i] = timeTransform_.toCurveTime(times[i]);
+    CHECK((i == 0 && manager_.size() == 0) || curveTimes[i] > (i == 0 ? manager_.getMaxTime() : curveTimes[i-1]))
+        << "curve can only be extended into the future. Requested = " << times[i];
+  }
 
-  // switch extension curve between default and interpolation (with regard to policy)
-  // - default extend if the minimum time gap between 2 coefficients is satisfied
-  // - default extend if enough measurements were taken between 2 coefficients, so
-  //   the curve is well defined
-  // - default extend if curve is empty
-  // - interpolation extend otherwise
+  Time previousTime = curveTimes[0];
+  ValueType previousValue = values[0];
+  if (manager_.size() > 0) {
+    CoefficientIter last = --manager_.coefficientEnd();
+    previousTime = last->first;
+    previousValue = last->second.coefficient.getTransformation();
+    if (manager_.size() > 1) {
+      CoefficientIter beforeLast = last;
+      --beforeLast;
+      manager_.updateCoefficientByKey(last->second.key, Coefficient(previousValue,
+          calculateSlope(beforeLast->first, curveTimes[0], beforeLast->second.coefficient.getTransformation(), values[0])));
+    }
+  }
 
-//  CHECK_EQ(times.size(), values.size()) << "number of times and number of coefficients don't match";
-//  hermitePolicy_.extend<CubicHermiteSE3Curve, ValueType>(times, values, this, outKeys);
-  throw std::runtime_error("CubicHermiteSE3Curve::extend is not implemented!");
+  std::vector<Coefficient> coefficients;
+  coefficients.reserve(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    DerivativeType derivative;
+    if (i + 1 < times.size() && (i > 0 || manager_.size() > 0)) {
+      derivative = calculateSlope(previousTime, curveTimes[i+1], previousValue, values[i+1]);
+    }
+    coefficients.push_back(Coefficient(values[i], derivative));
+    previousTime = curveTimes[i];
+    previousValue = values[i];
+  }
+  manager_.insertCoefficients(curveTimes, coefficients, outKeys);
 }
 
-
 bool CubicHermiteSE3Curve::evaluate(ValueType& value, Time time) const {
+  return evaluateAtCurveTime(value, timeTransform_.toCurveTime(time));
+}
+
+bool CubicHermiteSE3Curve::evaluateDerivative(DerivativeType& derivative,
+    Time time, unsigned int derivativeOrder) const
+{
+  if (derivativeOrder == 1) {
+    if (!evaluateDerivativeAtCurveTime(derivative, timeTransform_.toCurveTime(time))) {
+      return false;
+    }
+    if (!timeTransform_.isIdentity()) {
+      const double factor = timeTransform_.getDerivativeFactor(1);
+      derivative = DerivativeType(derivative.getTranslationalVelocity().vector() * factor,
+                                  derivative.getRotationalVelocity().vector() * factor);
+    }
+    return true;
+  }
+  else {
+    std::cerr << "CubicHermiteSE3Curve::evaluateDerivative: higher order derivatives are not implemented!";
+    return false;
+  }
+}
+
+bool CubicHermiteSE3Curve::evaluateAtCurveTime(ValueType& value, Time time) const {
   // Check if the curve is only defined at this one time
   if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
     value =  manager_.coefficientBegin()->second.coefficient.getTransformation();
@@ -206,177 +341,175 @@ bool CubicHermiteSE3Curve::evaluate(ValueType& value, Time time) const {
       return false;
     }
 
-    // read out transformation from coefficient
-    const SE3 T_W_A = a->second.coefficient.getTransformation();
-    const SE3 T_W_B = b->second.coefficient.getTransformation();
-
-    // read out derivative from coefficient
-    const Twist d_W_A = a->second.coefficient.getTransformationDerivative();
-    const Twist d_W_B = b->second.coefficient.getTransformationDerivative();
-
     // make alpha
     const double dt_sec = (b->first - a->first);// * 1e-9;
     const double alpha = double(time - a->first)/(b->first - a->first);
 
-    // Implemantation of Hermite Interpolation not easy and not fun (without expressions)!
-
-    // translational part (easy):
-    const double alpha2 = alpha * alpha;
-    const double alpha3 = alpha2 * alpha;
-
-    const double beta0 = 2.0 * alpha3 - 3.0 * alpha2 + 1.0;
-    const double beta1 = -2.0 * alpha3 + 3.0 * alpha2;
-    const double beta2 = alpha3 - 2.0 * alpha2 + alpha;
-    const double beta3 = alpha3 - alpha2;
-
-    /**************************************************************************************
-     *  Translational part:
-     **************************************************************************************/
-    const SE3::Position translation(T_W_A.getPosition().vector() * beta0
-                                  + T_W_B.getPosition().vector() * beta1
-                                  + d_W_A.getTranslationalVelocity().vector() * (beta2 * dt_sec)
-                                  + d_W_B.getTranslationalVelocity().vector() * (beta3 * dt_sec));
-
-    /**************************************************************************************
-     *  Rotational part:
-     **************************************************************************************/
-    const double dt_sec_third = dt_sec / 3.0;
-    const Eigen::Vector3d scaled_d_W_A = dt_sec_third * d_W_A.getRotationalVelocity().vector();
-    const Eigen::Vector3d scaled_d_W_B = dt_sec_third * d_W_B.getRotationalVelocity().vector();
-
-    // d_W_A contains the global angular velocity, but we need the local angular velocity.
-    const Eigen::Vector3d w1 = T_W_A.getRotation().inverseRotate(scaled_d_W_A);
-    const Eigen::Vector3d w3 = T_W_B.getRotation().inverseRotate(scaled_d_W_B);
-    const RotationQuaternion expW1_inv = RotationQuaternion().exponentialMap(-w1);
-    const RotationQuaternion expW3_inv = RotationQuaternion().exponentialMap(-w3);
-    const RotationQuaternion expW1_Inv_qWB_expW3 = expW1_inv * T_W_A.getRotation().inverted() * T_W_B.getRotation() * expW3_inv;
-    const Eigen::Vector3d w2 = expW1_Inv_qWB_expW3.logarithmicMap();
-
-    const double dBeta1 = alpha3 - 3.0 * alpha2 + 3.0 * alpha;
-    const double dBeta2 = -2.0 * alpha3 + 3.0 * alpha2;
-    const double dBeta3 = alpha3;
-
-    const SO3 w1_dBeta1_exp = RotationQuaternion().exponentialMap(dBeta1 * w1);
-    const SO3 w2_dBeta2_exp = RotationQuaternion().exponentialMap(dBeta2 * w2);
-    const SO3 w3_dBeta3_exp = RotationQuaternion().exponentialMap(dBeta3 * w3);
-
-    const RotationQuaternion rotation = T_W_A.getRotation() * w1_dBeta1_exp * w2_dBeta2_exp * w3_dBeta3_exp;
-
-    value = SE3(translation, rotation);
+    interpolateCubicHermiteSE3(value,
+                               a->second.coefficient.getTransformation(), a->second.coefficient.getTransformationDerivative(),
+                               b->second.coefficient.getTransformation(), b->second.coefficient.getTransformationDerivative(),
+                               dt_sec, alpha);
     return true;
   }
   return false;
 }
 
-bool CubicHermiteSE3Curve::evaluateDerivative(DerivativeType& derivative,
-    Time time, unsigned int derivativeOrder) const
+bool CubicHermiteSE3Curve::evaluateDerivativeAtCurveTime(DerivativeType& derivative, Time time) const
 {
-  if (derivativeOrder == 1) {
-    // Check if the curve is only defined at this one time
-    if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
-      derivative = manager_.coefficientBegin()->second.coefficient.getTransformationDerivative();
-      return true;
+  // Check if the curve is only defined at this one time
+  if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
+    derivative = manager_.coefficientBegin()->second.coefficient.getTransformationDerivative();
+    return true;
+  }
+  else {
+    CoefficientIter a, b;
+    bool success = manager_.getCoefficientsAt(time, &a, &b);
+    if(!success) {
+      std::cerr << "Unable to get the coefficients at time " << time << std::endl;
+      return false;
     }
-    else {
-      CoefficientIter a, b;
-      bool success = manager_.getCoefficientsAt(time, &a, &b);
-      if(!success) {
-        std::cerr << "Unable to get the coefficients at time " << time << std::endl;
-        return false;
-      }
-
-      // read out transformation from coefficient
-      const SE3 T_W_A = a->second.coefficient.getTransformation();
-      const SE3 T_W_B = b->second.coefficient.getTransformation();
-
-      // read out derivative from coefficient
-      const Twist d_W_A = a->second.coefficient.getTransformationDerivative();
-      const Twist d_W_B = b->second.coefficient.getTransformationDerivative();
-
-      // make alpha
-      double dt_sec = (b->first - a->first);
-      const double one_over_dt_sec = 1.0/dt_sec;
-      double alpha = double(time - a->first)/dt_sec;
-
-      const double alpha2 = alpha * alpha;
-      const double alpha3 = alpha2 * alpha;
-
-      /**************************************************************************************
-       *  Translational part:
-       **************************************************************************************/
-      // Implementation of translation
-      const double gamma0 = 6.0*(alpha2 - alpha);
-      const double gamma1 = 3.0*alpha2 - 4.0*alpha + 1.0;
-      const double gamma2 = 6.0*(alpha - alpha2);
-      const double gamma3 = 3.0*alpha2 - 2.0*alpha;
-
-      const Eigen::Vector3d velocity_m_s = T_W_A.getPosition().vector()*(gamma0*one_over_dt_sec)
-                                         + d_W_A.getTranslationalVelocity().vector()*(gamma1)
-                                         + T_W_B.getPosition().vector()*(gamma2*one_over_dt_sec)
-                                         + d_W_B.getTranslationalVelocity().vector()*(gamma3);
-
-
-      /**************************************************************************************
-       *  Rotational part:
-       **************************************************************************************/
-      const double one_minus_alpha = (1.0 - alpha);
-      const double one_minus_alpha_2 = one_minus_alpha * one_minus_alpha;
-      const double one_minus_alpha_3 = one_minus_alpha * one_minus_alpha_2;
-
-      const double beta1 = 1.0 - one_minus_alpha_3;
-      const double dbeta1 = 3.0*one_minus_alpha_2;
-      const double beta2 = 3.0*alpha2 - 2.0*alpha3;
-      const double dbeta2 = 6.0*alpha*one_minus_alpha;
-      const double beta3 = alpha3;
-      const double dbeta3 = 3.0*alpha2;
-
-      const double one_third = 1.0 / 3.0;
-      const Eigen::Vector3d scaled_d_W_A = (one_third*dt_sec ) * d_W_A.getRotationalVelocity().vector();
-      const Eigen::Vector3d scaled_d_W_B = (one_third*dt_sec ) * d_W_B.getRotationalVelocity().vector();
-
-      const Eigen::Vector3d w1 = T_W_A.getRotation().inverseRotate(scaled_d_W_A);
-      const Eigen::Vector3d w3 = T_W_B.getRotation().inverseRotate(scaled_d_W_B);
-      const RotationQuaternion expW1_inv = RotationQuaternion().exponentialMap(-w1);
-      const RotationQuaternion expW3_inv = RotationQuaternion().exponentialMap(-w3);
-
-      const RotationQuaternion expW1_Inv_qWB_expW3 = expW1_inv * T_W_A.getRotation().inverted() * T_W_B.getRotation() * expW3_inv;
-
-      const Eigen::Vector3d w2 = expW1_Inv_qWB_expW3.logarithmicMap();
-
-      const SO3 w1_beta1_exp = RotationQuaternion().exponentialMap((beta1) * w1);
-      const SO3 w2_beta2_exp = RotationQuaternion().exponentialMap((beta2) * w2);
-      const SO3 w3_beta3_exp = RotationQuaternion().exponentialMap((beta3) * w3);
-
-      const RotationQuaternion w1_dbeta1(0.0, dbeta1 * w1);
-      const RotationQuaternion w2_dbeta2(0.0, dbeta2 * w2);
-      const RotationQuaternion w3_dbeta3(0.0, dbeta3 * w3);
-
-      const Eigen::Vector4d diff =    ((T_W_A.getRotation() * w1_beta1_exp * w1_dbeta1    * w2_beta2_exp * w3_beta3_exp).vector()
-                              + (T_W_A.getRotation() * w1_beta1_exp * w2_beta2_exp * w2_dbeta2    * w3_beta3_exp).vector()
-                              + (T_W_A.getRotation() * w1_beta1_exp * w2_beta2_exp * w3_beta3_exp * w3_dbeta3   ).vector())*one_over_dt_sec;
-
-      const RotationQuaternion qDiff(diff);
-      ValueType q;
-      if(!evaluate(q, time)) {
-        return false;
-      }
-      // This is the global angular velocity
-      const Eigen::Vector3d angularVelocity_rad_s = q.getRotation().rotate((q.getRotation().inverted()*qDiff).imaginary());
 
-      // note: unit of derivative is m/s for first 3 and rad/s for last 3 entries
+    // make alpha
+    double dt_sec = (b->first - a->first);
+    double alpha = double(time - a->first)/dt_sec;
 
-      derivative = DerivativeType(velocity_m_s, angularVelocity_rad_s);
-      return true;
-    }
-  }
-  else {
-    std::cerr << "CubicHermiteSE3Curve::evaluateDerivative: higher order derivatives are not implemented!";
-    return false;
+    interpolateCubicHermiteSE3Derivative(derivative,
+                                         a->second.coefficient.getTransformation(), a->second.coefficient.getTransformationDerivative(),
+                                         b->second.coefficient.getTransformation(), b->second.coefficient.getTransformationDerivative(),
+                                         dt_sec, alpha);
+    return true;
   }
 }
 
+void interpolateCubicHermiteSE3(SE3Config::ValueType& value,
+                                const SE3Config::ValueType& T_W_A, const SE3Config::DerivativeType& d_W_A,
+                                const SE3Config::ValueType& T_W_B, const SE3Config::DerivativeType& d_W_B,
+                                double dt_sec, double alpha) {
+  // Implemantation of Hermite Interpolation not easy and not fun (without expressions)!
+
+  // translational part (easy):
+  const double alpha2 = alpha * alpha;
+  const double alpha3 = alpha2 * alpha;
+
+  const double beta0 = 2.0 * alpha3 - 3.0 * alpha2 + 1.0;
+  const double beta1 = -2.0 * alpha3 + 3.0 * alpha2;
+  const double beta2 = alpha3 - 2.0 * alpha2 + alpha;
+  const double beta3 = alpha3 - alpha2;
+
+  /**************************************************************************************
+   *  Translational part:
+   **************************************************************************************/
+  const SE3::Position translation(T_W_A.getPosition().vector() * beta0
+                                + T_W_B.getPosition().vector() * beta1
+                                + d_W_A.getTranslationalVelocity().vector() * (beta2 * dt_sec)
+                                + d_W_B.getTranslationalVelocity().vector() * (beta3 * dt_sec));
+
+  /**************************************************************************************
+   *  Rotational part:
+   **************************************************************************************/
+  const double dt_sec_third = dt_sec / 3.0;
+  const Eigen::Vector3d scaled_d_W_A = dt_sec_third * d_W_A.getRotationalVelocity().vector();
+  const Eigen::Vector3d scaled_d_W_B = dt_sec_third * d_W_B.getRotationalVelocity().vector();
+
+  // d_W_A contains the global angular velocity, but we need the local angular velocity.
+  const Eigen::Vector3d w1 = T_W_A.getRotation().inverseRotate(scaled_d_W_A);
+  const Eigen::Vector3d w3 = T_W_B.getRotation().inverseRotate(scaled_d_W_B);
+  const RotationQuaternion expW1_inv = RotationQuaternion().exponentialMap(-w1);
+  const RotationQuaternion expW3_inv = RotationQuaternion().exponentialMap(-w3);
+  const RotationQuaternion expW1_Inv_qWB_expW3 = expW1_inv * T_W_A.getRotation().inverted() * T_W_B.getRotation() * expW3_inv;
+  const Eigen::Vector3d w2 = expW1_Inv_qWB_expW3.logarithmicMap();
+
+  const double dBeta1 = alpha3 - 3.0 * alpha2 + 3.0 * alpha;
+  const double dBeta2 = -2.0 * alpha3 + 3.0 * alpha2;
+  const double dBeta3 = alpha3;
+
+  const SO3 w1_dBeta1_exp = RotationQuaternion().exponentialMap(dBeta1 * w1);
+  const SO3 w2_dBeta2_exp = RotationQuaternion().exponentialMap(dBeta2 * w2);
+  const SO3 w3_dBeta3_exp = RotationQuaternion().exponentialMap(dBeta3 * w3);
+
+  const RotationQuaternion rotation = T_W_A.getRotation() * w1_dBeta1_exp * w2_dBeta2_exp * w3_dBeta3_exp;
+
+  value = SE3(translation, rotation);
+}
+
+void interpolateCubicHermiteSE3Derivative(SE3Config::DerivativeType& derivative,
+                                          const SE3Config::ValueType& T_W_A, const SE3Config::DerivativeType& d_W_A,
+                                          const SE3Config::ValueType& T_W_B, const SE3Config::DerivativeType& d_W_B,
+                                          double dt_sec, double alpha) {
+  const double one_over_dt_sec = 1.0/dt_sec;
+  const double alpha2 = alpha * alpha;
+  const double alpha3 = alpha2 * alpha;
+
+  /**************************************************************************************
+   *  Translational part:
+   **************************************************************************************/
+  // Implementation of translation
+  const double gamma0 = 6.0*(alpha2 - alpha);
+  const double gamma1 = 3.0*alpha2 - 4.0*alpha + 1.0;
+  const double gamma2 = 6.0*(alpha - alpha2);
+  const double gamma3 = 3.0*alpha2 - 2.0*alpha;
+
+  const Eigen::Vector3d velocity_m_s = T_W_A.getPosition().vector()*(gamma0*one_over_dt_sec)
+                                     + d_W_A.getTranslationalVelocity().vector()*(gamma1)
+                                     + T_W_B.getPosition().vector()*(gamma2*one_over_dt_sec)
+                                     + d_W_B.getTranslationalVelocity().vector()*(gamma3);
+
+
+  /**************************************************************************************
+   *  Rotational part:
+   **************************************************************************************/
+  const double one_minus_alpha = (1.0 - alpha);
+  const double one_minus_alpha_2 = one_minus_alpha * one_minus_alpha;
+  const double one_minus_alpha_3 = one_minus_alpha * one_minus_alpha_2;
+
+  const double beta1 = 1.0 - one_minus_alpha_3;
+  const double dbeta1 = 3.0*one_minus_alpha_2;
+  const double beta2 = 3.0*alpha2 - 2.0*alpha3;
+  const double dbeta2 = 6.0*alpha*one_minus_alpha;
+  const double beta3 = alpha3;
+  const double dbeta3 = 3.0*alpha2;
+
+  const double one_third = 1.0 / 3.0;
+  const Eigen::Vector3d scaled_d_W_A = (one_third*dt_sec ) * d_W_A.getRotationalVelocity().vector();
+  const Eigen::Vector3d scaled_d_W_B = (one_third*dt_sec ) * d_W_B.getRotationalVelocity().vector();
+
+  const Eigen::Vector3d w1 = T_W_A.getRotation().inverseRotate(scaled_d_W_A);
+  const Eigen::Vector3d w3 = T_W_B.getRotation().inverseRotate(scaled_d_W_B);
+  const RotationQuaternion expW1_inv = RotationQuaternion().exponentialMap(-w1);
+  const RotationQuaternion expW3_inv = RotationQuaternion().exponentialMap(-w3);
+
+  const RotationQuaternion expW1_Inv_qWB_expW3 = expW1_inv * T_W_A.getRotation().inverted() * T_W_B.getRotation() * expW3_inv;
+
+  const Eigen::Vector3d w2 = expW1_Inv_qWB_expW3.logarithmicMap();
+
+  const SO3 w1_beta1_exp = RotationQuaternion().exponentialMap((beta1) * w1);
+  const SO3 w2_beta2_exp = RotationQuaternion().exponentialMap((beta2) * w2);
+  const SO3 w3_beta3_exp = RotationQuaternion().exponentialMap((beta3) * w3);
+
+  const RotationQuaternion w1_dbeta1(0.0, dbeta1 * w1);
+  const RotationQuaternion w2_dbeta2(0.0, dbeta2 * w2);
+  const RotationQuaternion w3_dbeta3(0.0, dbeta3 * w3);
+
+  const Eigen::Vector4d diff =    ((T_W_A.getRotation() * w1_beta1_exp * w1_dbeta1    * w2_beta2_exp * w3_beta3_exp).vector()
+                          + (T_W_A.getRotation() * w1_beta1_exp * w2_beta2_exp * w2_dbeta2    * w3_beta3_exp).vector()
+                          + (T_W_A.getRotation() * w1_beta1_exp * w2_beta2_exp * w3_beta3_exp * w3_dbeta3   ).vector())*one_over_dt_sec;
+
+  const RotationQuaternion qDiff(diff);
+  SE3Config::ValueType q;
+  interpolateCubicHermiteSE3(q, T_W_A, d_W_A, T_W_B, d_W_B, dt_sec, alpha);
+  // This is the global angular velocity
+  const Eigen::Vector3d angularVelocity_rad_s = q.getRotation().rotate((q.getRotation().inverted()*qDiff).imaginary());
+
+  // note: unit of derivative is m/s for first 3 and rad/s for last 3 entries
+
+  derivative = SE3Config::DerivativeType(velocity_m_s, angularVelocity_rad_s);
+}
+
 bool CubicHermiteSE3Curve::evaluateLinearAcceleration(kindr::Acceleration3D& linearAcceleration, Time time) {
 
+  const double timeFactor = timeTransform_.getDerivativeFactor(2);
+  time = timeTransform_.toCurveTime(time);
+
   CoefficientIter a, b;
   bool success = manager_.getCoefficientsAt(time, &a, &b);
   if(!success) {
@@ -407,8 +540,8 @@ bool CubicHermiteSE3Curve::evaluateLinearAcceleration(kindr::Acceleration3D& lin
   const double d_gamma2 = 6.0*(1.0 - 2.0*alpha)*d_alpha;
   const double d_gamma3 = (6.0*alpha - 2.0)*d_alpha;
 
-  linearAcceleration = kindr::Acceleration3D(T_W_A.getPosition().vector()*d_gamma0*one_over_dt_sec + d_W_A.getTranslationalVelocity().vector()*d_gamma1 +
-                                             T_W_B.getPosition().vector()*d_gamma2*one_over_dt_sec + d_W_B.getTranslationalVelocity().vector()*d_gamma3);
+  linearAcceleration = kindr::Acceleration3D((T_W_A.getPosition().vector()*d_gamma0*one_over_dt_sec + d_W_A.getTranslationalVelocity().vector()*d_gamma1 +
+                                              T_W_B.getPosition().vector()*d_gamma2*one_over_dt_sec + d_W_B.getTranslationalVelocity().vector()*d_gamma3)*timeFactor);
 
 
   return true;
@@ -494,6 +627,34 @@ void CubicHermiteSE3Curve::setTimeRange(Time minTime, Time maxTime) {
   CHECK(false) << "Not implemented";
 }
 
+void CubicHermiteSE3Curve::transformTime(double scale, double offset) {
+  timeTransform_.compose(scale, offset);
+}
+
+const TimeAffineTransform& CubicHermiteSE3Curve::getTimeTransform() const {
+  return timeTransform_;
+}
+
+bool CubicHermiteSE3Curve::insertKnot(Time time, Key* outKey) {
+  const Time curveTime = timeTransform_.toCurveTime(time);
+  if (manager_.size() < 2 || curveTime <= manager_.getMinTime() || curveTime >= manager_.getMaxTime()
+      || manager_.hasCoefficientAtTime(curveTime)) {
+    return false;
+  }
+
+  // The coefficients are stored in curve time, hence the unscaled derivative.
+  ValueType value;
+  DerivativeType derivative;
+  if (!evaluateAtCurveTime(value, curveTime) || !evaluateDerivativeAtCurveTime(derivative, curveTime)) {
+    return false;
+  }
+  const Key key = manager_.insertCoefficient(curveTime, Coefficient(value, derivative));
+  if (outKey != NULL) {
+    *outKey = key;
+  }
+  return true;
+}
+
 /// \brief Evaluate the angular velocity of Frame b as seen from Frame a, expressed in Frame a.
 Eigen::Vector3d CubicHermiteSE3Curve::evaluateAngularVelocityA(Time time) {
   CHECK(false) << "Not implemented";
@@ -562,6 +723,7 @@ void CubicHermiteSE3Curve::setSamplingRatio(const int ratio) {
 
 void CubicHermiteSE3Curve::clear() {
   manager_.clear();
+  timeTransform_.reset();
 }
 
 void CubicHermiteSE3Curve::transformCurve(const ValueType T) {
@@ -570,7 +732,7 @@ void CubicHermiteSE3Curve::transformCurve(const ValueType T) {
 
 void CubicHermiteSE3Curve::saveCurveTimesAndValues(const std::string& filename) const {
   std::vector<Time> curveTimes;
-  manager_.getTimes(&curveTimes);
+  getCurveTimes(&curveTimes);
 
   saveCurveAtTimes(filename, curveTimes);
 }
@@ -592,6 +754,9 @@ void CubicHermiteSE3Curve::saveCurveAtTimes(const std::string& filename, std::ve
 
 void CubicHermiteSE3Curve::getCurveTimes(std::vector<Time>* outTimes) const {
   manager_.getTimes(outTimes);
+  for (auto& time : *outTimes) {
+    time = timeTransform_.fromCurveTime(time);
+  }
 }
 
 } // namespace curves
@@ -5,13 +5,15 @@
  */
 
 #include <curves/DiscreteSE3Curve.hpp>
-#include <iostream>
+#include <curves/helpers.hpp>
 
-#include "gtsam/nonlinear/ExpressionFactor.h"
+#include <cmath>
+#include <iostream>
+#include <iterator>
 
 namespace curves {
 
-DiscreteSE3Curve::DiscreteSE3Curve() : SE3Curve() {}
+DiscreteSE3Curve::DiscreteSE3Curve() : SE3Curve(), indexRevision_(0) {}
 
 DiscreteSE3Curve::~DiscreteSE3Curve() {}
 
@@ -29,18 +31,17 @@ void DiscreteSE3Curve::print(const std::string& str) const {
   std::cout << "curve defined between times: " << manager_.getMinTime() <<
       " and " << manager_.getMaxTime() <<std::endl;
   double sum_dp = 0;
-  Eigen::Vector3d p1, p2;
-  for(size_t i = 0; i < times.size()-1; ++i) {
-    p1 = evaluate(times[i]).getPosition();
-    p2 = evaluate(times[i+1]).getPosition();
-    sum_dp += (p1-p2).norm();
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    CoefficientIter next = it;
+    if (++next != manager_.coefficientEnd()) {
+      sum_dp += (next->second.coefficient.getPosition().vector() - it->second.coefficient.getPosition().vector()).norm();
+    }
   }
   std::cout << "average dt between coefficients: " << (manager_.getMaxTime() -manager_.getMinTime())  / (times.size()-1) << " ns." << std::endl;
   std::cout << "average distance between coefficients: " << sum_dp / double((times.size()-1))<< " m." << std::endl;
   std::cout <<"=========================================" <<std::endl;
   for (size_t i = 0; i < manager_.size(); i++) {
     ss << "coefficient " << keys[i] << ": ";
-    gtsam::traits<Coefficient>::Print(manager_.getCoefficientByKey(keys[i]),ss.str());
     std::cout << " | time: " << times[i];
     std::cout << std::endl;
     ss.str("");
@@ -71,6 +72,7 @@ void DiscreteSE3Curve::fitCurve(const std::vector<Time>& times,
   if(times.size() > 0) {
     clear();
     manager_.insertCoefficients(times,values, outKeys);
+    rebuildIndex();
   }
 }
 
@@ -79,6 +81,7 @@ void DiscreteSE3Curve::setCurve(const std::vector<Time>& times,
   CHECK_EQ(times.size(), values.size());
   if(times.size() > 0) {
     manager_.insertCoefficients(times,values);
+    rebuildIndex();
   }
 }
 
@@ -88,87 +91,149 @@ void DiscreteSE3Curve::extend(const std::vector<Time>& times,
                            std::vector<Key>* outKeys) {
 
   CHECK_EQ(times.size(), values.size()) << "number of times and number of coefficients don't match";
+
+  // The sampling policy appends knots and may move the last one, the index is updated from the
+  // last knot on instead of being rebuilt.
+  const Time begTime = manager_.empty() ? 0 : manager_.getMaxTime();
   discretePolicy_.extend<DiscreteSE3Curve, ValueType>(times, values, this, outKeys);
+  updateIndex(begTime);
 }
 
-typename DiscreteSE3Curve::DerivativeType
-DiscreteSE3Curve::evaluateDerivative(Time time,
-                                  unsigned derivativeOrder) const {
-
-  // time is out of bound --> error
-  CHECK_GE(time, this->getMinTime()) << "Time out of bounds";
-  CHECK_LE(time, this->getMaxTime()) << "Time out of bounds";
-
-  Eigen::VectorXd dCoeff;
-  Time dt;
-  CoefficientIter rval0, rval1;
-  bool success = manager_.getCoefficientsAt(time, &rval0, &rval1);
-  CHECK(success) << "Unable to get the coefficients at time " << time;
-  // first derivative
-  if (derivativeOrder == 1) {
-    //todo Verify this
-    dCoeff = gtsam::traits<Coefficient>::Local(rval1->second.coefficient,rval0->second.coefficient);
-    dt = rval1->first - rval0->first;
-    return dCoeff/dt;
-    // order of derivative > 1 returns vector of zeros
-  } else {
-    const int dimension = gtsam::traits<Coefficient>::dimension;
-    return Eigen::VectorXd::Zero(dimension,1);
+void DiscreteSE3Curve::rebuildIndex() {
+  knots_.clear();
+  knots_.reserve(manager_.size());
+  std::vector<Time> times;
+  times.reserve(manager_.size());
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    knots_.push_back(it);
+    times.push_back(it->first);
   }
+  index_.build(times);
+  indexRevision_ = manager_.getRevision();
 }
 
-/// \brief forms slerp interpolation into a binary expression with 2 leafs and binds alpha into it,
-///        uses break down of expression into its operations
-///        \f[ T = A(A^{-1}B)^{\alpha} \f]
-gtsam::Expression<typename DiscreteSE3Curve::ValueType>
-DiscreteSE3Curve::getValueExpression(const Time& time) const {
-  typedef typename DiscreteSE3Curve::ValueType ValueType;
-  using namespace gtsam;
-  CoefficientIter a, b;
-  bool success = manager_.getCoefficientsAt(time, &a, &b);
-  CHECK(success) << "Unable to get the coefficients at time " << time;
-  Expression<ValueType> leaf_a(a->second.key);
-  Expression<ValueType> leaf_b(b->second.key);
-
-  // If the time is closer to a
-  if (b->first - time >= time - a->first) {
-    return leaf_a;
-  } else {
-    return leaf_b;
+void DiscreteSE3Curve::updateIndex(Time begTime) {
+  if (indexRevision_ == manager_.getRevision()) {
+    return;
+  }
+  // The iterators of the removed knots are dropped without being dereferenced.
+  while (!index_.empty() && index_.getTime(index_.size() - 1) >= begTime) {
+    knots_.pop_back();
+    index_.pop_back();
   }
+  CoefficientIter it = knots_.empty() ? manager_.coefficientBegin() : std::next(knots_.back());
+  for (; it != manager_.coefficientEnd(); ++it) {
+    knots_.push_back(it);
+    index_.push_back(it->first);
+  }
+  // Coefficients inserted before begTime require a rebuild.
+  if (knots_.size() != manager_.size()) {
+    rebuildIndex();
+    return;
+  }
+  indexRevision_ = manager_.getRevision();
+}
 
+void DiscreteSE3Curve::checkIndex() const {
+  CHECK_EQ(indexRevision_, manager_.getRevision()) << "The knots were modified without updating the index.";
 }
 
-gtsam::Expression<typename DiscreteSE3Curve::DerivativeType>
-DiscreteSE3Curve::getDerivativeExpression(const Time& time, unsigned derivativeOrder) const {
-  // \todo Abel and Renaud
-  CHECK(false) << "Not implemented";
+bool DiscreteSE3Curve::getPreviousKnot(Time time, Time* knotTime, ValueType* value) const {
+  CHECK_NOTNULL(knotTime);
+  checkIndex();
+  size_t index;
+  if (!index_.getPreviousKnot(time, &index)) {
+    return false;
+  }
+  getKnot(index, knotTime, value);
+  return true;
+}
+
+bool DiscreteSE3Curve::getNearestKnot(Time time, Time* knotTime, ValueType* value) const {
+  CHECK_NOTNULL(knotTime);
+  checkIndex();
+  size_t index;
+  if (!index_.getNearestKnot(time, &index)) {
+    return false;
+  }
+  getKnot(index, knotTime, value);
+  return true;
+}
+
+size_t DiscreteSE3Curve::associate(const std::vector<Time>& times, Time maxTimeDifference,
+                                   std::vector<int>* outKnotIndices) const {
+  CHECK_NOTNULL(outKnotIndices);
+  checkIndex();
+  outKnotIndices->assign(times.size(), -1);
+  size_t numAssociated = 0;
+  size_t index;
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (index_.getNearestKnot(times[i], &index)
+        && std::abs(index_.getTime(index) - times[i]) <= maxTimeDifference) {
+      (*outKnotIndices)[i] = static_cast<int>(index);
+      ++numAssociated;
+    }
+  }
+  return numAssociated;
+}
+
+void DiscreteSE3Curve::getKnot(size_t index, Time* knotTime, ValueType* value, Key* key) const {
+  checkIndex();
+  CHECK_LT(index, knots_.size()) << "No knot with index " << index;
+  const CoefficientIter& it = knots_[index];
+  if (knotTime != NULL) {
+    *knotTime = it->first;
+  }
+  if (value != NULL) {
+    *value = it->second.coefficient;
+  }
+  if (key != NULL) {
+    *key = it->second.key;
+  }
+}
+
+bool DiscreteSE3Curve::evaluate(ValueType& value, Time time) const {
+  if (manager_.empty() || time < manager_.getMinTime() || time > manager_.getMaxTime()) {
+    return false;
+  }
+  Time knotTime;
+  return getNearestKnot(time, &knotTime, &value);
 }
 
-SE3 DiscreteSE3Curve::evaluate(Time time) const {
-  // Check if the curve is only defined at this one time
-  if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
-    return manager_.coefficientBegin()->second.coefficient;
-  } else {
-    if (time == manager_.getMaxTime()) {
-      // Efficient evaluation of a curve end
-      return (--manager_.coefficientEnd())->second.coefficient;
-    } else {
-// Pure discrete
-      CoefficientIter a, b;
-      bool success = manager_.getCoefficientsAt(time, &a, &b);
-      CHECK(success) << "Unable to get the coefficients at time " << time;
-      SE3 T_W_A = a->second.coefficient;
-      SE3 T_W_B = b->second.coefficient;
-
-      // If the time is closer to a
-      if (b->first - time >= time - a->first) {
-        return T_W_A;
-      } else {
-        return T_W_B;
-      }
+bool DiscreteSE3Curve::evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const {
+  values.resize(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (!evaluate(values[i], times[i])) {
+      return false;
     }
   }
+  return true;
+}
+
+bool DiscreteSE3Curve::evaluateDerivative(DerivativeType& derivative, Time time,
+                                          unsigned derivativeOrder) const {
+  if (manager_.empty() || time < manager_.getMinTime() || time > manager_.getMaxTime()) {
+    return false;
+  }
+  // order of derivative > 1 returns vector of zeros
+  if (derivativeOrder != 1 || manager_.size() == 1) {
+    derivative = DerivativeType();
+    return true;
+  }
+  checkIndex();
+  size_t index;
+  CHECK(index_.getPreviousKnot(time, &index));
+  // On the last coefficient the slope of the last segment is taken.
+  if (index + 1 == knots_.size()) {
+    --index;
+  }
+  const CoefficientIter a = knots_[index];
+  const CoefficientIter b = knots_[index + 1];
+  const double inverseDt = 1.0 / (b->first - a->first);
+  derivative = DerivativeType(
+      (b->second.coefficient.getPosition().vector() - a->second.coefficient.getPosition().vector()) * inverseDt,
+      b->second.coefficient.getRotation().boxMinus(a->second.coefficient.getRotation()) * inverseDt);
+  return true;
 }
 
 void DiscreteSE3Curve::setTimeRange(Time minTime, Time maxTime) {
@@ -233,18 +298,6 @@ Vector6d DiscreteSE3Curve::evaluateDerivativeB(unsigned derivativeOrder, Time ti
   CHECK(false) << "Not implemented";
 }
 
-void DiscreteSE3Curve::initializeGTSAMValues(gtsam::KeySet keys, gtsam::Values* values) const {
-  manager_.initializeGTSAMValues(keys, values);
-}
-
-void DiscreteSE3Curve::initializeGTSAMValues(gtsam::Values* values) const {
-  manager_.initializeGTSAMValues(values);
-}
-
-void DiscreteSE3Curve::updateFromGTSAMValues(const gtsam::Values& values) {
-  manager_.updateFromGTSAMValues(values);
-}
-
 void DiscreteSE3Curve::setMinSamplingPeriod(Time time) {
   discretePolicy_.setMinSamplingPeriod(time);
 }
@@ -256,46 +309,21 @@ void DiscreteSE3Curve::setSamplingRatio(const int ratio) {
 
 void DiscreteSE3Curve::clear() {
   manager_.clear();
-}
-
-void DiscreteSE3Curve::addPriorFactors(gtsam::NonlinearFactorGraph* graph, Time priorTime) const {
-  Eigen::Matrix<double,6,1> noise;
-  noise(0) = 0.0000001;
-  noise(1) = 0.0000001;
-  noise(2) = 0.0000001;
-  noise(3) = 0.0000001;
-  noise(4) = 0.0000001;
-  noise(5) = 0.0000001;
-
-  gtsam::noiseModel::Diagonal::shared_ptr priorNoise = gtsam::noiseModel::Diagonal::
-        Sigmas(noise);
-
-
-
-  CoefficientIter rVal0, rVal1;
-  manager_.getCoefficientsAt(priorTime, &rVal0, &rVal1);
-
-  gtsam::ExpressionFactor<Coefficient> f0(priorNoise,
-                                          rVal0->second.coefficient,
-                                          gtsam::Expression<Coefficient>(rVal0->second.key));
-  gtsam::ExpressionFactor<Coefficient> f1(priorNoise,
-                                          rVal1->second.coefficient,
-                                          gtsam::Expression<Coefficient>(rVal1->second.key));
-  graph->push_back(f0);
-  graph->push_back(f1);
-
+  rebuildIndex();
 }
 
 void DiscreteSE3Curve::transformCurve(const ValueType T) {
   std::vector<Time> coefTimes;
-  manager_.getTimes(&coefTimes);
-  for (size_t i = 0; i < coefTimes.size(); ++i) {
+  std::vector<ValueType> coefValues;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
     // Apply a rigid transformation to every coefficient (on the left side).
-    manager_.insertCoefficient(coefTimes[i],T*evaluate(coefTimes[i]));
+    coefTimes.push_back(it->first);
+    coefValues.push_back(T*it->second.coefficient);
   }
+  manager_.modifyCoefficientsValuesInBatch(coefTimes, coefValues);
 }
 
-Time DiscreteSE3Curve::getTimeAtKey(gtsam::Key key) const {
+Time DiscreteSE3Curve::getTimeAtKey(Key key) const {
   return manager_.getCoefficientTimeByKey(key);
 }
 
@@ -312,7 +340,7 @@ void DiscreteSE3Curve::saveCurveAtTimes(const std::string& filename, std::vector
   std::vector<Eigen::VectorXd> curveValues;
   ValueType val;
   for (size_t i = 0; i < times.size(); ++i) {
-    val = evaluate(times[i]);
+    evaluate(val, times[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     curveValues.push_back(v);
@@ -0,0 +1,136 @@
+/*
+ * GaussianProcessSE3Curve.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <iostream>
+#include <glog/logging.h>
+
+#include "curves/GaussianProcessSE3Curve.hpp"
+
+namespace curves {
+
+GaussianProcessSE3Curve::GaussianProcessSE3Curve(double translationalPowerSpectralDensity,
+                                                 double rotationalPowerSpectralDensity,
+                                                 double positionVariance,
+                                                 double rotationVariance)
+    : Curve<SE3Config>()
+{
+  translation_.setPowerSpectralDensity(translationalPowerSpectralDensity);
+  rotation_.setPowerSpectralDensity(rotationalPowerSpectralDensity);
+  setMeasurementVariances(positionVariance, rotationVariance);
+}
+
+GaussianProcessSE3Curve::~GaussianProcessSE3Curve() {}
+
+void GaussianProcessSE3Curve::print(const std::string& str) const {
+  std::cout << "=========================================" << std::endl;
+  std::cout << "==== Gaussian process SE3 CURVE =========" << std::endl;
+  std::cout << str << std::endl;
+  std::cout << "number of states: " << translation_.size() << std::endl;
+  std::cout << "power spectral densities: " << translation_.getPowerSpectralDensity() << " (translation), "
+      << rotation_.getPowerSpectralDensity() << " (rotation)" << std::endl;
+  std::cout << "measurement variances: " << positionVariance_ << " (position), "
+      << rotationVariance_ << " (rotation)" << std::endl;
+}
+
+Time GaussianProcessSE3Curve::getMinTime() const {
+  return translation_.getMinTime();
+}
+
+Time GaussianProcessSE3Curve::getMaxTime() const {
+  return translation_.getMaxTime();
+}
+
+bool GaussianProcessSE3Curve::isEmpty() const {
+  return translation_.isEmpty();
+}
+
+int GaussianProcessSE3Curve::size() const {
+  return translation_.size();
+}
+
+bool GaussianProcessSE3Curve::evaluate(ValueType& value, Time time) const {
+  Eigen::Vector3d position;
+  GaussianProcessRotationSpace::ValueType rotation;
+  if (!translation_.interpolate(time, position) || !rotation_.interpolate(time, rotation)) {
+    return false;
+  }
+  value = ValueType(ValueType::Position(position), rotation);
+  return true;
+}
+
+bool GaussianProcessSE3Curve::evaluateDerivative(DerivativeType& derivative, Time time,
+                                                 unsigned int derivativeOrder) const {
+  if (derivativeOrder != 1) {
+    return false;
+  }
+  Eigen::Vector3d position, velocity, angularVelocity;
+  GaussianProcessRotationSpace::ValueType rotation;
+  if (!translation_.interpolate(time, position, &velocity) || !rotation_.interpolate(time, rotation, &angularVelocity)) {
+    return false;
+  }
+  derivative = DerivativeType(velocity, angularVelocity);
+  return true;
+}
+
+bool GaussianProcessSE3Curve::evaluateVariance(double& positionVariance, double& rotationVariance, Time time) const {
+  return translation_.getVariance(time, positionVariance) && rotation_.getVariance(time, rotationVariance);
+}
+
+void GaussianProcessSE3Curve::addMeasurement(Time time, const ValueType& value,
+                                             double positionVariance, double rotationVariance) {
+  translation_.addMeasurement(time, value.getPosition().vector(), positionVariance);
+  rotation_.addMeasurement(time, value.getRotation(), rotationVariance);
+}
+
+void GaussianProcessSE3Curve::extend(const std::vector<Time>& times,
+                                     const std::vector<ValueType>& values,
+                                     std::vector<Key>* outKeys) {
+  CHECK_EQ(times.size(), values.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    translation_.addMeasurement(times[i], values[i].getPosition().vector(), positionVariance_, false);
+    rotation_.addMeasurement(times[i], values[i].getRotation(), rotationVariance_, false);
+  }
+  translation_.smooth();
+  rotation_.smooth();
+}
+
+void GaussianProcessSE3Curve::fitCurve(const std::vector<Time>& times,
+                                       const std::vector<ValueType>& values,
+                                       std::vector<Key>* outKeys) {
+  clear();
+  extend(times, values, outKeys);
+}
+
+void GaussianProcessSE3Curve::setMeasurementVariances(double positionVariance, double rotationVariance) {
+  CHECK_GT(positionVariance, 0.0);
+  CHECK_GT(rotationVariance, 0.0);
+  positionVariance_ = positionVariance;
+  rotationVariance_ = rotationVariance;
+}
+
+void GaussianProcessSE3Curve::setSmoothingTolerance(double smoothingTolerance) {
+  translation_.setSmoothingTolerance(smoothingTolerance);
+  rotation_.setSmoothingTolerance(smoothingTolerance);
+}
+
+const GaussianProcessSE3Curve::TranslationTrajectory& GaussianProcessSE3Curve::getTranslationTrajectory() const {
+  return translation_;
+}
+
+const GaussianProcessSE3Curve::RotationTrajectory& GaussianProcessSE3Curve::getRotationTrajectory() const {
+  return rotation_;
+}
+
+void GaussianProcessSE3Curve::clear() {
+  translation_.clear();
+  rotation_.clear();
+}
+
+void GaussianProcessSE3Curve::transformCurve(const ValueType T) {
+  CHECK(false) << "Not implemented";
+}
+
+} // namespace curves
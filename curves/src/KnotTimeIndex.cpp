@@ -0,0 +1,120 @@
+/*
+ * KnotTimeIndex.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+
+#include <glog/logging.h>
+
+#include "curves/KnotTimeIndex.hpp"
+
+namespace curves {
+
+KnotTimeIndex::KnotTimeIndex()
+    : origin_(0.0),
+      inverseBucketWidth_(0.0),
+      bucketsBuiltSize_(0) {
+  bucketBegin_.push_back(0);
+}
+
+void KnotTimeIndex::build(const std::vector<Time>& times) {
+  for (size_t i = 1; i < times.size(); ++i) {
+    CHECK_GT(times[i], times[i-1]) << "The knot times have to be strictly increasing.";
+  }
+  times_ = times;
+  rebuildBuckets();
+}
+
+void KnotTimeIndex::push_back(Time time) {
+  CHECK(times_.empty() || time > times_.back()) << "Knots can only be appended after the last knot.";
+  times_.push_back(time);
+  const size_t numKnots = times_.size();
+  const double bucket = (time - origin_) * inverseBucketWidth_;
+  if (inverseBucketWidth_ == 0.0 || numKnots > 2 * bucketsBuiltSize_ || bucket > 2.0 * numKnots) {
+    rebuildBuckets();
+    return;
+  }
+  // The new knot is the first one of all buckets up to its own.
+  bucketBegin_.pop_back();
+  while (bucketBegin_.size() <= static_cast<size_t>(bucket)) {
+    bucketBegin_.push_back(numKnots - 1);
+  }
+  bucketBegin_.push_back(numKnots);
+}
+
+void KnotTimeIndex::pop_back() {
+  CHECK(!times_.empty()) << "The index is empty.";
+  times_.pop_back();
+  const size_t numKnots = times_.size();
+  if (numKnots == 0) {
+    clear();
+    return;
+  }
+  // Drop the buckets that started with the removed knot, the first bucket always starts with knot 0.
+  bucketBegin_.pop_back();
+  while (bucketBegin_.back() == numKnots) {
+    bucketBegin_.pop_back();
+  }
+  bucketBegin_.push_back(numKnots);
+}
+
+void KnotTimeIndex::clear() {
+  times_.clear();
+  rebuildBuckets();
+}
+
+bool KnotTimeIndex::getPreviousKnot(Time time, size_t* index) const {
+  CHECK_NOTNULL(index);
+  if (times_.empty() || time < times_.front()) {
+    return false;
+  }
+  // Knots of earlier buckets are before the time and knots of later buckets after it.
+  const size_t bucket = getBucket(time);
+  const std::vector<Time>::const_iterator begin = times_.begin() + bucketBegin_[bucket];
+  const std::vector<Time>::const_iterator end = times_.begin() + bucketBegin_[bucket + 1];
+  *index = std::upper_bound(begin, end, time) - times_.begin() - 1;
+  return true;
+}
+
+bool KnotTimeIndex::getNearestKnot(Time time, size_t* index) const {
+  CHECK_NOTNULL(index);
+  if (times_.empty()) {
+    return false;
+  }
+  if (!getPreviousKnot(time, index)) {
+    *index = 0;
+    return true;
+  }
+  if (*index + 1 < times_.size() && times_[*index + 1] - time < time - times_[*index]) {
+    ++*index;
+  }
+  return true;
+}
+
+size_t KnotTimeIndex::getBucket(Time time) const {
+  const double bucket = (time - origin_) * inverseBucketWidth_;
+  const size_t lastBucket = bucketBegin_.size() - 2;
+  if (!(bucket > 0.0)) {
+    return 0;
+  }
+  return bucket >= lastBucket ? lastBucket : static_cast<size_t>(bucket);
+}
+
+void KnotTimeIndex::rebuildBuckets() {
+  const size_t numKnots = times_.size();
+  bucketBegin_.clear();
+  origin_ = numKnots > 0 ? times_.front() : 0.0;
+  inverseBucketWidth_ = numKnots > 1 ? (numKnots - 1) / (times_.back() - times_.front()) : 0.0;
+  for (size_t i = 0; i < numKnots; ++i) {
+    const size_t bucket = static_cast<size_t>((times_[i] - origin_) * inverseBucketWidth_);
+    while (bucketBegin_.size() <= bucket) {
+      bucketBegin_.push_back(i);
+    }
+  }
+  bucketBegin_.push_back(numKnots);
+  bucketsBuiltSize_ = numKnots;
+}
+
+} // namespace curves
@@ -6,28 +6,136 @@
 
 #include <curves/SE3CurveFactory.hpp>
 
+#include <new>
+
 namespace curves {
 
+namespace {
+
+struct RegistryEntry {
+  const char* name;
+  SE3Curve* (*construct)(void* storage);
+  SE3Curve* (*allocate)();
+};
+
+template <class CurveType>
+SE3Curve* constructCurveOfType(void* storage) {
+  return new (storage) CurveType();
+}
+
+template <class CurveType>
+SE3Curve* allocateCurveOfType() {
+  return new CurveType();
+}
+
+/// Fills the table with the registered types, one entry per SE3CurveType.
+template <int Type>
+struct RegistryBuilder {
+  static void fill(RegistryEntry* table) {
+    typedef SE3CurveTypeTraits<static_cast<SE3CurveType>(Type)> Traits;
+    table[Type].name = Traits::getName();
+    table[Type].construct = &constructCurveOfType<typename Traits::Curve>;
+    table[Type].allocate = &allocateCurveOfType<typename Traits::Curve>;
+    RegistryBuilder<Type + 1>::fill(table);
+  }
+};
+
+template <>
+struct RegistryBuilder<kNumSE3CurveTypes> {
+  static void fill(RegistryEntry* table) {}
+};
+
+struct Registry {
+  Registry() {
+    RegistryBuilder<0>::fill(entries);
+  }
+
+  RegistryEntry entries[kNumSE3CurveTypes];
+};
+
+const RegistryEntry& getRegistryEntry(SE3CurveType type) {
+  static const Registry registry;
+  CHECK(type >= 0 && type < kNumSE3CurveTypes) << "Invalid curve type " << type << ".";
+  return registry.entries[type];
+}
+
+} // namespace
+
 std::shared_ptr<SE3Curve> SE3CurveFactory::create_curve(const std::string& curveType) {
-  std::shared_ptr<SE3Curve> curve;
-
-  std::cout << "Curve factory is creating a " << curveType << "." << std::endl;
-
-  if(curveType == "slerp_curve") {
-    curve = std::shared_ptr<SE3Curve>(new SlerpSE3Curve());
-  } else if(curveType == "discrete_curve") {
-    curve = std::shared_ptr<SE3Curve>(new DiscreteSE3Curve());
-  } else if(curveType == "composition_curve") {
-    curve = std::shared_ptr<SE3Curve>(new SE3CompositionCurve<SlerpSE3Curve, SlerpSE3Curve>());
-  } else if(curveType == "discrete_composition_curve") {
-    curve = std::shared_ptr<SE3Curve>(new SE3CompositionCurve<DiscreteSE3Curve, DiscreteSE3Curve>());
-  } else if(curveType == "semi_discrete_composition_curve") {
-    curve = std::shared_ptr<SE3Curve>(new SE3CompositionCurve<SemiDiscreteSE3Curve, SemiDiscreteSE3Curve>());
-  } else {
-    CHECK(false) << "This curve is not implemented.";
+  SE3CurveType type;
+  CHECK(getCurveType(curveType, &type)) << "This curve is not implemented: " << curveType << ".";
+  return createCurve(type);
+}
+
+std::shared_ptr<SE3Curve> SE3CurveFactory::createCurve(SE3CurveType type) {
+  return std::shared_ptr<SE3Curve>(getRegistryEntry(type).allocate());
+}
+
+SE3Curve* SE3CurveFactory::constructCurve(SE3CurveType type, Storage* storage) {
+  CHECK_NOTNULL(storage);
+  return getRegistryEntry(type).construct(storage);
+}
+
+void SE3CurveFactory::destroyCurve(SE3Curve* curve) {
+  if (curve != NULL) {
+    curve->~SE3Curve();
+  }
+}
+
+bool SE3CurveFactory::getCurveType(const std::string& name, SE3CurveType* type) {
+  CHECK_NOTNULL(type);
+  for (int i = 0; i < kNumSE3CurveTypes; ++i) {
+    if (name == getRegistryEntry(static_cast<SE3CurveType>(i)).name) {
+      *type = static_cast<SE3CurveType>(i);
+      return true;
+    }
   }
+  return false;
+}
+
+const char* SE3CurveFactory::getCurveName(SE3CurveType type) {
+  return getRegistryEntry(type).name;
+}
+
+void SE3CurvePool::Deleter::operator()(SE3Curve* curve) const {
+  SE3CurveFactory::destroyCurve(curve);
+  if (pool_ != NULL) {
+    pool_->release(storage_);
+  }
+}
+
+SE3CurvePool::SE3CurvePool(size_t blocksPerChunk)
+    : blocksPerChunk_(blocksPerChunk) {
+  CHECK_GT(blocksPerChunk, 0u);
+}
+
+SE3CurvePool::~SE3CurvePool() {
+  CHECK_EQ(getNumFreeBlocks(), getCapacity()) << "Curves of the pool are still in use.";
+}
+
+SE3CurvePool::CurvePtr SE3CurvePool::createCurve(SE3CurveType type) {
+  if (freeBlocks_.empty()) {
+    chunks_.push_back(Chunk(blocksPerChunk_));
+    Chunk& chunk = chunks_.back();
+    for (size_t i = chunk.size(); i > 0; --i) {
+      freeBlocks_.push_back(&chunk[i - 1]);
+    }
+  }
+  Storage* storage = freeBlocks_.back();
+  freeBlocks_.pop_back();
+  return CurvePtr(SE3CurveFactory::constructCurve(type, storage), Deleter(this, storage));
+}
+
+size_t SE3CurvePool::getCapacity() const {
+  return chunks_.size() * blocksPerChunk_;
+}
+
+size_t SE3CurvePool::getNumFreeBlocks() const {
+  return freeBlocks_.size();
+}
 
-  return curve;
+void SE3CurvePool::release(Storage* storage) {
+  freeBlocks_.push_back(storage);
 }
 
 }  // namespace curves
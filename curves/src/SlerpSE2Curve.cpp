@@ -5,13 +5,11 @@
  */
 
 #include <curves/SlerpSE2Curve.hpp>
-#include <curves/Pose2_Expressions.hpp>
 #include <curves/helpers.hpp>
 
+#include <algorithm>
 #include <iostream>
-
-#include "gtsam/nonlinear/ExpressionFactor.h"
-
+#include <iterator>
 
 namespace curves {
 
@@ -25,7 +23,6 @@ void SlerpSE2Curve::print(const std::string& str) const {
   std::cout << str << std::endl;
   std::cout << "num of coefficients: " << manager_.size() << std::endl;
   std::cout << "dimension: " <<  3 << std::endl;
-  std::stringstream ss;
   std::vector<Key> keys;
   std::vector<Time> times;
   manager_.getTimes(&times);
@@ -33,21 +30,22 @@ void SlerpSE2Curve::print(const std::string& str) const {
   std::cout << "curve defined between times: " << manager_.getMinTime() <<
       " and " << manager_.getMaxTime() <<std::endl;
   double sum_dp = 0;
-  Eigen::Vector2d p1, p2;
-  for(size_t i = 0; i < times.size()-1; ++i) {
-    p1 = evaluate(times[i]).t().vector();
-    p2 = evaluate(times[i+1]).t().vector();
-    sum_dp += (p1-p2).norm();
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    CoefficientIter next = it;
+    if (++next != manager_.coefficientEnd()) {
+      sum_dp += (next->second.coefficient.getPosition() - it->second.coefficient.getPosition()).norm();
+    }
   }
   std::cout << "average dt between coefficients: " << (manager_.getMaxTime() -manager_.getMinTime())  / (times.size()-1) << " ns." << std::endl;
   std::cout << "average distance between coefficients: " << sum_dp / double((times.size()-1))<< " m." << std::endl;
   std::cout <<"=========================================" <<std::endl;
-  for (size_t i = 0; i < manager_.size(); i++) {
-    ss << "coefficient " << keys[i] << ": ";
-    gtsam::traits<Coefficient>::Print(manager_.getCoefficientByKey(keys[i]),ss.str());
+  size_t i = 0;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it, ++i) {
+    const ValueType& coefficient = it->second.coefficient;
+    std::cout << "coefficient " << keys[i] << ": x " << coefficient.x() << " y " << coefficient.y()
+        << " theta " << coefficient.theta();
     std::cout << " | time: " << times[i];
     std::cout << std::endl;
-    ss.str("");
   }
   std::cout <<"=========================================" <<std::endl;
 }
@@ -89,110 +87,119 @@ void SlerpSE2Curve::setCurve(const std::vector<Time>& times,
 void SlerpSE2Curve::extend(const std::vector<Time>& times,
                            const std::vector<ValueType>& values,
                            std::vector<Key>* outKeys) {
-
   CHECK_EQ(times.size(), values.size()) << "number of times and number of coefficients don't match";
   slerpPolicy_.extend<SlerpSE2Curve, ValueType>(times, values, this, outKeys);
 }
 
-typename SlerpSE2Curve::DerivativeType
-SlerpSE2Curve::evaluateDerivative(Time time,
-                                  unsigned derivativeOrder) const {
-  CHECK(false) << "Not implemented";
+bool SlerpSE2Curve::evaluate(ValueType& value, Time time) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
+  }
+  interpolate(a, b, time, value, NULL);
+  return true;
 }
 
-/// \brief \f[T^{\alpha}\f]
-SE2 transformationPower(SE2  T, double alpha) {
-  CHECK(false) << "Not implemented";
-}
+bool SlerpSE2Curve::evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const {
+  values.resize(times.size());
+  if (times.empty()) {
+    return true;
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    CHECK_GE(times[i], times[i-1]) << "The times have to be increasing.";
+  }
+  if (manager_.empty() || times.front() < manager_.getMinTime() || times.back() > manager_.getMaxTime()) {
+    return false;
+  }
 
-/// \brief \f[A*B\f]
-SE2 composeTransformations(SE2 A, SE2 B) {
-  return A*B;
+  CoefficientIter a, b;
+  CHECK(getSegment(times.front(), &a, &b));
+  const CoefficientIter end = manager_.coefficientEnd();
+  for (size_t i = 0; i < times.size(); ++i) {
+    while (b->first < times[i] && std::next(b) != end) {
+      a = b;
+      ++b;
+    }
+    interpolate(a, b, times[i], values[i], NULL);
+  }
+  return true;
 }
 
-/// \brief \f[T^{-1}\f]
-SE2 inverseTransformation(SE2 T) {
-  return T.inverse();
+bool SlerpSE2Curve::evaluateDerivative(DerivativeType& derivative, Time time,
+                                       unsigned derivativeOrder) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
+  }
+  if (derivativeOrder != 1) {
+    derivative.setZero();
+    return true;
+  }
+  ValueType value;
+  interpolate(a, b, time, value, &derivative);
+  return true;
 }
 
-/// \brief forms slerp interpolation into a binary expression with 2 leafs and binds alpha into it,
-///        uses break down of expression into its operations
-///        \f[ T = A(A^{-1}B)^{\alpha} \f]
-gtsam::Expression<typename SlerpSE2Curve::ValueType>
-SlerpSE2Curve::getValueExpression(const Time& time) const {
-
-  typedef typename SlerpSE2Curve::ValueType ValueType;
-  using namespace gtsam;
-  CoefficientIter rval0, rval1;
-  bool success = manager_.getCoefficientsAt(time, &rval0, &rval1);
-  CHECK(success) << "Unable to get the coefficients at time " << time;
-  Expression<ValueType> leaf1(rval0->second.key);
-  Expression<ValueType> leaf2(rval1->second.key);
-  double alpha = double(time - rval0->first)/double(rval1->first - rval0->first);
-
-  if (alpha == 0) {
-    return leaf1;
-  } else if (alpha == 1) {
-    return leaf2;
-  } else {
-    std::cout << "Doing slerp" << std::endl;
-    std::cout << "alpha " << alpha << std::endl;
-    Pose2 P0 = evaluate(rval0->first);
-    std::cout << "Pose0 x " << P0.x() << " y " << P0.y() << " theta " << P0.theta() << std::endl;
-    Pose2 P1 = evaluate(rval1->first);
-    std::cout << "Pose1 x " << P1.x() << " y " << P1.y() << " theta " << P1.theta() << std::endl;
-    std::cout << "diff x " << P1.x() - P0.x() << " y " << P1.y() - P0.y() << " theta " << P1.theta() - P0.theta() << std::endl;
-    return slerp(leaf1, leaf2, alpha);
+bool SlerpSE2Curve::evaluateState(State& state, Time time) const {
+  CoefficientIter a, b;
+  if (!getSegment(time, &a, &b)) {
+    return false;
   }
+  interpolate(a, b, time, state.value, &state.velocity);
+  state.acceleration.setZero();
+  return true;
 }
 
-gtsam::Expression<typename SlerpSE2Curve::DerivativeType>
-SlerpSE2Curve::getDerivativeExpression(const Time& time, unsigned derivativeOrder) const {
-  // \todo Abel and Renaud
-  CHECK(false) << "Not implemented";
+bool SlerpSE2Curve::getSegment(Time time, CoefficientIter* a, CoefficientIter* b) const {
+  if (manager_.empty() || time < manager_.getMinTime() || time > manager_.getMaxTime()) {
+    return false;
+  }
+  // The curve is only defined at this one time.
+  if (manager_.size() == 1) {
+    *a = *b = manager_.coefficientBegin();
+    return true;
+  }
+  return manager_.getCoefficientsAt(time, a, b);
 }
 
-SE2 SlerpSE2Curve::evaluate(Time time) const {
-  // Check if the curve is only defined at this one time
-  if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
-    return manager_.coefficientBegin()->second.coefficient;
-  } else {
-    if (time == manager_.getMaxTime()) {
-      // Efficient evaluation of a curve end
-      return (--manager_.coefficientEnd())->second.coefficient;
-    } else {
-      CoefficientIter a, b;
-      bool success = manager_.getCoefficientsAt(time, &a, &b);
-      CHECK(success) << "Unable to get the coefficients at time " << time;
-      SE2 T_W_A = a->second.coefficient;
-      SE2 T_W_B = b->second.coefficient;
-      double alpha = double(time - a->first)/double(b->first - a->first);
-
-      //Implementation of T_W_I = T_W_A*exp(alpha*log(inv(T_W_A)*T_W_B))
-      SE2 T_A_B = T_W_A.inverse() * T_W_B;
-      gtsam::Vector3 log_T_A_B = gtsam::Pose2::Logmap(T_A_B);
-      gtsam::Vector3 log_T_A_I = log_T_A_B*alpha;
-      SE2 T_A_I = gtsam::Pose2::Expmap(log_T_A_I);
-      return T_W_A * T_A_I;
+void SlerpSE2Curve::interpolate(CoefficientIter a, CoefficientIter b, Time time, ValueType& value,
+                                DerivativeType* derivative) {
+  const ValueType& T_W_A = a->second.coefficient;
+  if (a == b) {
+    value = T_W_A;
+    if (derivative != NULL) {
+      derivative->setZero();
     }
+    return;
+  }
+  // The position moves along the line and the heading along the shortest arc between the coefficients.
+  const Eigen::Vector3d delta = b->second.coefficient.boxMinus(T_W_A);
+  const double dt = b->first - a->first;
+  const double alpha = (time - a->first) / dt;
+  value = T_W_A.boxPlus(alpha * delta);
+  if (derivative != NULL) {
+    *derivative = delta / dt;
   }
 }
 
-void SlerpSE2Curve::setTimeRange(Time minTime, Time maxTime) {
-  // \todo Abel and Renaud
-  CHECK(false) << "Not implemented";
+/// \brief \f[T^{\alpha}\f]
+SE2 transformationPower(SE2  T, double alpha) {
+  return SE2(T.getPosition() * alpha, SO2(T.theta() * alpha));
 }
 
-void SlerpSE2Curve::initializeGTSAMValues(gtsam::KeySet keys, gtsam::Values* values) const {
-  manager_.initializeGTSAMValues(keys, values);
+/// \brief \f[A*B\f]
+SE2 composeTransformations(SE2 A, SE2 B) {
+  return A*B;
 }
 
-void SlerpSE2Curve::initializeGTSAMValues(gtsam::Values* values) const {
-  manager_.initializeGTSAMValues(values);
+/// \brief \f[T^{-1}\f]
+SE2 inverseTransformation(SE2 T) {
+  return T.inverted();
 }
 
-void SlerpSE2Curve::updateFromGTSAMValues(const gtsam::Values& values) {
-  manager_.updateFromGTSAMValues(values);
+void SlerpSE2Curve::setTimeRange(Time minTime, Time maxTime) {
+  // \todo Abel and Renaud
+  CHECK(false) << "Not implemented";
 }
 
 void SlerpSE2Curve::setMinSamplingPeriod(Time time) {
@@ -208,38 +215,18 @@ void SlerpSE2Curve::clear() {
   manager_.clear();
 }
 
-void SlerpSE2Curve::addPriorFactors(gtsam::NonlinearFactorGraph* graph, Time priorTime) const {
-  Eigen::Matrix<double,3,1> noise;
-  noise(0) = 0.0000001;
-  noise(1) = 0.0000001;
-  noise(2) = 0.0000001;
-
-  gtsam::noiseModel::Diagonal::shared_ptr priorNoise = gtsam::noiseModel::Diagonal::
-        Sigmas(noise);
-
-  CoefficientIter rVal0, rVal1;
-  manager_.getCoefficientsAt(priorTime, &rVal0, &rVal1);
-
-  gtsam::ExpressionFactor<Coefficient> f0(priorNoise,
-                                          rVal0->second.coefficient,
-                                          gtsam::Expression<Coefficient>(rVal0->second.key));
-  gtsam::ExpressionFactor<Coefficient> f1(priorNoise,
-                                          rVal1->second.coefficient,
-                                          gtsam::Expression<Coefficient>(rVal1->second.key));
-  graph->push_back(f0);
-  graph->push_back(f1);
-}
-
 void SlerpSE2Curve::transformCurve(const ValueType T) {
   std::vector<Time> coefTimes;
-  manager_.getTimes(&coefTimes);
-  for (size_t i = 0; i < coefTimes.size(); ++i) {
+  std::vector<ValueType> coefValues;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
     // Apply a rigid transformation to every coefficient (on the left side).
-    manager_.insertCoefficient(coefTimes[i],T*evaluate(coefTimes[i]));
+    coefTimes.push_back(it->first);
+    coefValues.push_back(T*it->second.coefficient);
   }
+  manager_.modifyCoefficientsValuesInBatch(coefTimes, coefValues);
 }
 
-Time SlerpSE2Curve::getTimeAtKey(gtsam::Key key) const {
+Time SlerpSE2Curve::getTimeAtKey(Key key) const {
   return manager_.getCoefficientTimeByKey(key);
 }
 
@@ -252,7 +239,7 @@ void SlerpSE2Curve::saveCurveTimesAndValues(const std::string& filename) const {
   std::vector<Eigen::VectorXd> curveValues;
   ValueType val;
   for (size_t i = 0; i < curveTimes.size(); ++i) {
-    val = evaluate(curveTimes[i]);
+    evaluate(val, curveTimes[i]);
     v << val.x(), val.y(), val.theta();
     curveValues.push_back(v);
   }
@@ -260,4 +247,8 @@ void SlerpSE2Curve::saveCurveTimesAndValues(const std::string& filename) const {
   writeTimeVectorCSV(filename, curveTimes, curveValues);
 }
 
+void SlerpSE2Curve::getCurveTimes(std::vector<Time>* outTimes) const {
+  manager_.getTimes(outTimes);
+}
+
 } // namespace curves
@@ -7,7 +7,9 @@
  */
 
 #include <curves/SlerpSE3Curve.hpp>
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 namespace curves {
 
@@ -29,11 +31,11 @@ void SlerpSE3Curve::print(const std::string& str) const {
   std::cout << "curve defined between times: " << manager_.getMinTime() <<
       " and " << manager_.getMaxTime() <<std::endl;
   double sum_dp = 0;
-  Eigen::Vector3d p1, p2;
-  for(size_t i = 0; i < times.size()-1; ++i) {
-    p1 = evaluate(times[i]).getPosition().vector();
-    p2 = evaluate(times[i+1]).getPosition().vector();
-    sum_dp += (p1-p2).norm();
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
+    CoefficientIter next = it;
+    if (++next != manager_.coefficientEnd()) {
+      sum_dp += (next->second.coefficient.getPosition().vector() - it->second.coefficient.getPosition().vector()).norm();
+    }
   }
   std::cout << "average dt between coefficients: " << (manager_.getMaxTime() -manager_.getMinTime())  / (times.size()-1) << " ns." << std::endl;
   std::cout << "average distance between coefficients: " << sum_dp / double((times.size()-1))<< " m." << std::endl;
@@ -91,47 +93,32 @@ void SlerpSE3Curve::extend(const std::vector<Time>& times,
   slerpPolicy_.extend<SlerpSE3Curve, ValueType>(times, values, this, outKeys);
 }
 
-typename SlerpSE3Curve::DerivativeType
-SlerpSE3Curve::evaluateDerivative(
-    Time time, unsigned derivativeOrder) const
+bool SlerpSE3Curve::evaluateDerivative(DerivativeType& derivative, Time time,
+                                       unsigned derivativeOrder) const
 {
-  CHECK(false) << "Not implemented";
-//  // time is out of bound --> error
-//  CHECK_GE(time, this->getMinTime()) << "Time out of bounds";
-//  CHECK_LE(time, this->getMaxTime()) << "Time out of bounds";
-//
-//  Eigen::VectorXd dCoeff;
-//  Time dt;
-//  CoefficientIter rval0, rval1;
-//  bool success = manager_.getCoefficientsAt(time, &rval0, &rval1);
-//  CHECK(success) << "Unable to get the coefficients at time " << time;
-//  // first derivative
-//  if (derivativeOrder == 1) {
-//    //todo Verify this
-//    dCoeff = gtsam::traits<Coefficient>::Local(rval1->second.coefficient,rval0->second.coefficient);
-//    dt = rval1->first - rval0->first;
-//    return dCoeff/dt;
-//    // order of derivative > 1 returns vector of zeros
-//  } else {
-//    // TODO
-//    const int dimension = gtsam::traits<Coefficient>::dimension;
-//    return Eigen::VectorXd::Zero(dimension,1);
-//  }
+  if (time < manager_.getMinTime() || time > manager_.getMaxTime() || manager_.empty()) {
+    return false;
+  }
+  if (derivativeOrder != 1 || manager_.size() == 1) {
+    derivative = DerivativeType();
+    return true;
+  }
+  CoefficientIter a, b;
+  if (!manager_.getCoefficientsAt(time, &a, &b)) {
+    return false;
+  }
+  Segment segment;
+  computeSegment(a, b, &segment);
+  const double inverseDt = 1.0 / (segment.endTime - segment.startTime);
+  derivative = DerivativeType(segment.translation * inverseDt, segment.rotation * inverseDt);
+  return true;
 }
 
 /// \brief \f[T^{\alpha}\f]
 SE3 transformationPower(SE3 T, double alpha)
 {
-  CHECK(false) << "Not implemented";
-//  SO3 R(T.getRotation());
-//  SE3::Position t(T.getPosition());
-//
-//  AngleAxis angleAxis(R);
-//  angleAxis.setUnique();
-//  angleAxis.setAngle(angleAxis.angle() * alpha);
-//  angleAxis.setUnique();
-//
-//  return SE3(SO3(angleAxis),(t*alpha).eval());
+  const SO3 rotation = SO3().boxPlus(T.getRotation().boxMinus(SO3()) * alpha);
+  return SE3(SE3::Position(T.getPosition().vector() * alpha), rotation);
 }
 
 /// \brief \f[A*B\f]
@@ -143,8 +130,7 @@ SE3 composeTransformations(SE3 A, SE3 B)
 /// \brief \f[T^{-1}\f]
 SE3 inverseTransformation(SE3 T)
 {
-  CHECK(false) << "Not implemented";
-//  return T.inverted();
+  return T.inverted();
 }
 
 SE3 invertAndComposeImplementation(SE3 A, SE3 B)
@@ -153,34 +139,73 @@ SE3 invertAndComposeImplementation(SE3 A, SE3 B)
   return result;
 }
 
-SE3 SlerpSE3Curve::evaluate(Time time) const
+bool SlerpSE3Curve::evaluate(ValueType& value, Time time) const
 {
-  CHECK(false) << "Not implemented";
-
   // Check if the curve is only defined at this one time
-//  if (manager_.getMaxTime() == time && manager_.getMinTime() == time) {
-//    return manager_.coefficientBegin()->second.coefficient;
-//  } else {
-//    if (time == manager_.getMaxTime()) {
-//      // Efficient evaluation of a curve end
-//      return (--manager_.coefficientEnd())->second.coefficient;
-//    } else {
-//      CoefficientIter a, b;
-//      bool success = manager_.getCoefficientsAt(time, &a, &b);
-//      CHECK(success) << "Unable to get the coefficients at time " << time;
-//      SE3 T_W_A = a->second.coefficient;
-//      SE3 T_W_B = b->second.coefficient;
-//      double alpha = double(time - a->first)/double(b->first - a->first);
-//
-//      //Implementation of T_W_I = T_W_A*exp(alpha*log(inv(T_W_A)*T_W_B))
-//      using namespace kindr::minimal;
-//      SE3 T_A_B = invertAndComposeImplementation(T_W_A, T_W_B, boost::none, boost::none);
-//      gtsam::Vector6 log_T_A_B = transformationLogImplementation(T_A_B, boost::none);
-//      gtsam::Vector6 log_T_A_I = vectorScalingImplementation<int(6)>(log_T_A_B, alpha, boost::none, boost::none);
-//      SE3 T_A_I = transformationExpImplementation(log_T_A_I, boost::none);
-//      return composeImplementation(T_W_A, T_A_I, boost::none, boost::none);
-//    }
-//  }
+  if (manager_.size() == 1 && manager_.getMinTime() == time) {
+    value = manager_.coefficientBegin()->second.coefficient;
+    return true;
+  }
+  CoefficientIter a, b;
+  if (manager_.empty() || !manager_.getCoefficientsAt(time, &a, &b)) {
+    return false;
+  }
+  Segment segment;
+  computeSegment(a, b, &segment);
+  interpolate(segment, time, value);
+  return true;
+}
+
+bool SlerpSE3Curve::evaluateInBatch(std::vector<ValueType>& values, const std::vector<Time>& times) const
+{
+  values.resize(times.size());
+  if (times.empty()) {
+    return true;
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    CHECK_GE(times[i], times[i-1]) << "The times have to be increasing.";
+  }
+  if (manager_.empty() || times.front() < manager_.getMinTime() || times.back() > manager_.getMaxTime()) {
+    return false;
+  }
+  if (manager_.size() == 1) {
+    std::fill(values.begin(), values.end(), manager_.coefficientBegin()->second.coefficient);
+    return true;
+  }
+
+  CoefficientIter a, b;
+  CHECK(manager_.getCoefficientsAt(times.front(), &a, &b));
+  const CoefficientIter end = manager_.coefficientEnd();
+  Segment segment;
+  computeSegment(a, b, &segment);
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (b->first < times[i]) {
+      while (b->first < times[i] && std::next(b) != end) {
+        a = b;
+        ++b;
+      }
+      computeSegment(a, b, &segment);
+    }
+    interpolate(segment, times[i], values[i]);
+  }
+  return true;
+}
+
+void SlerpSE3Curve::computeSegment(CoefficientIter a, CoefficientIter b, Segment* segment)
+{
+  segment->startTime = a->first;
+  segment->endTime = b->first;
+  segment->start = a->second.coefficient;
+  segment->end = b->second.coefficient;
+  segment->translation = segment->end.getPosition().vector() - segment->start.getPosition().vector();
+  segment->rotation = segment->end.getRotation().boxMinus(segment->start.getRotation());
+}
+
+void SlerpSE3Curve::interpolate(const Segment& segment, Time time, ValueType& value)
+{
+  const double alpha = (time - segment.startTime) / (segment.endTime - segment.startTime);
+  value = ValueType(ValueType::Position(segment.start.getPosition().vector() + alpha * segment.translation),
+                    segment.start.getRotation().boxPlus(alpha * segment.rotation));
 }
 
 void SlerpSE3Curve::setTimeRange(Time minTime, Time maxTime) {
@@ -260,11 +285,13 @@ void SlerpSE3Curve::clear() {
 
 void SlerpSE3Curve::transformCurve(const ValueType T) {
   std::vector<Time> coefTimes;
-  manager_.getTimes(&coefTimes);
-  for (size_t i = 0; i < coefTimes.size(); ++i) {
+  std::vector<ValueType> coefValues;
+  for (CoefficientIter it = manager_.coefficientBegin(); it != manager_.coefficientEnd(); ++it) {
     // Apply a rigid transformation to every coefficient (on the left side).
-    manager_.insertCoefficient(coefTimes[i],T*evaluate(coefTimes[i]));
+    coefTimes.push_back(it->first);
+    coefValues.push_back(T*it->second.coefficient);
   }
+  manager_.modifyCoefficientsValuesInBatch(coefTimes, coefValues);
 }
 
 void SlerpSE3Curve::saveCurveTimesAndValues(const std::string& filename) const {
@@ -280,7 +307,7 @@ void SlerpSE3Curve::saveCurveAtTimes(const std::string& filename, std::vector<Ti
   std::vector<Eigen::VectorXd> curveValues;
   ValueType val;
   for (size_t i = 0; i < times.size(); ++i) {
-    val = evaluate(times[i]);
+    evaluate(val, times[i]);
     v << val.getPosition().x(), val.getPosition().y(), val.getPosition().z(),
         val.getRotation().w(), val.getRotation().x(), val.getRotation().y(), val.getRotation().z();
     curveValues.push_back(v);
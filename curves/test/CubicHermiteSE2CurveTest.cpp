@@ -0,0 +1,160 @@
+/*
+ * CubicHermiteSE2CurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "curves/CubicHermiteSE2Curve.hpp"
+
+using namespace curves;
+
+typedef CubicHermiteSE2Curve::ValueType ValueType;
+typedef CubicHermiteSE2Curve::DerivativeType DerivativeType;
+
+namespace {
+
+void getSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  const double sampleTimes[] = {0.0, 0.5, 1.5, 2.0, 3.2, 4.0};
+  for (size_t k = 0; k < 6; ++k) {
+    const double t = sampleTimes[k];
+    times->push_back(t);
+    values->push_back(ValueType(std::cos(t), std::sin(t), 1.5 * t));
+  }
+}
+
+void expectNear(const ValueType& expected, const ValueType& actual, double tolerance, const std::string& msg)
+{
+  EXPECT_NEAR(0.0, (expected.getPosition() - actual.getPosition()).norm(), tolerance) << msg;
+  EXPECT_NEAR(0.0, ValueType::getAngleDifference(expected.getRotation(), actual.getRotation()), tolerance) << msg;
+}
+
+} // namespace
+
+TEST(CubicHermiteSE2CurveTest, evaluate)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CubicHermiteSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  DerivativeType derivative;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-12, "knot: " + std::to_string(times[i]));
+  }
+  EXPECT_FALSE(curve.evaluate(value, times.front() - 0.1));
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+
+  // Zero twist at the ends, Catmull-Rom slopes at the inner knots.
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times.front(), 1));
+  EXPECT_NEAR(0.0, derivative.norm(), 1e-12);
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times.back(), 1));
+  EXPECT_NEAR(0.0, derivative.norm(), 1e-12);
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times[2], 1));
+  EXPECT_NEAR(0.0, (derivative - curve.calculateSlope(times[1], times[3], values[1], values[3])).norm(), 1e-12);
+}
+
+TEST(CubicHermiteSE2CurveTest, angleWrap)
+{
+  // The heading crosses +-pi, it has to be interpolated along the shortest arc.
+  std::vector<Time> times = {0.0, 1.0};
+  std::vector<ValueType> values = {ValueType(0.0, 0.0, M_PI - 0.1), ValueType(1.0, 0.0, -M_PI + 0.1)};
+  CubicHermiteSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  for (double t = 0.0; t <= 1.0; t += 0.1) {
+    ASSERT_TRUE(curve.evaluate(value, t));
+    EXPECT_LE(M_PI - 0.1 - 1e-12, std::abs(value.theta())) << "time: " << t;
+  }
+  ASSERT_TRUE(curve.evaluate(value, 0.5));
+  expectNear(ValueType(0.5, 0.0, M_PI), value, 1e-12, "wrap");
+}
+
+TEST(CubicHermiteSE2CurveTest, evaluateState)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CubicHermiteSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  // The twist and its derivative against central differences.
+  const double h = 1e-5;
+  CubicHermiteSE2Curve::State state;
+  CubicHermiteSE2Curve::State before, after;
+  ValueType value;
+  DerivativeType derivative;
+  for (double t = 0.05; t < times.back(); t += 0.3) {
+    ASSERT_TRUE(curve.evaluateState(state, t));
+    ASSERT_TRUE(curve.evaluateState(before, t - h));
+    ASSERT_TRUE(curve.evaluateState(after, t + h));
+    EXPECT_NEAR(0.0, (after.value.boxMinus(before.value) / (2.0 * h) - state.velocity).norm(), 1e-6) << "time: " << t;
+    EXPECT_NEAR(0.0, ((after.velocity - before.velocity) / (2.0 * h) - state.acceleration).norm(), 1e-5) << "time: " << t;
+
+    ASSERT_TRUE(curve.evaluate(value, t));
+    expectNear(value, state.value, 1e-12, "time: " + std::to_string(t));
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, t, 1));
+    EXPECT_NEAR(0.0, (derivative - state.velocity).norm(), 1e-12);
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, t, 2));
+    EXPECT_NEAR(0.0, (derivative - state.acceleration).norm(), 1e-12);
+  }
+}
+
+TEST(CubicHermiteSE2CurveTest, evaluateInBatch)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CubicHermiteSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  std::vector<Time> queryTimes;
+  for (double t = times.front(); t <= times.back(); t += 0.1) {
+    queryTimes.push_back(t);
+  }
+  queryTimes.push_back(times.back());
+  std::vector<ValueType> batchValues;
+  ASSERT_TRUE(curve.evaluateInBatch(batchValues, queryTimes));
+  ASSERT_EQ(queryTimes.size(), batchValues.size());
+
+  ValueType value;
+  for (size_t i = 0; i < queryTimes.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, queryTimes[i]));
+    expectNear(value, batchValues[i], 1e-12, "time: " + std::to_string(queryTimes[i]));
+  }
+
+  queryTimes.push_back(times.back() + 0.1);
+  EXPECT_FALSE(curve.evaluateInBatch(batchValues, queryTimes));
+}
+
+TEST(CubicHermiteSE2CurveTest, extend)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  CubicHermiteSE2Curve fittedCurve;
+  fittedCurve.fitCurve(times, values);
+
+  // Extending one by one and in batches gives the same knots as fitting once.
+  CubicHermiteSE2Curve curve;
+  curve.extend(std::vector<Time>(1, times[0]), std::vector<ValueType>(1, values[0]));
+  curve.extend(std::vector<Time>(1, times[1]), std::vector<ValueType>(1, values[1]));
+  curve.extend(std::vector<Time>(times.begin() + 2, times.end()), std::vector<ValueType>(values.begin() + 2, values.end()));
+  ASSERT_EQ(fittedCurve.size(), curve.size());
+
+  CubicHermiteSE2Curve::State expState, state;
+  for (double t = times.front(); t <= times.back(); t += 0.1) {
+    ASSERT_TRUE(fittedCurve.evaluateState(expState, t));
+    ASSERT_TRUE(curve.evaluateState(state, t));
+    expectNear(expState.value, state.value, 1e-12, "time: " + std::to_string(t));
+    EXPECT_NEAR(0.0, (expState.velocity - state.velocity).norm(), 1e-12);
+  }
+}
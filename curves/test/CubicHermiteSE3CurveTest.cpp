@@ -373,3 +373,158 @@ TEST(GetTime, Simple)
   EXPECT_EQ(times[0], curve.getMinTime());
   EXPECT_EQ(times[2], curve.getMaxTime());
 }
+
+TEST(CubicHermiteSE3CurveTest, transformTime)
+{
+  CubicHermiteSE3Curve curve, original;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+
+  times.push_back(0.0);
+  values.push_back(ValueType(ValueType::Position(1.0, 2.0, 4.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(M_PI_2, 0.2, -0.9))));
+  times.push_back(1.0);
+  values.push_back(ValueType(ValueType::Position(2.0, 4.0, 8.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(2.0, 3.0, -1.1))));
+  times.push_back(2.5);
+  values.push_back(ValueType(ValueType::Position(4.0, 8.0, 16.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(0.2, 0.5, 0.2))));
+  curve.fitCurve(times, values);
+  original.fitCurve(times, values);
+
+  const double scale = 0.8, offset = 3.0;
+  curve.transformTime(scale, offset);
+  EXPECT_DOUBLE_EQ(offset, curve.getMinTime());
+  EXPECT_DOUBLE_EQ(scale * times.back() + offset, curve.getMaxTime());
+
+  for (double time = times.front(); time <= times.back(); time += 0.1) {
+    ValueType transform, expTransform;
+    ASSERT_TRUE(curve.evaluate(transform, scale * time + offset));
+    ASSERT_TRUE(original.evaluate(expTransform, time));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expTransform.getPosition().vector(), transform.getPosition().vector(), 1e-6, "position", 1e-8);
+    EXPECT_NEAR(0.0, expTransform.getRotation().getDisparityAngle(transform.getRotation()), 1e-8);
+
+    DerivativeType derivative, expDerivative;
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, scale * time + offset, 1));
+    ASSERT_TRUE(original.evaluateDerivative(expDerivative, time, 1));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector() / scale, derivative.getVector(), 1e-6, "derivative", 1e-8);
+  }
+}
+
+TEST(CubicHermiteSE3CurveTest, insertKnot)
+{
+  CubicHermiteSE3Curve curve, original;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+
+  times.push_back(0.0);
+  values.push_back(ValueType(ValueType::Position(1.0, 2.0, 4.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(M_PI_2, 0.2, -0.9))));
+  times.push_back(1.0);
+  values.push_back(ValueType(ValueType::Position(2.0, 4.0, 8.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(2.0, 3.0, -1.1))));
+  times.push_back(2.5);
+  values.push_back(ValueType(ValueType::Position(4.0, 8.0, 16.0),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(0.2, 0.5, 0.2))));
+  curve.fitCurve(times, values);
+  original.fitCurve(times, values);
+
+  const Time knotTime = 1.7;
+  Key key;
+  ASSERT_TRUE(curve.insertKnot(knotTime, &key));
+  EXPECT_EQ(4, curve.size());
+  EXPECT_FALSE(curve.insertKnot(knotTime));
+  EXPECT_FALSE(curve.insertKnot(1.0));
+  EXPECT_FALSE(curve.insertKnot(3.0));
+
+  // Exact pose and twist at the new knot.
+  ValueType transform, expTransform;
+  ASSERT_TRUE(curve.evaluate(transform, knotTime));
+  ASSERT_TRUE(original.evaluate(expTransform, knotTime));
+  KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expTransform.getPosition().vector(), transform.getPosition().vector(), 1e-6, "position", 1e-8);
+  EXPECT_NEAR(0.0, expTransform.getRotation().getDisparityAngle(transform.getRotation()), 1e-8);
+  DerivativeType derivative, expDerivative;
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, knotTime, 1));
+  ASSERT_TRUE(original.evaluateDerivative(expDerivative, knotTime, 1));
+  KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector(), derivative.getVector(), 1e-6, "derivative", 1e-8);
+
+  // The translation is unchanged everywhere.
+  for (double time = times.front(); time <= times.back(); time += 0.1) {
+    ASSERT_TRUE(curve.evaluate(transform, time));
+    ASSERT_TRUE(original.evaluate(expTransform, time));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expTransform.getPosition().vector(), transform.getPosition().vector(), 1e-6, "position", 1e-8);
+  }
+}
+
+TEST(CubicHermiteSE3CurveTest, fitCurveSmoothing)
+{
+  // Constant yaw rate with a circular translation, disturbed by a high-frequency offset.
+  const double yawRate = 0.8;
+  const auto truePose = [&](double t) {
+    return ValueType(ValueType::Position(std::cos(t), std::sin(t), 0.1 * t),
+                     ValueType::Rotation(kindr::EulerAnglesZyxD(yawRate * t, 0.1, 0.0)));
+  };
+
+  std::vector<Time> knotTimes, sampleTimes;
+  std::vector<ValueType> sampleValues;
+  for (int k = 0; k <= 10; ++k) knotTimes.push_back(0.5 * k);
+  for (int j = 0; j <= 500; ++j) {
+    const double t = 0.01 * j;
+    const double disturbance = (j % 2) ? 0.01 : -0.01;
+    sampleTimes.push_back(t);
+    sampleValues.push_back(ValueType(ValueType::Position(std::cos(t) + disturbance, std::sin(t) - disturbance, 0.1 * t + disturbance),
+                                     ValueType::Rotation(kindr::EulerAnglesZyxD(yawRate * t + disturbance, 0.1, 0.0))));
+  }
+
+  CubicHermiteSE3Curve curve;
+  std::vector<Key> keys;
+  ASSERT_TRUE(curve.fitCurveSmoothing(knotTimes, sampleTimes, sampleValues, 1.0e-3,
+                                      std::vector<double>(), &keys));
+  EXPECT_EQ(knotTimes.size(), keys.size());
+  EXPECT_EQ(static_cast<int>(knotTimes.size()), curve.size());
+
+  for (double time = 0.0; time <= 5.0; time += 0.05) {
+    ValueType pose;
+    ASSERT_TRUE(curve.evaluate(pose, time));
+    const ValueType expPose = truePose(time);
+    EXPECT_LT((expPose.getPosition().vector() - pose.getPosition().vector()).norm(), 5e-3) << "time: " << time;
+    EXPECT_LT(expPose.getRotation().getDisparityAngle(pose.getRotation()), 1e-2) << "time: " << time;
+  }
+
+  DerivativeType derivative;
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, 2.25, 1));
+  EXPECT_NEAR(-std::sin(2.25), derivative.getTranslationalVelocity().vector()(0), 0.05);
+  EXPECT_NEAR(std::cos(2.25), derivative.getTranslationalVelocity().vector()(1), 0.05);
+  EXPECT_NEAR(yawRate, derivative.getRotationalVelocity().vector()(2), 0.05);
+}
+
+TEST(CubicHermiteSE3CurveTest, extend)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int k = 0; k < 10; ++k) {
+    const double t = 0.3 * k;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(std::cos(t), std::sin(t), 0.5 * t),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.4 * t, 0.1, -0.3 * t))));
+  }
+  CubicHermiteSE3Curve fitted;
+  fitted.fitCurve(times, values);
+
+  // Extending one value, then a single and a batch of values, is equivalent to fitting once.
+  CubicHermiteSE3Curve curve;
+  std::vector<Key> keys;
+  curve.extend(std::vector<Time>(1, times[0]), std::vector<ValueType>(1, values[0]), &keys);
+  curve.extend(std::vector<Time>(1, times[1]), std::vector<ValueType>(1, values[1]), &keys);
+  curve.extend(std::vector<Time>(times.begin() + 2, times.end()), std::vector<ValueType>(values.begin() + 2, values.end()), &keys);
+  EXPECT_EQ(times.size(), keys.size());
+  EXPECT_EQ(times.size(), curve.size());
+
+  for (double time = times.front(); time <= times.back(); time += 0.05) {
+    ValueType transform, expTransform;
+    ASSERT_TRUE(curve.evaluate(transform, time));
+    ASSERT_TRUE(fitted.evaluate(expTransform, time));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expTransform.getPosition().vector(), transform.getPosition().vector(), 1e-6, "position", 1e-8);
+    EXPECT_NEAR(0.0, expTransform.getRotation().getDisparityAngle(transform.getRotation()), 1e-8);
+  }
+}
@@ -0,0 +1,176 @@
+/*
+ * DiscreteSE3CurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <string>
+#include <gtest/gtest.h>
+#include <kindr/Core>
+
+#include "curves/DiscreteSE3Curve.hpp"
+
+using namespace curves;
+
+typedef DiscreteSE3Curve::ValueType ValueType;
+typedef DiscreteSE3Curve::DerivativeType DerivativeType;
+
+namespace {
+
+void getSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  const double sampleTimes[] = {0.0, 0.5, 1.5, 2.0, 3.2};
+  for (size_t k = 0; k < 5; ++k) {
+    const double t = sampleTimes[k];
+    times->push_back(t);
+    values->push_back(ValueType(ValueType::Position(std::cos(t), std::sin(t), 0.3 * t),
+                                ValueType::Rotation(kindr::EulerAnglesZyxD(0.8 * t, 0.2 * std::sin(t), -0.4 * t))));
+  }
+}
+
+void expectNear(const ValueType& expected, const ValueType& actual, double tolerance, const std::string& msg)
+{
+  EXPECT_NEAR(0.0, (expected.getPosition().vector() - actual.getPosition().vector()).norm(), tolerance) << msg;
+  EXPECT_NEAR(0.0, expected.getRotation().getDisparityAngle(actual.getRotation()), tolerance) << msg;
+}
+
+} // namespace
+
+TEST(DiscreteSE3CurveTest, evaluate)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  DiscreteSE3Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-12, "knot: " + std::to_string(times[i]));
+    if (i + 1 < times.size()) {
+      // Ties go to the earlier knot.
+      ASSERT_TRUE(curve.evaluate(value, 0.5 * (times[i] + times[i+1])));
+      expectNear(values[i], value, 1e-12, "middle after: " + std::to_string(times[i]));
+      ASSERT_TRUE(curve.evaluate(value, 0.4 * times[i] + 0.6 * times[i+1]));
+      expectNear(values[i+1], value, 1e-12, "before: " + std::to_string(times[i+1]));
+    }
+  }
+  EXPECT_FALSE(curve.evaluate(value, times.front() - 0.1));
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+
+  // Slope between the coefficients, the last segment on the last coefficient.
+  DerivativeType derivative;
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times.back(), 1));
+  EXPECT_NEAR(0.0, (derivative.getTranslationalVelocity().vector() - (values[4].getPosition().vector()
+      - values[3].getPosition().vector()) / (times[4] - times[3])).norm(), 1e-12);
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times[1], 1));
+  EXPECT_NEAR(0.0, (derivative.getRotationalVelocity().vector() - values[2].getRotation().boxMinus(
+      values[1].getRotation()) / (times[2] - times[1])).norm(), 1e-12);
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times[1], 2));
+  EXPECT_EQ(0.0, derivative.getVector().norm());
+}
+
+TEST(DiscreteSE3CurveTest, knotQueries)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  DiscreteSE3Curve curve;
+  Time knotTime;
+  ValueType value;
+  EXPECT_FALSE(curve.getNearestKnot(0.0, &knotTime));
+  curve.fitCurve(times, values);
+
+  EXPECT_FALSE(curve.getPreviousKnot(times.front() - 0.1, &knotTime));
+  ASSERT_TRUE(curve.getPreviousKnot(1.9, &knotTime, &value));
+  EXPECT_EQ(times[2], knotTime);
+  expectNear(values[2], value, 1e-12, "previous");
+  ASSERT_TRUE(curve.getPreviousKnot(100.0, &knotTime));
+  EXPECT_EQ(times.back(), knotTime);
+
+  ASSERT_TRUE(curve.getNearestKnot(1.9, &knotTime, &value));
+  EXPECT_EQ(times[3], knotTime);
+  expectNear(values[3], value, 1e-12, "nearest");
+  ASSERT_TRUE(curve.getNearestKnot(-5.0, &knotTime));
+  EXPECT_EQ(times.front(), knotTime);
+
+  // Sensor timestamps, unsorted and partly far from the knots.
+  const std::vector<Time> sensorTimes = {1.45, 0.02, 2.6, 3.25, 5.0, -0.03};
+  std::vector<int> knotIndices;
+  EXPECT_EQ(4u, curve.associate(sensorTimes, 0.06, &knotIndices));
+  const std::vector<int> expKnotIndices = {2, 0, -1, 4, -1, 0};
+  ASSERT_EQ(expKnotIndices.size(), knotIndices.size());
+  for (size_t i = 0; i < knotIndices.size(); ++i) {
+    EXPECT_EQ(expKnotIndices[i], knotIndices[i]) << "time: " << sensorTimes[i];
+  }
+  Key key;
+  curve.getKnot(knotIndices[0], &knotTime, &value, &key);
+  EXPECT_EQ(times[2], knotTime);
+  EXPECT_EQ(times[2], curve.getTimeAtKey(key));
+  expectNear(values[2], value, 1e-12, "knot");
+}
+
+TEST(DiscreteSE3CurveTest, extend)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  DiscreteSE3Curve curve;
+  Time knotTime;
+
+  // The index follows the curve when extending, also when the sampling policy moves the last knot.
+  curve.setSamplingRatio(2);
+  for (size_t i = 0; i < times.size(); ++i) {
+    curve.extend(std::vector<Time>(1, times[i]), std::vector<ValueType>(1, values[i]));
+    ASSERT_TRUE(curve.getNearestKnot(times[i], &knotTime));
+    EXPECT_EQ(times[i], knotTime);
+  }
+  std::vector<Time> curveTimes;
+  curve.getCurveTimes(&curveTimes);
+  std::vector<int> knotIndices;
+  EXPECT_EQ(curveTimes.size(), curve.associate(curveTimes, 0.0, &knotIndices));
+  for (size_t i = 0; i < curveTimes.size(); ++i) {
+    EXPECT_EQ(int(i), knotIndices[i]);
+  }
+
+  // Coefficients inserted before the end.
+  curve.setCurve(std::vector<Time>(1, 1.0), std::vector<ValueType>(1, values[0]));
+  ASSERT_TRUE(curve.getNearestKnot(1.05, &knotTime));
+  EXPECT_EQ(1.0, knotTime);
+  curve.clear();
+  EXPECT_FALSE(curve.getNearestKnot(1.05, &knotTime));
+}
+
+TEST(DiscreteSE3CurveTest, composition)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SE3CompositionCurve<DiscreteSE3Curve, DiscreteSE3Curve> curve;
+  DiscreteSE3Curve sampledCurve;
+  ValueType value;
+
+  // The composition adds, moves and removes correction knots directly, the index of the correction
+  // curve follows them.
+  curve.setSamplingRatio(2);
+  sampledCurve.setSamplingRatio(2);
+  for (size_t i = 0; i < times.size(); ++i) {
+    curve.extend(std::vector<Time>(1, times[i]), std::vector<ValueType>(1, values[i]));
+    sampledCurve.extend(std::vector<Time>(1, times[i]), std::vector<ValueType>(1, values[i]));
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-9, "extend");
+  }
+  ASSERT_EQ(sampledCurve.size(), curve.correctionSize());
+  ASSERT_GT(curve.correctionSize(), 2);
+
+  std::vector<Time> correctionTimes;
+  curve.getCurveTimes(&correctionTimes);
+  curve.removeCorrectionCoefficientAtTime(correctionTimes[1]);
+  EXPECT_EQ(sampledCurve.size() - 1, curve.correctionSize());
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-9, "remove");
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * GaussianProcessSE3CurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kindr/Core>
+
+#include "curves/GaussianProcessSE3Curve.hpp"
+
+using namespace curves;
+
+typedef GaussianProcessSE3Curve::ValueType ValueType;
+typedef GaussianProcessSE3Curve::DerivativeType DerivativeType;
+
+TEST(GaussianProcessSE3Curve, constantTwist)
+{
+  // Helix with a constant yaw rate, disturbed by a high-frequency offset.
+  const double yawRate = 0.8;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int j = 0; j <= 500; ++j) {
+    const double t = 0.01 * j;
+    const double disturbance = (j % 2) ? 0.01 : -0.01;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(std::cos(t) + disturbance, std::sin(t) - disturbance, 0.1 * t),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(yawRate * t + disturbance, 0.1, 0.0))));
+  }
+
+  GaussianProcessSE3Curve curve(1.0, 0.1, 0.01 * 0.01, 0.01 * 0.01);
+  curve.fitCurve(times, values);
+  EXPECT_EQ(static_cast<int>(times.size()), curve.size());
+  EXPECT_DOUBLE_EQ(0.0, curve.getMinTime());
+  EXPECT_DOUBLE_EQ(5.0, curve.getMaxTime());
+
+  for (double time = 0.005; time <= 5.0; time += 0.05) {
+    ValueType pose;
+    ASSERT_TRUE(curve.evaluate(pose, time));
+    const ValueType::Rotation expRotation(kindr::EulerAnglesZyxD(yawRate * time, 0.1, 0.0));
+    EXPECT_NEAR(std::cos(time), pose.getPosition().vector()(0), 1e-2) << "time: " << time;
+    EXPECT_NEAR(std::sin(time), pose.getPosition().vector()(1), 1e-2) << "time: " << time;
+    EXPECT_LT(expRotation.getDisparityAngle(pose.getRotation()), 1e-2) << "time: " << time;
+  }
+
+  DerivativeType twist;
+  ASSERT_TRUE(curve.evaluateDerivative(twist, 2.5, 1));
+  EXPECT_NEAR(-std::sin(2.5), twist.getTranslationalVelocity().vector()(0), 0.1);
+  EXPECT_NEAR(std::cos(2.5), twist.getTranslationalVelocity().vector()(1), 0.1);
+  EXPECT_NEAR(yawRate, twist.getRotationalVelocity().vector()(2), 0.1);
+  EXPECT_FALSE(curve.evaluateDerivative(twist, 2.5, 2));
+
+  // Incremental measurements continue the estimate.
+  double positionVarianceBefore, rotationVarianceBefore, positionVariance, rotationVariance;
+  ASSERT_TRUE(curve.evaluateVariance(positionVarianceBefore, rotationVarianceBefore, 5.0));
+  curve.addMeasurement(5.01, ValueType(ValueType::Position(std::cos(5.01), std::sin(5.01), 0.501),
+                                       ValueType::Rotation(kindr::EulerAnglesZyxD(yawRate * 5.01, 0.1, 0.0))),
+                       0.01 * 0.01, 0.01 * 0.01);
+  ASSERT_TRUE(curve.evaluateVariance(positionVariance, rotationVariance, 5.0));
+  EXPECT_LT(positionVariance, positionVarianceBefore);
+  EXPECT_LT(rotationVariance, rotationVarianceBefore);
+  EXPECT_DOUBLE_EQ(5.01, curve.getMaxTime());
+}
@@ -0,0 +1,155 @@
+/*
+ * GaussianProcessVectorSpaceCurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+#include <Eigen/Dense>
+
+#include "curves/GaussianProcessVectorSpaceCurve.hpp"
+
+using namespace curves;
+
+typedef GaussianProcessVectorSpaceCurve<1> Curve1;
+typedef GaussianProcessVectorSpaceCurve<2> Curve2;
+
+TEST(GaussianProcessVectorSpaceCurve, batchEquivalence)
+{
+  // The filter and smoother give the posterior of the batch problem with the dense information matrix.
+  const double qc = 2.0, measurementVariance = 0.01, velocityVariance = 4.0;
+  const std::vector<Time> times{0.0, 0.3, 0.4, 1.0, 1.7, 1.75, 2.5};
+  const std::vector<double> values{0.0, 0.5, 0.4, 1.2, -0.3, -0.2, 0.8};
+  const Time queryTime = 1.2;
+
+  Curve1 curve(qc, measurementVariance);
+  curve.setInitialVelocityVariance(velocityVariance);
+  std::vector<Curve1::ValueType> curveValues;
+  for (const auto value : values) curveValues.push_back(Curve1::ValueType::Constant(value));
+  curve.fitCurve(times, curveValues);
+  ASSERT_EQ(times.size(), curve.size());
+
+  // Dense batch problem, with an additional state at the query time without measurement.
+  std::vector<Time> stateTimes(times);
+  stateTimes.insert(stateTimes.begin() + 4, queryTime);
+  const int n = stateTimes.size();
+  Eigen::MatrixXd information = Eigen::MatrixXd::Zero(2*n, 2*n);
+  Eigen::VectorXd informationVector = Eigen::VectorXd::Zero(2*n);
+  information(1, 1) = 1.0 / velocityVariance;
+  for (int k = 0; k + 1 < n; ++k) {
+    const double dt = stateTimes[k+1] - stateTimes[k];
+    Eigen::MatrixXd error(2, 4);
+    error << -WhiteNoiseOnAccelerationPrior::getTransitionMatrix(dt), Eigen::Matrix2d::Identity();
+    information.block<4, 4>(2*k, 2*k) += error.transpose()
+        * WhiteNoiseOnAccelerationPrior::getProcessCovariance(dt, qc).inverse() * error;
+  }
+  for (size_t j = 0, k = 0; j < times.size(); ++j, ++k) {
+    if (stateTimes[k] == queryTime) ++k;
+    information(2*k, 2*k) += 1.0 / measurementVariance;
+    informationVector(2*k) += values[j] / measurementVariance;
+  }
+  const Eigen::VectorXd mean = information.ldlt().solve(informationVector);
+  const Eigen::MatrixXd covariance = information.inverse();
+
+  for (int k = 0; k < n; ++k) {
+    Curve1::ValueType value;
+    Curve1::DerivativeType velocity;
+    double variance;
+    ASSERT_TRUE(curve.evaluate(value, stateTimes[k]));
+    ASSERT_TRUE(curve.evaluateDerivative(velocity, stateTimes[k], 1));
+    ASSERT_TRUE(curve.evaluateVariance(variance, stateTimes[k]));
+    EXPECT_NEAR(mean(2*k), value(0), 1e-8) << "time: " << stateTimes[k];
+    EXPECT_NEAR(mean(2*k+1), velocity(0), 1e-7) << "time: " << stateTimes[k];
+    EXPECT_NEAR(covariance(2*k, 2*k), variance, 1e-9) << "time: " << stateTimes[k];
+  }
+}
+
+TEST(GaussianProcessVectorSpaceCurve, interpolation)
+{
+  Curve2 curve(0.5, 0.1);
+  std::vector<Time> times;
+  std::vector<Curve2::ValueType> values;
+  for (int j = 0; j < 20; ++j) {
+    times.push_back(0.2 * j + 0.05 * (j % 3));
+    values.push_back(Curve2::ValueType(std::sin(times.back()), (j % 2) ? 0.3 : -0.3));
+  }
+  curve.fitCurve(times, values);
+
+  // The mean between two states is the prior interpolation of the states.
+  const Curve2::TrajectoryType& trajectory = curve.getTrajectory();
+  for (Time time = times.front(); time <= times.back(); time += 0.037) {
+    const int k = std::min<int>(std::upper_bound(times.begin(), times.end(), time) - times.begin() - 1, times.size() - 2);
+    Eigen::Matrix2d lambda, psi;
+    WhiteNoiseOnAccelerationPrior::getInterpolationMatrices(time - times[k], times[k+1] - times[k], 0.5, lambda, psi);
+    Eigen::Matrix2d expected;
+    expected.row(0) = lambda(0, 0)*trajectory.getValue(k) + lambda(0, 1)*trajectory.getVelocity(k)
+        + psi(0, 0)*trajectory.getValue(k+1) + psi(0, 1)*trajectory.getVelocity(k+1);
+    expected.row(1) = lambda(1, 0)*trajectory.getValue(k) + lambda(1, 1)*trajectory.getVelocity(k)
+        + psi(1, 0)*trajectory.getValue(k+1) + psi(1, 1)*trajectory.getVelocity(k+1);
+
+    Curve2::ValueType value;
+    Curve2::DerivativeType velocity, acceleration, velocityPlus, velocityMinus;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(curve.evaluateDerivative(velocity, time, 1));
+    ASSERT_TRUE(curve.evaluateDerivative(acceleration, time, 2));
+    EXPECT_TRUE((expected.row(0).transpose() - value).norm() < 1e-10) << "time: " << time;
+    EXPECT_TRUE((expected.row(1).transpose() - velocity).norm() < 1e-10) << "time: " << time;
+
+    const double h = 1.0e-6;
+    if (time - h < times[k] || time + h > times[k+1]) continue;
+    curve.evaluateDerivative(velocityPlus, time + h, 1);
+    curve.evaluateDerivative(velocityMinus, time - h, 1);
+    EXPECT_TRUE(((velocityPlus - velocityMinus) / (2.0*h) - acceleration).norm() < 1e-5) << "time: " << time;
+  }
+
+  Curve2::ValueType value;
+  EXPECT_FALSE(curve.evaluate(value, times.front() - 0.1));
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+  EXPECT_FALSE(curve.evaluateDerivative(value, times.front(), 3));
+}
+
+TEST(GaussianProcessVectorSpaceCurve, incrementalUpdates)
+{
+  std::mt19937 generator(7);
+  std::normal_distribution<double> noise(0.0, 0.05);
+
+  Curve2 batch(1.0, 0.05*0.05), incremental(1.0, 0.05*0.05);
+  std::vector<Time> times;
+  std::vector<Curve2::ValueType> values;
+  for (int j = 0; j <= 1000; ++j) {
+    const Time time = 0.01 * j;
+    times.push_back(time);
+    values.push_back(Curve2::ValueType(std::sin(time) + noise(generator), 0.2*time*time + noise(generator)));
+    incremental.addMeasurement(time, values.back(), 0.05*0.05);
+  }
+  batch.fitCurve(times, values);
+
+  // The estimate removes most of the noise.
+  double squaredError = 0.0, squaredNoise = 0.0;
+  for (size_t j = 0; j < times.size(); ++j) {
+    Curve2::ValueType value, incrementalValue;
+    ASSERT_TRUE(batch.evaluate(value, times[j]));
+    ASSERT_TRUE(incremental.evaluate(incrementalValue, times[j]));
+    EXPECT_TRUE((value - incrementalValue).norm() < 1e-7) << "time: " << times[j];
+    const Curve2::ValueType truth(std::sin(times[j]), 0.2*times[j]*times[j]);
+    squaredError += (value - truth).squaredNorm();
+    squaredNoise += (values[j] - truth).squaredNorm();
+  }
+  EXPECT_LT(squaredError, 0.2 * squaredNoise);
+
+  Curve2::DerivativeType velocity;
+  ASSERT_TRUE(batch.evaluateDerivative(velocity, 5.0, 1));
+  EXPECT_NEAR(std::cos(5.0), velocity(0), 0.25);
+  EXPECT_NEAR(0.4*5.0, velocity(1), 0.25);
+
+  // Far from the measurements, the variance grows.
+  double varianceAtState, varianceBetween;
+  Curve1 sparse(1.0, 0.01);
+  sparse.fitCurve({0.0, 0.1, 5.0, 5.1}, {Curve1::ValueType::Constant(0.0), Curve1::ValueType::Constant(0.1),
+                                         Curve1::ValueType::Constant(1.0), Curve1::ValueType::Constant(1.1)});
+  ASSERT_TRUE(sparse.evaluateVariance(varianceAtState, 0.1));
+  ASSERT_TRUE(sparse.evaluateVariance(varianceBetween, 2.5));
+  EXPECT_GT(varianceBetween, 10.0 * varianceAtState);
+}
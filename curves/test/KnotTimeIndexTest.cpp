@@ -0,0 +1,106 @@
+/*
+ * KnotTimeIndexTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+
+#include "curves/KnotTimeIndex.hpp"
+
+using namespace curves;
+
+namespace {
+
+// Non-uniform times: bursts of close timestamps with gaps in between.
+std::vector<Time> getTimes(size_t numKnots, std::mt19937* generator)
+{
+  std::exponential_distribution<double> gap(1.0);
+  std::vector<Time> times;
+  Time time = -3.0;
+  for (size_t i = 0; i < numKnots; ++i) {
+    time += (i % 10 == 0) ? 5.0 * gap(*generator) + 1e-3 : 1e-3 * gap(*generator) + 1e-6;
+    times.push_back(time);
+  }
+  return times;
+}
+
+void expectLookupsNear(const KnotTimeIndex& index, const std::vector<Time>& times, std::mt19937* generator)
+{
+  ASSERT_EQ(times.size(), index.size());
+  std::uniform_real_distribution<double> queryTime(times.front() - 1.0, times.back() + 1.0);
+  std::vector<Time> queryTimes(times);
+  for (size_t i = 0; i < 200; ++i) {
+    queryTimes.push_back(queryTime(*generator));
+  }
+  size_t knot;
+  for (size_t i = 0; i < queryTimes.size(); ++i) {
+    const Time time = queryTimes[i];
+    const std::vector<Time>::const_iterator upper = std::upper_bound(times.begin(), times.end(), time);
+    if (upper == times.begin()) {
+      EXPECT_FALSE(index.getPreviousKnot(time, &knot)) << "time: " << time;
+    } else {
+      ASSERT_TRUE(index.getPreviousKnot(time, &knot)) << "time: " << time;
+      EXPECT_EQ(size_t(upper - times.begin() - 1), knot) << "time: " << time;
+    }
+
+    size_t expNearest = 0;
+    for (size_t k = 1; k < times.size(); ++k) {
+      if (std::abs(times[k] - time) < std::abs(times[expNearest] - time)) {
+        expNearest = k;
+      }
+    }
+    ASSERT_TRUE(index.getNearestKnot(time, &knot));
+    EXPECT_EQ(expNearest, knot) << "time: " << time;
+  }
+}
+
+} // namespace
+
+TEST(KnotTimeIndexTest, build)
+{
+  std::mt19937 generator(42);
+  KnotTimeIndex index;
+  size_t knot;
+  EXPECT_FALSE(index.getPreviousKnot(0.0, &knot));
+  EXPECT_FALSE(index.getNearestKnot(0.0, &knot));
+
+  const std::vector<size_t> sizes = {1, 2, 3, 50, 1000};
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    const std::vector<Time> times = getTimes(sizes[i], &generator);
+    index.build(times);
+    expectLookupsNear(index, times, &generator);
+  }
+}
+
+TEST(KnotTimeIndexTest, pushAndPop)
+{
+  std::mt19937 generator(7);
+  const std::vector<Time> times = getTimes(500, &generator);
+  KnotTimeIndex index;
+  std::vector<Time> indexedTimes;
+  for (size_t i = 0; i < times.size(); ++i) {
+    index.push_back(times[i]);
+    indexedTimes.push_back(times[i]);
+    // Remove and append again as done when the last knot of a curve is modified.
+    if (i % 7 == 3) {
+      index.pop_back();
+      index.push_back(times[i]);
+    }
+    if (i % 50 == 0) {
+      expectLookupsNear(index, indexedTimes, &generator);
+    }
+  }
+  expectLookupsNear(index, indexedTimes, &generator);
+
+  while (indexedTimes.size() > 1) {
+    index.pop_back();
+    indexedTimes.pop_back();
+  }
+  expectLookupsNear(index, indexedTimes, &generator);
+  index.pop_back();
+  EXPECT_TRUE(index.empty());
+}
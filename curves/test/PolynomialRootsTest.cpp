@@ -0,0 +1,103 @@
+/*
+ * PolynomialRootsTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "curves/PolynomialRoots.hpp"
+
+using namespace curves;
+
+TEST(PolynomialRoots, simpleRoots)
+{
+  // (t+1)(t-0.5)(t-2)(t-3) = t^4 - 4.5t^3 + 3t^2 + 5.5t - 3
+  std::vector<double> coeffs{-3.0, 5.5, 3.0, -4.5, 1.0};
+  std::vector<double> roots;
+
+  findPolynomialRoots(coeffs, -5.0, 5.0, roots);
+  ASSERT_EQ(4, roots.size());
+  EXPECT_NEAR(-1.0, roots[0], 1e-12);
+  EXPECT_NEAR(0.5, roots[1], 1e-12);
+  EXPECT_NEAR(2.0, roots[2], 1e-12);
+  EXPECT_NEAR(3.0, roots[3], 1e-12);
+
+  findPolynomialRoots(coeffs, 0.0, 2.5, roots);
+  ASSERT_EQ(2, roots.size());
+  EXPECT_NEAR(0.5, roots[0], 1e-12);
+  EXPECT_NEAR(2.0, roots[1], 1e-12);
+
+  // Roots at the interval bounds.
+  findPolynomialRoots(coeffs, 0.5, 2.0, roots);
+  ASSERT_EQ(2, roots.size());
+  EXPECT_NEAR(0.5, roots[0], 1e-12);
+  EXPECT_NEAR(2.0, roots[1], 1e-12);
+}
+
+TEST(PolynomialRoots, specialCases)
+{
+  std::vector<double> roots;
+
+  // Double root (t-1)^2.
+  findPolynomialRoots({1.0, -2.0, 1.0}, 0.0, 2.0, roots);
+  ASSERT_EQ(1, roots.size());
+  EXPECT_NEAR(1.0, roots[0], 1e-12);
+
+  // No real roots t^2 + 1.
+  findPolynomialRoots({1.0, 0.0, 1.0}, -10.0, 10.0, roots);
+  EXPECT_TRUE(roots.empty());
+
+  // Vanishing leading coefficients and constants.
+  findPolynomialRoots({-1.0, 2.0, 0.0, 0.0}, 0.0, 1.0, roots);
+  ASSERT_EQ(1, roots.size());
+  EXPECT_NEAR(0.5, roots[0], 1e-12);
+  findPolynomialRoots({0.0, 0.0}, 0.0, 1.0, roots);
+  EXPECT_TRUE(roots.empty());
+
+  // Quintic with clustered roots.
+  std::vector<double> p{1.0};
+  for (double r : {0.1, 0.11, 0.5, 0.9, 0.91}) {
+    std::vector<double> q(p.size() + 1, 0.0);
+    for (size_t k = 0; k < p.size(); ++k) {
+      q[k] -= r * p[k];
+      q[k+1] += p[k];
+    }
+    p = q;
+  }
+  findPolynomialRoots(p, 0.0, 1.0, roots);
+  ASSERT_EQ(5, roots.size());
+  EXPECT_NEAR(0.1, roots[0], 1e-10);
+  EXPECT_NEAR(0.11, roots[1], 1e-10);
+  EXPECT_NEAR(0.5, roots[2], 1e-10);
+  EXPECT_NEAR(0.9, roots[3], 1e-10);
+  EXPECT_NEAR(0.91, roots[4], 1e-10);
+}
+
+TEST(PolynomialRoots, bounds)
+{
+  // (t+1)(t-0.5)(t-2)(t-3) = t^4 - 4.5t^3 + 3t^2 + 5.5t - 3
+  const std::vector<double> coeffs{-3.0, 5.5, 3.0, -4.5, 1.0};
+  for (const auto& interval : std::vector<std::pair<double, double> >{{-1.0, 3.0}, {0.0, 0.4}, {2.2, 2.8}, {-0.5, 0.5}}) {
+    double minValue, maxValue;
+    getPolynomialBounds(coeffs, interval.first, interval.second, minValue, maxValue);
+
+    double minSample = evaluatePolynomial(coeffs, interval.first), maxSample = minSample;
+    for (double t = interval.first; t <= interval.second; t += 1.0e-3) {
+      minSample = std::min(minSample, evaluatePolynomial(coeffs, t));
+      maxSample = std::max(maxSample, evaluatePolynomial(coeffs, t));
+    }
+    EXPECT_LE(minValue, minSample + 1e-12) << "interval: " << interval.first << " " << interval.second;
+    EXPECT_GE(maxValue, maxSample - 1e-12) << "interval: " << interval.first << " " << interval.second;
+  }
+
+  // No sign change on [0, 0.4], the bounds exclude zero.
+  double minValue, maxValue;
+  getPolynomialBounds(coeffs, 0.0, 0.4, minValue, maxValue);
+  EXPECT_LT(maxValue, 0.0);
+
+  // Exact for linear polynomials.
+  getPolynomialBounds({1.0, -2.0}, 0.0, 2.0, minValue, maxValue);
+  EXPECT_NEAR(-3.0, minValue, 1e-12);
+  EXPECT_NEAR(1.0, maxValue, 1e-12);
+}
@@ -23,7 +23,7 @@ TEST(PolynomialSplineContainer, getActiveSplineIndexAtTime)
   knotVal.push_back(1.0);
   knotVal.push_back(2.0);
 
-  curves::PolynomialSplineContainer polyContainer;
+  curves::PolynomialSplineContainerQuintic polyContainer;
   polyContainer.setData(knotPos, knotVal, 0.0, 0.0, 0.0, 0.0);
 
   double timeOffset = 0.0;
@@ -63,7 +63,7 @@ TEST(PolynomialSplineContainer, eval) {
   double finalVelocity = 0.3;
   double finalAcceleration = 0.4;
 
-  curves::PolynomialSplineContainer polyContainer;
+  curves::PolynomialSplineContainerQuintic polyContainer;
   polyContainer.setData(knotPos, knotVal, initialVelocity, initialAcceleration, finalVelocity, finalAcceleration);
 
   for (int i=0; i<knotVal.size()-1; i++) {
@@ -83,3 +83,245 @@ TEST(PolynomialSplineContainer, eval) {
 //  EXPECT_NEAR(finalAcceleration, polyContainer.getSpline(knotVal.size()-2)->getAccelerationAtTime(knotPos[knotPos.size()-1]-knotPos[knotVal.size()-2]), 1e-2 );
 
 }
+
+TEST(PolynomialSplineContainer, cubicContinuity) {
+  std::vector<double> knotPos{0.0, 0.5, 1.5, 2.0, 3.0};
+  std::vector<double> knotVal{0.0, 1.0, -0.5, 0.3, 2.0};
+
+  double initialVelocity = 0.1;
+  double finalVelocity = 0.3;
+
+  curves::PolynomialSplineContainerCubic polyContainer;
+  polyContainer.setData(knotPos, knotVal, initialVelocity, 0.0, finalVelocity, 0.0);
+
+  ASSERT_NEAR(3.0, polyContainer.getContainerDuration(), 1e-10);
+  EXPECT_NEAR(initialVelocity, polyContainer.getVelocityAtTime(0.0), 1e-8);
+  EXPECT_NEAR(finalVelocity, polyContainer.getEndVelocity(), 1e-8);
+
+  for (size_t i = 0; i < knotVal.size() - 1; i++) {
+    const double duration = knotPos[i+1] - knotPos[i];
+    EXPECT_NEAR(knotVal[i], polyContainer.getSpline(i)->getPositionAtTime(0.0), 1e-8) << " knot:" << i;
+    EXPECT_NEAR(knotVal[i+1], polyContainer.getSpline(i)->getPositionAtTime(duration), 1e-8) << " knot:" << i;
+    if (i + 1 < knotVal.size() - 1) {
+      EXPECT_NEAR(polyContainer.getSpline(i)->getVelocityAtTime(duration),
+                  polyContainer.getSpline(i+1)->getVelocityAtTime(0.0), 1e-8) << " knot:" << i+1;
+      EXPECT_NEAR(polyContainer.getSpline(i)->getAccelerationAtTime(duration),
+                  polyContainer.getSpline(i+1)->getAccelerationAtTime(0.0), 1e-8) << " knot:" << i+1;
+    }
+  }
+}
+
+TEST(PolynomialSplineContainer, septicContinuity) {
+  std::vector<double> knotPos{0.0, 1.0, 2.0, 3.5};
+  std::vector<double> knotVal{0.0, 1.0, 0.5, 2.0};
+
+  double initialVelocity = 0.1;
+  double initialAcceleration = 0.2;
+  double finalVelocity = 0.3;
+  double finalAcceleration = 0.4;
+
+  curves::PolynomialSplineContainerSeptic polyContainer;
+  polyContainer.setData(knotPos, knotVal, initialVelocity, initialAcceleration, finalVelocity, finalAcceleration);
+
+  EXPECT_NEAR(knotVal.front(), polyContainer.getPositionAtTime(0.0), 1e-8);
+  EXPECT_NEAR(initialVelocity, polyContainer.getVelocityAtTime(0.0), 1e-8);
+  EXPECT_NEAR(initialAcceleration, polyContainer.getAccelerationAtTime(0.0), 1e-8);
+  EXPECT_NEAR(knotVal.back(), polyContainer.getEndPosition(), 1e-8);
+  EXPECT_NEAR(finalVelocity, polyContainer.getEndVelocity(), 1e-8);
+  EXPECT_NEAR(finalAcceleration, polyContainer.getEndAcceleration(), 1e-8);
+
+  for (size_t i = 0; i < knotVal.size() - 2; i++) {
+    const double duration = knotPos[i+1] - knotPos[i];
+    EXPECT_NEAR(knotVal[i+1], polyContainer.getSpline(i)->getPositionAtTime(duration), 1e-8) << " knot:" << i+1;
+    EXPECT_NEAR(knotVal[i+1], polyContainer.getSpline(i+1)->getPositionAtTime(0.0), 1e-8) << " knot:" << i+1;
+    EXPECT_NEAR(polyContainer.getSpline(i)->getVelocityAtTime(duration),
+                polyContainer.getSpline(i+1)->getVelocityAtTime(0.0), 1e-8) << " knot:" << i+1;
+    EXPECT_NEAR(polyContainer.getSpline(i)->getAccelerationAtTime(duration),
+                polyContainer.getSpline(i+1)->getAccelerationAtTime(0.0), 1e-8) << " knot:" << i+1;
+  }
+}
+
+TEST(PolynomialSplineContainer, cubicExtendData) {
+  std::vector<double> knotPos{0.0, 1.0, 2.0};
+  std::vector<double> knotVal{0.0, 1.0, 0.5};
+
+  curves::PolynomialSplineContainerCubic polyContainer;
+  polyContainer.setData(knotPos, knotVal, 0.0, 0.0, 0.0, 0.0);
+
+  for (int i = 0; i < 6; ++i) {
+    knotPos.push_back(knotPos.back() + 0.5);
+    knotVal.push_back(0.1 * i);
+    polyContainer.extendData(std::vector<double>(1, knotPos.back()), std::vector<double>(1, knotVal.back()), 2);
+  }
+
+  ASSERT_NEAR(knotPos.back(), polyContainer.getContainerDuration(), 1e-10);
+  for (size_t i = 0; i < knotVal.size() - 1; i++) {
+    const double duration = knotPos[i+1] - knotPos[i];
+    ASSERT_NEAR(duration, polyContainer.getSpline(i)->getSplineDuration(), 1e-10);
+    EXPECT_NEAR(knotVal[i], polyContainer.getSpline(i)->getPositionAtTime(0.0), 1e-8) << " knot:" << i;
+    EXPECT_NEAR(knotVal[i+1], polyContainer.getSpline(i)->getPositionAtTime(duration), 1e-8) << " knot:" << i;
+    if (i + 1 < knotVal.size() - 1) {
+      EXPECT_NEAR(polyContainer.getSpline(i)->getVelocityAtTime(duration),
+                  polyContainer.getSpline(i+1)->getVelocityAtTime(0.0), 1e-8) << " knot:" << i+1;
+      EXPECT_NEAR(polyContainer.getSpline(i)->getAccelerationAtTime(duration),
+                  polyContainer.getSpline(i+1)->getAccelerationAtTime(0.0), 1e-8) << " knot:" << i+1;
+    }
+  }
+}
+
+template <typename Container>
+void checkSetSplines(int numBoundaryDerivatives) {
+  std::vector<curves::PolynomialSplineBase::SplineOpts> splineOpts(3);
+  splineOpts[0].tf = 0.5;
+  splineOpts[0].pos0 = 0.1;  splineOpts[0].posT = 1.0;
+  splineOpts[0].vel0 = -0.3; splineOpts[0].velT = 0.2;
+  splineOpts[0].acc0 = 0.4;  splineOpts[0].accT = -1.0;
+  splineOpts[1].tf = 2.0;
+  splineOpts[1].pos0 = 1.0;  splineOpts[1].posT = -0.5;
+  splineOpts[1].vel0 = 0.2;  splineOpts[1].velT = 0.0;
+  splineOpts[1].acc0 = -1.0; splineOpts[1].accT = 0.5;
+  splineOpts[2].tf = 1.2;
+  splineOpts[2].pos0 = -0.5; splineOpts[2].posT = 3.0;
+
+  Container polyContainer;
+  ASSERT_TRUE(polyContainer.setSplines(splineOpts));
+  ASSERT_NEAR(3.7, polyContainer.getContainerDuration(), 1e-10);
+
+  for (size_t i = 0; i < splineOpts.size(); i++) {
+    const curves::PolynomialSplineBase::SplineOpts& opts = splineOpts[i];
+    curves::PolynomialSplineBase* spline = polyContainer.getSpline(i);
+    EXPECT_NEAR(opts.pos0, spline->getPositionAtTime(0.0), 1e-10) << " spline:" << i;
+    EXPECT_NEAR(opts.posT, spline->getPositionAtTime(opts.tf), 1e-10) << " spline:" << i;
+    if (numBoundaryDerivatives > 0) {
+      EXPECT_NEAR(opts.vel0, spline->getVelocityAtTime(0.0), 1e-10) << " spline:" << i;
+      EXPECT_NEAR(opts.velT, spline->getVelocityAtTime(opts.tf), 1e-10) << " spline:" << i;
+    }
+    if (numBoundaryDerivatives > 1) {
+      EXPECT_NEAR(opts.acc0, spline->getAccelerationAtTime(0.0), 1e-10) << " spline:" << i;
+      EXPECT_NEAR(opts.accT, spline->getAccelerationAtTime(opts.tf), 1e-10) << " spline:" << i;
+    }
+  }
+
+  splineOpts[1].tf = 0.0;
+  EXPECT_FALSE(polyContainer.setSplines(splineOpts));
+  EXPECT_TRUE(polyContainer.isEmpty());
+}
+
+TEST(PolynomialSplineContainer, setSplines) {
+  checkSetSplines<curves::PolynomialSplineContainerLinear>(0);
+  checkSetSplines<curves::PolynomialSplineContainerCubic>(1);
+  checkSetSplines<curves::PolynomialSplineContainerQuintic>(2);
+  checkSetSplines<curves::PolynomialSplineContainerSeptic>(2);
+}
+
+TEST(PolynomialSplineContainer, extrema) {
+  std::vector<double> knotPos{0.0, 0.4, 1.0, 1.7, 2.0};
+  std::vector<double> knotVal{0.0, 1.0, -1.5, 0.3, 0.5};
+
+  curves::PolynomialSplineContainerQuintic polyContainer;
+  polyContainer.setData(knotPos, knotVal, 0.2, 0.0, -0.1, 0.0);
+
+  std::vector<curves::PolynomialSplineExtrema> splineExtrema;
+  polyContainer.getSplineExtrema(splineExtrema);
+  ASSERT_EQ(4, splineExtrema.size());
+
+  // Compare with dense sampling.
+  curves::PolynomialSplineExtrema sampled;
+  const double dt = 1.0e-4;
+  for (double t = 0.0; t <= polyContainer.getContainerDuration(); t += dt) {
+    double timeOffset;
+    const int splineIdx = polyContainer.getActiveSplineIndexAtTime(t, timeOffset);
+    const curves::PolynomialSplineQuintic& spline = polyContainer.getSplines()[splineIdx];
+    curves::PolynomialSplineExtrema sample;
+    sample.position.maxAbsValue = std::abs(spline.getPositionAtTime(t - timeOffset));
+    sample.velocity.maxAbsValue = std::abs(spline.getVelocityAtTime(t - timeOffset));
+    sample.acceleration.maxAbsValue = std::abs(spline.getAccelerationAtTime(t - timeOffset));
+    sample.jerk.maxAbsValue = std::abs(spline.getDerivativeAtTime(t - timeOffset, 3));
+    sample.position.time = sample.velocity.time = sample.acceleration.time = sample.jerk.time = t;
+    sampled.merge(sample);
+
+    EXPECT_LE(sample.velocity.maxAbsValue, splineExtrema[splineIdx].velocity.maxAbsValue + 1e-10);
+    EXPECT_LE(sample.acceleration.maxAbsValue, splineExtrema[splineIdx].acceleration.maxAbsValue + 1e-10);
+  }
+
+  for (bool parallel : {false, true}) {
+    const curves::PolynomialSplineExtrema extrema = polyContainer.getExtrema(parallel);
+    EXPECT_NEAR(sampled.position.maxAbsValue, extrema.position.maxAbsValue, 1e-4);
+    EXPECT_NEAR(sampled.position.time, extrema.position.time, 1e-3);
+    EXPECT_NEAR(sampled.velocity.maxAbsValue, extrema.velocity.maxAbsValue, 1e-3);
+    EXPECT_NEAR(sampled.velocity.time, extrema.velocity.time, 1e-3);
+    EXPECT_NEAR(sampled.acceleration.maxAbsValue, extrema.acceleration.maxAbsValue, 1e-2);
+    EXPECT_NEAR(sampled.acceleration.time, extrema.acceleration.time, 1e-3);
+    EXPECT_NEAR(sampled.jerk.maxAbsValue, extrema.jerk.maxAbsValue, 1e-1);
+
+    // The extrema are reached at the returned times.
+    EXPECT_NEAR(extrema.position.maxAbsValue, std::abs(polyContainer.getPositionAtTime(extrema.position.time)), 1e-10);
+    EXPECT_NEAR(extrema.velocity.maxAbsValue, std::abs(polyContainer.getVelocityAtTime(extrema.velocity.time)), 1e-10);
+  }
+}
+
+TEST(PolynomialSplineContainerTest, levelCrossings)
+{
+  curves::PolynomialSplineContainerQuintic container;
+  std::vector<double> knotPositions{0.0, 0.5, 1.2, 1.3, 2.0, 3.0};
+  std::vector<double> knotValues{0.0, 1.0, -0.5, -0.4, 2.0, 0.0};
+  container.setData(knotPositions, knotValues, 0.0, 0.0, 0.0, 0.0);
+
+  for (const double level : {0.5, -0.4, 1.0, 3.0}) {
+    std::vector<double> crossingTimes;
+    container.getLevelCrossingTimes(level, 0.0, 3.0, crossingTimes);
+
+    // Count the sign changes on a dense grid.
+    int numSignChanges = 0;
+    const double dt = 1.0e-4;
+    for (double t = 0.0; t + dt <= 3.0; t += dt) {
+      if ((container.getPositionAtTime(t) - level) * (container.getPositionAtTime(t + dt) - level) < 0.0) numSignChanges++;
+    }
+    EXPECT_EQ(numSignChanges, crossingTimes.size()) << "level: " << level;
+    for (size_t i = 0; i < crossingTimes.size(); ++i) {
+      EXPECT_NEAR(level, container.getPositionAtTime(crossingTimes[i]), 1e-10) << "level: " << level;
+      if (i > 0) EXPECT_LT(crossingTimes[i-1], crossingTimes[i]);
+    }
+  }
+
+  // A crossing at a knot is reported once.
+  std::vector<double> crossingTimes;
+  container.getLevelCrossingTimes(-0.4, 1.25, 1.5, crossingTimes);
+  ASSERT_EQ(1, crossingTimes.size());
+  EXPECT_NEAR(1.3, crossingTimes[0], 1e-9);
+
+  double crossingTime;
+  ASSERT_TRUE(container.getFirstLevelCrossingTime(0.5, 0.6, 3.0, crossingTime));
+  EXPECT_GT(crossingTime, 0.6);
+  EXPECT_NEAR(0.5, container.getPositionAtTime(crossingTime), 1e-10);
+  EXPECT_FALSE(container.getFirstLevelCrossingTime(3.0, 0.0, 3.0, crossingTime));
+}
+
+TEST(PolynomialSplineContainerTest, insertKnot)
+{
+  curves::PolynomialSplineContainerQuintic container, original;
+  std::vector<double> knotPositions{0.0, 0.5, 1.2, 1.3, 2.0, 3.0};
+  std::vector<double> knotValues{0.0, 1.0, -0.5, -0.4, 2.0, 0.0};
+  container.setData(knotPositions, knotValues, 0.0, 0.0, 0.0, 0.0);
+  original.setData(knotPositions, knotValues, 0.0, 0.0, 0.0, 0.0);
+
+  // Advance into the spline which is split, the playback continues on the same time.
+  for (int k = 0; k < 17; ++k) container.advance(0.1);
+  ASSERT_TRUE(container.insertKnot(1.6));
+  ASSERT_TRUE(container.insertKnot(0.25));
+  EXPECT_EQ(7, container.getSplines().size());
+  EXPECT_DOUBLE_EQ(original.getContainerDuration(), container.getContainerDuration());
+  EXPECT_EQ(5, container.getActiveSplineIndex());
+  EXPECT_NEAR(original.getPositionAtTime(1.7), container.getPosition(), 1e-10);
+
+  EXPECT_FALSE(container.insertKnot(1.2));
+  EXPECT_FALSE(container.insertKnot(-0.1));
+  EXPECT_FALSE(container.insertKnot(3.5));
+  EXPECT_EQ(7, container.getSplines().size());
+
+  for (double t = 0.0; t <= 3.0; t += 0.01) {
+    EXPECT_NEAR(original.getPositionAtTime(t), container.getPositionAtTime(t), 1e-10) << "time: " << t;
+    EXPECT_NEAR(original.getVelocityAtTime(t), container.getVelocityAtTime(t), 1e-9) << "time: " << t;
+    EXPECT_NEAR(original.getAccelerationAtTime(t), container.getAccelerationAtTime(t), 1e-8) << "time: " << t;
+  }
+}
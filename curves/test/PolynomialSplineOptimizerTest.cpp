@@ -0,0 +1,153 @@
+/*
+ * PolynomialSplineOptimizerTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "curves/PolynomialSplineOptimizer.hpp"
+
+using namespace curves;
+
+TEST(PolynomialSplineOptimizer, minimumJerkSingleSpline)
+{
+  // Rest to rest in unit time: x(t) = 10t^3 - 15t^4 + 6t^5 with the cost 720.
+  PolynomialSplineMinimumJerkOptimizer optimizer;
+  ASSERT_TRUE(optimizer.solve(std::vector<double>{1.0}, std::vector<std::vector<double> >{{0.0, 1.0}}));
+  EXPECT_NEAR(720.0, optimizer.getCost(), 1e-8);
+
+  PolynomialSplineContainerQuintic container;
+  optimizer.getContainer(container);
+  ASSERT_EQ(1, container.getSplines().size());
+  const auto& coeffs = container.getSplines().front().getCoeffs();
+  const double expectedCoeffs[] = {0.0, 0.0, 0.0, 10.0, -15.0, 6.0};
+  for (int k = 0; k < 6; ++k) {
+    EXPECT_NEAR(expectedCoeffs[k], coeffs[k], 1e-10) << "coefficient: " << k;
+  }
+}
+
+template <int splineOrder>
+void checkOptimalSplines(const std::vector<double>& durations, const std::vector<double>& values)
+{
+  PolynomialSplineOptimizer<splineOrder> optimizer;
+  ASSERT_TRUE(optimizer.solve(durations, std::vector<std::vector<double> >(1, values)));
+  PolynomialSplineContainer<splineOrder> container;
+  optimizer.getContainer(container);
+  ASSERT_EQ(durations.size(), container.getSplines().size());
+
+  // The optimum passes through the knots, starts and ends at rest and is continuous up to the
+  // derivative of order 2r-2 (r = order of the minimized derivative).
+  const int r = PolynomialSplineOptimizer<splineOrder>::costDerivativeOrder;
+  const auto& splines = container.getSplines();
+  for (size_t i = 0; i < splines.size(); ++i) {
+    EXPECT_NEAR(values[i], splines[i].getPositionAtTime(0.0), 1e-8) << "spline: " << i;
+    EXPECT_NEAR(values[i+1], splines[i].getPositionAtTime(durations[i]), 1e-8) << "spline: " << i;
+    if (i == 0) continue;
+    for (int d = 1; d <= 2*r-2; ++d) {
+      const double before = splines[i-1].getDerivativeAtTime(durations[i-1], d);
+      const double after = splines[i].getDerivativeAtTime(0.0, d);
+      EXPECT_NEAR(before, after, 1e-6 * std::max(1.0, std::abs(before))) << "knot: " << i << " derivative: " << d;
+    }
+  }
+  for (int d = 1; d < r; ++d) {
+    EXPECT_NEAR(0.0, splines.front().getDerivativeAtTime(0.0, d), 1e-8) << "derivative: " << d;
+    EXPECT_NEAR(0.0, splines.back().getDerivativeAtTime(durations.back(), d), 1e-8) << "derivative: " << d;
+  }
+
+  // Any other spline through the knots has a higher cost, e.g. the interpolation of the container.
+  PolynomialSplineContainer<splineOrder> interpolation;
+  std::vector<double> knotPositions(1, 0.0);
+  for (const auto duration : durations) knotPositions.push_back(knotPositions.back() + duration);
+  interpolation.setData(knotPositions, values, 0.0, 0.0, 0.0, 0.0);
+  double interpolationCost = 0.0;
+  const int numSamples = 2000;
+  for (const auto& spline : interpolation.getSplines()) {
+    const double dt = spline.getSplineDuration() / numSamples;
+    for (int k = 0; k < numSamples; ++k) {
+      const double derivative = spline.getDerivativeAtTime((k + 0.5) * dt, r);
+      interpolationCost += derivative * derivative * dt;
+    }
+  }
+  EXPECT_LT(optimizer.getCost(), interpolationCost);
+}
+
+TEST(PolynomialSplineOptimizer, minimumJerk)
+{
+  checkOptimalSplines<5>({1.0, 0.5, 2.0, 1.2, 0.8}, {0.0, 1.0, 1.5, -1.0, 0.3, 0.0});
+}
+
+TEST(PolynomialSplineOptimizer, minimumSnap)
+{
+  checkOptimalSplines<7>({1.0, 0.5, 2.0, 1.2, 0.8}, {0.0, 1.0, 1.5, -1.0, 0.3, 0.0});
+}
+
+TEST(PolynomialSplineOptimizer, costGradient)
+{
+  const std::vector<std::vector<double> > values{{0.0, 1.0, 1.5, -1.0, 0.3}, {2.0, 0.0, 1.0, 1.0, 0.0}};
+  const std::vector<std::vector<double> > initialDerivatives{{0.5, 0.1, 0.0}, {}};
+  std::vector<double> durations{1.0, 0.5, 2.0, 1.2};
+
+  PolynomialSplineMinimumSnapOptimizer optimizer;
+  ASSERT_TRUE(optimizer.solve(durations, values, initialDerivatives));
+  const std::vector<double> gradient = optimizer.getCostGradient();
+
+  const double h = 1.0e-6;
+  for (size_t i = 0; i < durations.size(); ++i) {
+    std::vector<double> durationsPlus(durations), durationsMinus(durations);
+    durationsPlus[i] += h;
+    durationsMinus[i] -= h;
+    ASSERT_TRUE(optimizer.solve(durationsPlus, values, initialDerivatives));
+    const double costPlus = optimizer.getCost();
+    ASSERT_TRUE(optimizer.solve(durationsMinus, values, initialDerivatives));
+    const double costMinus = optimizer.getCost();
+    EXPECT_NEAR((costPlus - costMinus) / (2.0 * h), gradient[i], 1e-4 * std::max(1.0, std::abs(gradient[i])))
+        << "spline: " << i;
+  }
+}
+
+TEST(PolynomialSplineOptimizer, timeAllocation)
+{
+  // Symmetric knots lead to symmetric durations.
+  const std::vector<std::vector<double> > values{{0.0, 2.0, 2.5, 3.0, 5.0}};
+  const std::vector<double> initialDurations(4, 1.0);
+  const double timeWeight = 10.0;
+
+  PolynomialSplineMinimumJerkOptimizer optimizer;
+  ASSERT_TRUE(optimizer.solve(initialDurations, values));
+  const double initialObjective = optimizer.getCost() + timeWeight * 4.0;
+
+  ASSERT_TRUE(optimizer.solveWithTimeAllocation(initialDurations, values, timeWeight, 500));
+  const std::vector<double>& durations = optimizer.getSplineDurations();
+  double totalDuration = 0.0;
+  for (size_t i = 0; i < durations.size(); ++i) {
+    // Stationary point of cost + timeWeight * total duration (up to the flat bottom of the objective).
+    EXPECT_NEAR(-timeWeight, optimizer.getCostGradient()[i], 1e-2 * timeWeight) << "spline: " << i;
+    totalDuration += durations[i];
+  }
+  EXPECT_LT(optimizer.getCost() + timeWeight * totalDuration, initialObjective);
+  EXPECT_NEAR(durations[0], durations[3], 1e-4);
+  EXPECT_NEAR(durations[1], durations[2], 1e-4);
+  EXPECT_GT(durations[0], durations[1]);
+}
+
+TEST(PolynomialSplineOptimizer, manySplines)
+{
+  const int numSplines = 5000;
+  std::vector<double> durations(numSplines), values(numSplines + 1);
+  for (int i = 0; i <= numSplines; ++i) {
+    values[i] = std::sin(0.1 * i);
+    if (i < numSplines) durations[i] = 0.1 + 0.05 * (i % 3);
+  }
+
+  PolynomialSplineMinimumSnapOptimizer optimizer;
+  ASSERT_TRUE(optimizer.solve(durations, std::vector<std::vector<double> >(1, values)));
+  PolynomialSplineContainerSeptic container;
+  optimizer.getContainer(container);
+  std::vector<double> knotPositions(1, 0.0);
+  for (const auto duration : durations) knotPositions.push_back(knotPositions.back() + duration);
+  for (int i = 0; i <= numSplines; i += 97) {
+    EXPECT_NEAR(values[i], container.getPositionAtTime(knotPositions[i]), 1e-6) << "knot: " << i;
+  }
+}
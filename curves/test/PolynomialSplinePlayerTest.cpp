@@ -0,0 +1,81 @@
+/*
+ * PolynomialSplinePlayerTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <type_traits>
+#include <gtest/gtest.h>
+
+#include "curves/PolynomialSplineContainer.hpp"
+#include "curves/PolynomialSplinePlayer.hpp"
+
+using namespace curves;
+
+namespace {
+
+void fitContainer(PolynomialSplineContainerQuintic& container)
+{
+  std::vector<double> knotPositions{0.0, 0.5, 1.2, 1.3, 2.0, 3.0};
+  std::vector<double> knotValues{0.0, 1.0, -0.5, -0.4, 2.0, 0.0};
+  container.setData(knotPositions, knotValues, 0.0, 0.0, 0.0, 0.0);
+}
+
+} // namespace
+
+TEST(PolynomialSplinePlayer, playback)
+{
+  static_assert(std::is_nothrow_copy_constructible<PolynomialSplinePlayer<5> >::value, "Player has to be cheap to copy.");
+
+  PolynomialSplineContainerQuintic container;
+  fitContainer(container);
+
+  PolynomialSplinePlayer<5> player(container);
+  EXPECT_DOUBLE_EQ(container.getContainerDuration(), player.getDuration());
+
+  const double dt = 0.01;
+  int numSteps = 0;
+  do {
+    const PolynomialSplineState state = player.getState();
+    EXPECT_NEAR(container.getPositionAtTime(player.getTime()), state.position, 1e-10) << "time: " << player.getTime();
+    EXPECT_NEAR(container.getVelocityAtTime(player.getTime()), state.velocity, 1e-10) << "time: " << player.getTime();
+    EXPECT_NEAR(container.getAccelerationAtTime(player.getTime()), state.acceleration, 1e-9) << "time: " << player.getTime();
+    numSteps++;
+  } while (player.advance(dt));
+
+  EXPECT_TRUE(player.isFinished());
+  EXPECT_EQ(container.getSplines().size() - 1, player.getActiveSplineIndex());
+  EXPECT_NEAR(container.getContainerDuration() / dt, numSteps - 1, 1.0);
+  EXPECT_NEAR(container.getEndPosition(), player.getState().position, 1e-10);
+  EXPECT_FALSE(player.advance(dt));
+}
+
+TEST(PolynomialSplinePlayer, independentPlayers)
+{
+  PolynomialSplineContainerQuintic container;
+  fitContainer(container);
+
+  // A large step skips splines, a copy continues independently.
+  PolynomialSplinePlayer<5> player(container);
+  ASSERT_TRUE(player.advance(1.25));
+  EXPECT_EQ(2, player.getActiveSplineIndex());
+  PolynomialSplinePlayer<5> copy(player);
+  ASSERT_TRUE(copy.advance(1.0));
+  EXPECT_EQ(4, copy.getActiveSplineIndex());
+  EXPECT_DOUBLE_EQ(1.25, player.getTime());
+  EXPECT_NEAR(container.getPositionAtTime(1.25), player.getState().position, 1e-10);
+  EXPECT_NEAR(container.getPositionAtTime(2.25), copy.getState().position, 1e-10);
+
+  // Seeking backwards.
+  copy.setTime(0.1);
+  EXPECT_EQ(0, copy.getActiveSplineIndex());
+  EXPECT_NEAR(container.getVelocityAtTime(0.1), copy.getState().velocity, 1e-10);
+  copy.setTime(1.21);
+  EXPECT_EQ(2, copy.getActiveSplineIndex());
+  EXPECT_NEAR(container.getVelocityAtTime(1.21), copy.getState().velocity, 1e-10);
+
+  PolynomialSplinePlayer<5> emptyPlayer;
+  EXPECT_TRUE(emptyPlayer.isEmpty());
+  EXPECT_FALSE(emptyPlayer.advance(0.1));
+  EXPECT_EQ(0.0, emptyPlayer.getState().position);
+}
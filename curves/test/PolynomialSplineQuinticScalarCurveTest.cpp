@@ -6,6 +6,7 @@
  *   Institute: ETH Zurich, Autonomous Systems Lab
  */
 
+#include <cmath>
 #include <gtest/gtest.h>
 
 #include "curves/PolynomialSplineScalarCurve.hpp"
@@ -195,3 +196,217 @@ TEST(PolynomialSplineQuinticScalarCurveTest, invarianceUnderOffset)
     EXPECT_NEAR(value1, value2 - offset, 1.0e-7);
   }
 }
+
+TEST(PolynomialSplineQuinticScalarCurveTest, extend)
+{
+  PolynomialSplineQuinticScalarCurve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+
+  times.push_back(1.0);
+  values.push_back(ValueType(0.0));
+  times.push_back(1.5);
+  values.push_back(ValueType(0.4));
+  times.push_back(2.0);
+  values.push_back(ValueType(-0.2));
+  curve.fitCurve(times, values);
+
+  // Append one knot at a time.
+  ValueType valueBeforeExtend;
+  for (int i = 0; i < 10; ++i) {
+    if (i == 2) curve.evaluate(valueBeforeExtend, 1.2);
+    const Time time = times.back() + 0.3 + 0.05 * i;
+    const ValueType value = std::sin(time);
+    curve.extend(std::vector<Time>(1, time), std::vector<ValueType>(1, value), NULL);
+    times.push_back(time);
+    values.push_back(value);
+  }
+
+  EXPECT_NEAR(times.front(), curve.getMinTime(), 1.0e-10);
+  EXPECT_NEAR(times.back(), curve.getMaxTime(), 1.0e-10);
+
+  // The start of the curve is outside of the re-solved windows of the last appends.
+  ValueType value;
+  curve.evaluate(value, 1.2);
+  EXPECT_NEAR(valueBeforeExtend, value, 1.0e-10);
+
+  const double eps = 1.0e-8;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    EXPECT_NEAR(values[i], value, 1.0e-6) << "knot: " << i;
+
+    if (i == 0 || i == times.size() - 1) continue;
+    DerivativeType derivativeBefore, derivativeAfter;
+    for (unsigned derivativeOrder = 1; derivativeOrder <= 2; ++derivativeOrder) {
+      curve.evaluateDerivative(derivativeBefore, times[i] - eps, derivativeOrder);
+      curve.evaluateDerivative(derivativeAfter, times[i] + eps, derivativeOrder);
+      EXPECT_NEAR(derivativeBefore, derivativeAfter, 1.0e-4) << "knot: " << i << " derivative: " << derivativeOrder;
+    }
+  }
+}
+
+TEST(PolynomialSplineQuinticScalarCurveTest, extendEmpty)
+{
+  // Streaming one sample at a time into an empty curve.
+  PolynomialSplineQuinticScalarCurve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int i = 0; i < 8; ++i) {
+    const Time time = 0.5 + 0.3 * i;
+    const ValueType value = std::cos(time);
+    curve.extend(std::vector<Time>(1, time), std::vector<ValueType>(1, value), NULL);
+    times.push_back(time);
+    values.push_back(value);
+    PolynomialSplineState state;
+    EXPECT_EQ(i > 0, curve.evaluateState(state, times.front())) << "sample: " << i;
+  }
+
+  EXPECT_NEAR(times.front(), curve.getMinTime(), 1.0e-10);
+  EXPECT_NEAR(times.back(), curve.getMaxTime(), 1.0e-10);
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    EXPECT_NEAR(values[i], value, 1.0e-6) << "knot: " << i;
+  }
+
+  // Clearing drops a held back sample.
+  curve.clear();
+  curve.extend(std::vector<Time>(1, 0.0), std::vector<ValueType>(1, 1.0), NULL);
+  curve.clear();
+  curve.extend(std::vector<Time>(1, 1.0), std::vector<ValueType>(1, 2.0), NULL);
+  curve.extend(std::vector<Time>(1, 2.0), std::vector<ValueType>(1, 3.0), NULL);
+  EXPECT_NEAR(1.0, curve.getMinTime(), 1.0e-10);
+  ASSERT_TRUE(curve.evaluate(value, 1.0));
+  EXPECT_NEAR(2.0, value, 1.0e-10);
+}
+
+TEST(PolynomialSplineQuinticScalarCurveTest, retime)
+{
+  PolynomialSplineQuinticScalarCurve curve;
+  std::vector<Time> times{0.0, 1.0, 1.5, 3.0, 3.2, 5.0};
+  std::vector<ValueType> values{0.0, 2.0, 2.5, -1.0, -0.8, 0.0};
+  curve.fitCurve(times, values);
+
+  const double maxVelocity = 3.0;
+  const double maxAcceleration = 10.0;
+  ASSERT_TRUE(curve.retime(maxVelocity, maxAcceleration));
+
+  ValueType value;
+  curve.evaluate(value, curve.getMinTime());
+  EXPECT_NEAR(values.front(), value, 1.0e-8);
+  curve.evaluate(value, curve.getMaxTime());
+  EXPECT_NEAR(values.back(), value, 1.0e-8);
+
+  // Bounds are met (checked densely), at least one of them is active, and the velocity is continuous.
+  const double dt = 1.0e-4;
+  double maxAbsVelocity = 0.0, maxAbsAcceleration = 0.0;
+  DerivativeType previousVelocity;
+  curve.evaluateDerivative(previousVelocity, curve.getMinTime(), 1);
+  for (Time time = curve.getMinTime(); time <= curve.getMaxTime(); time += dt) {
+    DerivativeType velocity, acceleration;
+    curve.evaluateDerivative(velocity, time, 1);
+    curve.evaluateDerivative(acceleration, time, 2);
+    maxAbsVelocity = std::max(maxAbsVelocity, std::abs(velocity));
+    maxAbsAcceleration = std::max(maxAbsAcceleration, std::abs(acceleration));
+    EXPECT_LE(std::abs(velocity - previousVelocity), maxAcceleration * dt * 1.01) << "time: " << time;
+    previousVelocity = velocity;
+  }
+  EXPECT_LE(maxAbsVelocity, maxVelocity * (1.0 + 1.0e-5));
+  EXPECT_LE(maxAbsAcceleration, maxAcceleration * (1.0 + 1.0e-5));
+  EXPECT_GT(std::max(maxAbsVelocity / maxVelocity, maxAbsAcceleration / maxAcceleration), 0.99);
+}
+
+TEST(PolynomialSplineQuinticScalarCurveTest, transformTime)
+{
+  PolynomialSplineQuinticScalarCurve curve, original;
+  std::vector<Time> times{1.0, 2.0, 2.5, 4.0};
+  std::vector<ValueType> values{0.0, 2.0, 2.5, -1.0};
+  curve.fitCurve(times, values);
+  original.fitCurve(times, values);
+
+  // Slow down to 1/0.8 of the speed and shift, then shift once more.
+  curve.transformTime(1.25, 0.5);
+  curve.transformTime(1.0, -1.0);
+  const double scale = 1.25, offset = -0.5;
+  EXPECT_NEAR(scale * original.getMinTime() + offset, curve.getMinTime(), 1.0e-12);
+  EXPECT_NEAR(scale * original.getMaxTime() + offset, curve.getMaxTime(), 1.0e-12);
+
+  for (Time time = original.getMinTime(); time <= original.getMaxTime(); time += 0.1) {
+    const Time transformedTime = scale * time + offset;
+    ValueType value, expectedValue;
+    curve.evaluate(value, transformedTime);
+    original.evaluate(expectedValue, time);
+    EXPECT_NEAR(expectedValue, value, 1.0e-10) << "time: " << time;
+
+    DerivativeType derivative, expectedDerivative;
+    for (unsigned derivativeOrder = 1; derivativeOrder <= 2; ++derivativeOrder) {
+      curve.evaluateDerivative(derivative, transformedTime, derivativeOrder);
+      original.evaluateDerivative(expectedDerivative, time, derivativeOrder);
+      EXPECT_NEAR(expectedDerivative / std::pow(scale, derivativeOrder), derivative, 1.0e-10)
+          << "time: " << time << " derivative: " << derivativeOrder;
+    }
+  }
+
+  // Fitting starts from the identity again.
+  curve.fitCurve(times, values);
+  EXPECT_NEAR(times.front(), curve.getMinTime(), 1.0e-12);
+  EXPECT_NEAR(times.back(), curve.getMaxTime(), 1.0e-12);
+}
+
+TEST(PolynomialSplineQuinticScalarCurveTest, evaluateState)
+{
+  PolynomialSplineQuinticScalarCurve curve;
+  std::vector<Time> times{1.0, 2.0, 2.5, 4.0};
+  std::vector<ValueType> values{0.0, 2.0, 2.5, -1.0};
+  curve.fitCurve(times, values);
+  curve.transformTime(0.5, 0.0);
+
+  // The samples avoid the knots (0.5, 1.0, 1.25, 2.0 after the transform), where the jerk jumps.
+  const double h = 1.0e-5;
+  for (Time time = curve.getMinTime() + 0.025; time <= curve.getMaxTime(); time += 0.05) {
+    PolynomialSplineState state;
+    ASSERT_TRUE(curve.evaluateState(state, time, true));
+    ValueType value;
+    DerivativeType velocity, acceleration, accelerationBefore, accelerationAfter;
+    curve.evaluate(value, time);
+    curve.evaluateDerivative(velocity, time, 1);
+    curve.evaluateDerivative(acceleration, time, 2);
+    EXPECT_NEAR(value, state.position, 1e-10) << "time: " << time;
+    EXPECT_NEAR(velocity, state.velocity, 1e-10) << "time: " << time;
+    EXPECT_NEAR(acceleration, state.acceleration, 1e-9) << "time: " << time;
+
+    // Jerk by central differences.
+    curve.evaluateDerivative(accelerationBefore, time - h, 2);
+    curve.evaluateDerivative(accelerationAfter, time + h, 2);
+    const double jerk = (accelerationAfter - accelerationBefore) / (2.0 * h);
+    EXPECT_NEAR(jerk, state.jerk, 1e-3 * std::max(1.0, std::abs(jerk))) << "time: " << time;
+  }
+
+  PolynomialSplineQuinticScalarCurve emptyCurve;
+  PolynomialSplineState state;
+  EXPECT_FALSE(emptyCurve.evaluateState(state, 0.0));
+}
+
+TEST(PolynomialSplineQuinticScalarCurveTest, fitCurveSmoothing)
+{
+  PolynomialSplineQuinticScalarCurve curve;
+  std::vector<Time> knotTimes, sampleTimes;
+  std::vector<ValueType> sampleValues;
+  for (int k = 0; k <= 8; ++k) knotTimes.push_back(2.0 + 0.5 * k);
+  for (int j = 0; j <= 400; ++j) {
+    sampleTimes.push_back(2.0 + 0.01 * j);
+    // Deterministic high-frequency disturbance.
+    sampleValues.push_back(std::cos(sampleTimes.back()) + 0.02 * ((j % 2) ? 1.0 : -1.0));
+  }
+
+  ASSERT_TRUE(curve.fitCurveSmoothing(knotTimes, sampleTimes, sampleValues, 1.0e-4));
+  EXPECT_DOUBLE_EQ(2.0, curve.getMinTime());
+  EXPECT_NEAR(6.0, curve.getMaxTime(), 1e-12);
+  for (Time time = 2.0; time <= 6.0; time += 0.05) {
+    ValueType value, velocity;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(curve.evaluateDerivative(velocity, time, 1));
+    EXPECT_NEAR(std::cos(time), value, 5e-3) << "time: " << time;
+    EXPECT_NEAR(-std::sin(time), velocity, 5e-2) << "time: " << time;
+  }
+}
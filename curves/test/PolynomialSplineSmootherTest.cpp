@@ -0,0 +1,120 @@
+/*
+ * PolynomialSplineSmootherTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+
+#include "curves/PolynomialSplineSmoother.hpp"
+
+using namespace curves;
+
+template <int splineOrder>
+void checkPolynomialIsReproduced()
+{
+  // Without roughness weight, a polynomial of the spline order is reproduced exactly.
+  const std::vector<double> knotPositions{1.0, 1.4, 2.5, 3.0};
+  std::vector<double> sampleTimes, sampleValues;
+  const auto polynomial = [](double t) { return std::pow(t - 2.0, splineOrder) - 0.5*t*t + 2.0; };
+  for (double t = 1.0; t <= 3.0; t += 0.02) {
+    sampleTimes.push_back(t);
+    sampleValues.push_back(polynomial(t));
+  }
+
+  PolynomialSplineSmoother<splineOrder> smoother;
+  ASSERT_TRUE(smoother.fit(knotPositions, sampleTimes, std::vector<std::vector<double> >(1, sampleValues), 0.0));
+  PolynomialSplineContainer<splineOrder> container;
+  smoother.getContainer(container);
+  ASSERT_EQ(3, container.getSplines().size());
+  EXPECT_NEAR(2.0, container.getContainerDuration(), 1e-12);
+  for (double t = 1.0; t <= 3.0; t += 0.01) {
+    EXPECT_NEAR(polynomial(t), container.getPositionAtTime(t - 1.0), 1e-8) << "time: " << t;
+  }
+  EXPECT_NEAR(polynomial(2.5), smoother.getKnotState(0, 2), 1e-8);
+  EXPECT_NEAR(splineOrder*std::pow(0.5, splineOrder-1) - 2.5, smoother.getKnotState(0, 2, 1), 1e-7);
+}
+
+TEST(PolynomialSplineSmoother, reproducePolynomial)
+{
+  checkPolynomialIsReproduced<3>();
+  checkPolynomialIsReproduced<5>();
+  checkPolynomialIsReproduced<7>();
+}
+
+TEST(PolynomialSplineSmoother, noisySamples)
+{
+  std::mt19937 generator(42);
+  std::normal_distribution<double> noise(0.0, 0.05);
+
+  std::vector<double> sampleTimes;
+  std::vector<std::vector<double> > sampleValues(2);
+  for (int j = 0; j <= 2000; ++j) {
+    const double t = 0.005 * j;
+    sampleTimes.push_back(t);
+    sampleValues[0].push_back(std::sin(t) + noise(generator));
+    sampleValues[1].push_back(0.5*t + noise(generator));
+  }
+  std::vector<double> knotPositions;
+  for (int k = 0; k <= 20; ++k) knotPositions.push_back(0.5 * k);
+
+  PolynomialSplineSmoother<5> smoother;
+  ASSERT_TRUE(smoother.fit(knotPositions, sampleTimes, sampleValues, 1.0e-3));
+  EXPECT_EQ(2, smoother.getNumDimensions());
+  PolynomialSplineContainerQuintic sine, line;
+  smoother.getContainer(sine, 0);
+  smoother.getContainer(line, 1);
+
+  // The fit removes most of the noise, also from the derivatives.
+  for (double t = 0.0; t <= 10.0; t += 0.05) {
+    EXPECT_NEAR(std::sin(t), sine.getPositionAtTime(t), 0.03) << "time: " << t;
+    EXPECT_NEAR(std::cos(t), sine.getVelocityAtTime(t), 0.15) << "time: " << t;
+    EXPECT_NEAR(0.5*t, line.getPositionAtTime(t), 0.03) << "time: " << t;
+    EXPECT_NEAR(0.5, line.getVelocityAtTime(t), 0.15) << "time: " << t;
+  }
+
+  // Continuous up to the acceleration at the knots.
+  const auto& splines = sine.getSplines();
+  for (size_t i = 1; i < splines.size(); ++i) {
+    const double duration = splines[i-1].getSplineDuration();
+    for (int d = 0; d < PolynomialSplineSmoother<5>::roughnessDerivativeOrder; ++d) {
+      EXPECT_NEAR(splines[i-1].getDerivativeAtTime(duration, d), splines[i].getDerivativeAtTime(0.0, d), 1e-8)
+          << "knot: " << i << " derivative: " << d;
+    }
+  }
+}
+
+TEST(PolynomialSplineSmoother, roughnessWeight)
+{
+  const std::vector<double> knotPositions{0.0, 1.0, 2.0, 3.0, 4.0};
+  std::vector<double> sampleTimes, sampleValues, sampleWeights;
+  for (int j = 0; j <= 40; ++j) {
+    sampleTimes.push_back(0.1 * j);
+    sampleValues.push_back((j % 2) ? 1.0 : -1.0);
+    sampleWeights.push_back(1.0 + 0.1 * j);
+  }
+
+  // A dominant roughness weight leaves the weighted least-squares line.
+  PolynomialSplineSmoother<3> smoother;
+  ASSERT_TRUE(smoother.fit(knotPositions, sampleTimes, std::vector<std::vector<double> >(1, sampleValues),
+                           1.0e8, sampleWeights));
+  double sw = 0.0, swt = 0.0, swtt = 0.0, swy = 0.0, swty = 0.0;
+  for (size_t j = 0; j < sampleTimes.size(); ++j) {
+    const double w = sampleWeights[j], t = sampleTimes[j], y = sampleValues[j];
+    sw += w; swt += w*t; swtt += w*t*t; swy += w*y; swty += w*t*y;
+  }
+  const double slope = (sw*swty - swt*swy) / (sw*swtt - swt*swt);
+  const double intercept = (swy - slope*swt) / sw;
+  for (size_t k = 0; k < knotPositions.size(); ++k) {
+    EXPECT_NEAR(intercept + slope*knotPositions[k], smoother.getKnotState(0, k), 1e-4) << "knot: " << k;
+    EXPECT_NEAR(slope, smoother.getKnotState(0, k, 1), 1e-4) << "knot: " << k;
+  }
+
+  // Without roughness weight, a spline without samples makes the fit ill-posed.
+  const std::vector<double> shortTimes(sampleTimes.begin(), sampleTimes.begin() + 21);
+  const std::vector<double> shortValues(sampleValues.begin(), sampleValues.begin() + 21);
+  EXPECT_FALSE(smoother.fit(knotPositions, shortTimes, std::vector<std::vector<double> >(1, shortValues), 0.0));
+  EXPECT_TRUE(smoother.fit(knotPositions, shortTimes, std::vector<std::vector<double> >(1, shortValues), 1.0));
+}
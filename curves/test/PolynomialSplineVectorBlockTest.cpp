@@ -0,0 +1,72 @@
+/*
+ * PolynomialSplineVectorBlockTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "curves/PolynomialSplineVectorBlock.hpp"
+
+template <int N>
+void checkAgainstContainers()
+{
+  std::vector<double> knotPos{0.0, 0.3, 1.0, 1.2, 2.0};
+  std::vector<curves::PolynomialSplineContainerQuintic> containers(N);
+  for (int i = 0; i < N; ++i) {
+    std::vector<double> knotVal;
+    for (size_t k = 0; k < knotPos.size(); ++k) knotVal.push_back(std::sin(0.7 * i + knotPos[k]));
+    containers[i].setData(knotPos, knotVal, 0.1 * i, 0.0, -0.2, 0.1 * i);
+  }
+
+  curves::PolynomialSplineVectorBlock<5, N> block;
+  EXPECT_TRUE(block.isEmpty());
+  block.setFromContainers(containers);
+  ASSERT_EQ(4, block.getNumSegments());
+  EXPECT_NEAR(2.0, block.getDuration(), 1e-10);
+
+  typename curves::PolynomialSplineVectorBlock<5, N>::ValueType position, velocity, acceleration, jerk;
+  for (double t = -0.1; t <= 2.1; t += 0.05) {
+    ASSERT_TRUE(block.getPositionAtTime(position, t));
+    ASSERT_TRUE(block.getVelocityAtTime(velocity, t));
+    ASSERT_TRUE(block.getAccelerationAtTime(acceleration, t));
+    ASSERT_TRUE(block.getDerivativeAtTime(jerk, t, 1));
+    for (int i = 0; i < N; ++i) {
+      EXPECT_NEAR(containers[i].getPositionAtTime(t), position(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(containers[i].getVelocityAtTime(t), velocity(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(containers[i].getAccelerationAtTime(t), acceleration(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(velocity(i), jerk(i), 1e-10) << "t: " << t << " dim: " << i;
+    }
+
+    typename curves::PolynomialSplineVectorBlock<5, N>::State state;
+    ASSERT_TRUE(block.getStateAtTime(state, t, true));
+    ASSERT_TRUE(block.getDerivativeAtTime(jerk, t, 3));
+    for (int i = 0; i < N; ++i) {
+      EXPECT_NEAR(position(i), state.position(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(velocity(i), state.velocity(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(acceleration(i), state.acceleration(i), 1e-10) << "t: " << t << " dim: " << i;
+      EXPECT_NEAR(jerk(i), state.jerk(i), 1e-9) << "t: " << t << " dim: " << i;
+    }
+  }
+
+  double segmentTime;
+  EXPECT_EQ(0, block.getSegmentIndexAtTime(-1.0, segmentTime));
+  EXPECT_NEAR(0.0, segmentTime, 1e-10);
+  EXPECT_EQ(2, block.getSegmentIndexAtTime(1.0, segmentTime));
+  EXPECT_NEAR(0.0, segmentTime, 1e-10);
+  EXPECT_EQ(3, block.getSegmentIndexAtTime(3.0, segmentTime));
+  EXPECT_NEAR(0.8, segmentTime, 1e-10);
+
+  block.clear();
+  EXPECT_FALSE(block.getPositionAtTime(position, 0.0));
+}
+
+TEST(PolynomialSplineVectorBlock, evaluate3d)
+{
+  checkAgainstContainers<3>();
+}
+
+TEST(PolynomialSplineVectorBlock, evaluate12d)
+{
+  checkAgainstContainers<12>();
+}
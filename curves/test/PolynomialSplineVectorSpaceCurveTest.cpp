@@ -79,3 +79,246 @@ TEST(PolynomialSplineQuinticVector3Curve, Debugging)
 //  EXPECT_EQ(ValueType::Position(), curve.evaluate(1.0).getPosition());
 //  EXPECT_EQ(ValueType::Rotation(), curve.evaluate(1.0).getRotation());
 }
+
+TEST(PolynomialSplineQuinticVector3Curve, fitWithDerivatives)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values, firstDerivatives, secondDerivatives;
+
+  for (int i = 0; i < 20; ++i) {
+    const Time time = 0.25 * i;
+    times.push_back(time);
+    values.push_back(ValueType(std::sin(time), std::cos(time), time * time));
+    firstDerivatives.push_back(ValueType(std::cos(time), -std::sin(time), 2.0 * time));
+    secondDerivatives.push_back(ValueType(-std::sin(time), -std::cos(time), 2.0));
+  }
+
+  for (bool parallel : {false, true}) {
+    curve.fitCurve(times, values, firstDerivatives, secondDerivatives, NULL, parallel);
+    ASSERT_NEAR(times.back(), curve.getMaxTime(), 1e-10);
+
+    ValueType value, derivative;
+    for (size_t i = 0; i < times.size(); ++i) {
+      ASSERT_TRUE(curve.evaluate(value, times[i]));
+      EXPECT_TRUE(values[i].isApprox(value, 1e-8)) << "knot: " << i;
+      ASSERT_TRUE(curve.evaluateDerivative(derivative, times[i], 1));
+      EXPECT_TRUE(firstDerivatives[i].isApprox(derivative, 1e-8)) << "knot: " << i;
+      ASSERT_TRUE(curve.evaluateDerivative(derivative, times[i], 2));
+      EXPECT_TRUE(secondDerivatives[i].isApprox(derivative, 1e-8)) << "knot: " << i;
+    }
+
+    // Between the knots the curve follows the sampled function closely.
+    ASSERT_TRUE(curve.evaluate(value, 1.6));
+    EXPECT_NEAR(std::sin(1.6), value(0), 1e-5);
+    EXPECT_NEAR(std::cos(1.6), value(1), 1e-5);
+  }
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, fitSplineOpts)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<PolynomialSplineBase::SplineOpts> splineOpts;
+
+  // Two splines per dimension, dimension after dimension.
+  for (int i = 0; i < 3; ++i) {
+    PolynomialSplineBase::SplineOpts opts;
+    opts.tf = 1.0;
+    opts.pos0 = 0.0;
+    opts.posT = 1.0 + i;
+    opts.velT = 0.5;
+    splineOpts.push_back(opts);
+    opts.tf = 2.0;
+    opts.pos0 = 1.0 + i;
+    opts.posT = -1.0;
+    opts.vel0 = 0.5;
+    opts.velT = 0.0;
+    splineOpts.push_back(opts);
+  }
+
+  curve.fitCurve(splineOpts);
+  EXPECT_NEAR(0.0, curve.getMinTime(), 1e-10);
+  EXPECT_NEAR(3.0, curve.getMaxTime(), 1e-10);
+
+  ValueType value;
+  ASSERT_TRUE(curve.evaluate(value, 1.0));
+  EXPECT_TRUE(ValueType(1.0, 2.0, 3.0).isApprox(value, 1e-10));
+  ASSERT_TRUE(curve.evaluate(value, 3.0));
+  EXPECT_TRUE(ValueType(-1.0, -1.0, -1.0).isApprox(value, 1e-10));
+  ASSERT_TRUE(curve.evaluateDerivative(value, 1.0, 1));
+  EXPECT_TRUE(ValueType(0.5, 0.5, 0.5).isApprox(value, 1e-10));
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, extrema)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+
+  times.push_back(0.0);
+  values.push_back(ValueType(0.0, 0.0, 0.0));
+  times.push_back(2.0);
+  values.push_back(ValueType(1.0, -2.0, 0.0));
+  curve.fitCurve(times, values);
+
+  // Rest-to-rest quintic: the peak velocity 15/8*|dx|/T is reached in the middle.
+  const std::vector<PolynomialSplineExtrema> extrema = curve.getExtrema();
+  ASSERT_EQ(3, extrema.size());
+  EXPECT_NEAR(1.0, extrema[0].position.maxAbsValue, 1e-10);
+  EXPECT_NEAR(2.0, extrema[0].position.time, 1e-10);
+  EXPECT_NEAR(15.0/16.0, extrema[0].velocity.maxAbsValue, 1e-10);
+  EXPECT_NEAR(1.0, extrema[0].velocity.time, 1e-10);
+  EXPECT_NEAR(15.0/8.0, extrema[1].velocity.maxAbsValue, 1e-10);
+  EXPECT_NEAR(0.0, extrema[2].velocity.maxAbsValue, 1e-10);
+  EXPECT_NEAR(60.0*2.0/8.0, extrema[1].jerk.maxAbsValue, 1e-10);
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, retime)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int i = 0; i < 8; ++i) {
+    times.push_back(0.5 * i);
+    values.push_back(ValueType(std::sin(1.3 * i), 0.2 * i, (i % 2) ? 0.5 : -0.5));
+  }
+  curve.fitCurve(times, values);
+
+  const ValueType maxVelocity(1.0, 0.5, 2.0);
+  const ValueType maxAcceleration(4.0, 1.0, 8.0);
+  ASSERT_TRUE(curve.retime(maxVelocity, maxAcceleration));
+
+  const std::vector<PolynomialSplineExtrema> extrema = curve.getExtrema();
+  double maxRatio = 0.0;
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_LE(extrema[i].velocity.maxAbsValue, maxVelocity(i) * (1.0 + 1.0e-5)) << "dim: " << i;
+    EXPECT_LE(extrema[i].acceleration.maxAbsValue, maxAcceleration(i) * (1.0 + 1.0e-5)) << "dim: " << i;
+    maxRatio = std::max(maxRatio, extrema[i].velocity.maxAbsValue / maxVelocity(i));
+    maxRatio = std::max(maxRatio, extrema[i].acceleration.maxAbsValue / maxAcceleration(i));
+  }
+  EXPECT_GT(maxRatio, 0.99);
+
+  ValueType value;
+  curve.evaluate(value, curve.getMaxTime());
+  EXPECT_TRUE(values.back().isApprox(value, 1e-8));
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, transformTime)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  times.push_back(2.0);
+  values.push_back(ValueType(0.0, 0.0, 0.0));
+  times.push_back(4.0);
+  values.push_back(ValueType(1.0, -2.0, 0.0));
+  curve.fitCurve(times, values);
+
+  // The curve is defined on the fitted time interval.
+  EXPECT_DOUBLE_EQ(2.0, curve.getMinTime());
+  EXPECT_DOUBLE_EQ(4.0, curve.getMaxTime());
+  ValueType value;
+  ASSERT_TRUE(curve.evaluate(value, 3.0));
+  EXPECT_TRUE(ValueType(0.5, -1.0, 0.0).isApprox(value, 1e-10));
+
+  // Speed up by a factor of two and move the start to t = 0.
+  curve.transformTime(0.5, -1.0);
+  EXPECT_DOUBLE_EQ(0.0, curve.getMinTime());
+  EXPECT_DOUBLE_EQ(1.0, curve.getMaxTime());
+  ASSERT_TRUE(curve.evaluate(value, 0.5));
+  EXPECT_TRUE(ValueType(0.5, -1.0, 0.0).isApprox(value, 1e-10));
+  ASSERT_TRUE(curve.evaluate(value, 1.0));
+  EXPECT_TRUE(values.back().isApprox(value, 1e-10));
+
+  // Rest-to-rest quintic: the peak velocity 15/8*|dx|/T is reached in the middle.
+  ASSERT_TRUE(curve.evaluateDerivative(value, 0.5, 1));
+  EXPECT_TRUE(ValueType(15.0/8.0, -15.0/4.0, 0.0).isApprox(value, 1e-10));
+  const std::vector<PolynomialSplineExtrema> extrema = curve.getExtrema();
+  EXPECT_NEAR(15.0/8.0, extrema[0].velocity.maxAbsValue, 1e-10);
+  EXPECT_NEAR(0.5, extrema[0].velocity.time, 1e-10);
+  EXPECT_NEAR(1.0, extrema[0].position.time, 1e-10);
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, evaluateState)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int i = 0; i < 6; ++i) {
+    times.push_back(1.0 + 0.5 * i);
+    values.push_back(ValueType(std::sin(1.3 * i), 0.2 * i, (i % 2) ? 0.5 : -0.5));
+  }
+  curve.fitCurve(times, values);
+  curve.transformTime(2.0, 1.0);
+
+  PolynomialSplineQuinticVector3Curve::StateType state;
+  for (Time time = curve.getMinTime(); time <= curve.getMaxTime(); time += 0.1) {
+    ASSERT_TRUE(curve.evaluateState(state, time));
+    ValueType value, velocity, acceleration;
+    curve.evaluate(value, time);
+    curve.evaluateDerivative(velocity, time, 1);
+    curve.evaluateDerivative(acceleration, time, 2);
+    EXPECT_TRUE(value.isApprox(state.position, 1e-10)) << "time: " << time;
+    EXPECT_TRUE((velocity - state.velocity).norm() < 1e-10) << "time: " << time;
+    EXPECT_TRUE((acceleration - state.acceleration).norm() < 1e-10) << "time: " << time;
+  }
+
+  curve.clear();
+  EXPECT_FALSE(curve.evaluateState(state, 0.0));
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, levelCrossings)
+{
+  PolynomialSplineQuinticVector3Curve curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  times.push_back(2.0);
+  values.push_back(ValueType(0.0, 0.0, 0.0));
+  times.push_back(4.0);
+  values.push_back(ValueType(1.0, -2.0, 0.0));
+  curve.fitCurve(times, values);
+  curve.transformTime(0.5, -1.0);
+
+  // Rest-to-rest quintic, symmetric around the middle of the curve.
+  std::vector<Time> crossingTimes;
+  curve.getLevelCrossingTimes(1, -1.0, curve.getMinTime(), curve.getMaxTime(), crossingTimes);
+  ASSERT_EQ(1, crossingTimes.size());
+  EXPECT_NEAR(0.5, crossingTimes[0], 1e-10);
+
+  Time crossingTime;
+  ASSERT_TRUE(curve.getFirstLevelCrossingTime(0, 0.25, 0.0, 1.0, crossingTime));
+  ValueType value;
+  curve.evaluate(value, crossingTime);
+  EXPECT_NEAR(0.25, value(0), 1e-10);
+  EXPECT_FALSE(curve.getFirstLevelCrossingTime(0, 0.25, 0.6, 1.0, crossingTime));
+}
+
+TEST(PolynomialSplineQuinticVector3Curve, insertKnot)
+{
+  PolynomialSplineQuinticVector3Curve curve, original;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int i = 0; i < 4; ++i) {
+    times.push_back(1.0 + 0.5 * i);
+    values.push_back(ValueType(std::sin(1.3 * i), 0.2 * i, (i % 2) ? 0.5 : -0.5));
+  }
+  curve.fitCurve(times, values);
+  original.fitCurve(times, values);
+  curve.transformTime(2.0, 1.0);
+  original.transformTime(2.0, 1.0);
+
+  ASSERT_TRUE(curve.insertKnot(4.4));
+  EXPECT_FALSE(curve.insertKnot(4.4));
+  EXPECT_FALSE(curve.insertKnot(curve.getMaxTime() + 0.1));
+  EXPECT_DOUBLE_EQ(original.getMaxTime(), curve.getMaxTime());
+
+  for (Time time = curve.getMinTime(); time <= curve.getMaxTime(); time += 0.05) {
+    ValueType value, expValue, velocity, expVelocity;
+    curve.evaluate(value, time);
+    original.evaluate(expValue, time);
+    curve.evaluateDerivative(velocity, time, 1);
+    original.evaluateDerivative(expVelocity, time, 1);
+    EXPECT_TRUE((expValue - value).norm() < 1e-10) << "time: " << time;
+    EXPECT_TRUE((expVelocity - velocity).norm() < 1e-9) << "time: " << time;
+  }
+}
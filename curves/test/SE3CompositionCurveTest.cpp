@@ -0,0 +1,532 @@
+/*
+ * SE3CompositionCurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kindr/Core>
+#include <kindr/common/gtest_eigen.hpp>
+
+#include "curves/CubicHermiteSE3Curve.hpp"
+#include "curves/DiscreteSE3Curve.hpp"
+#include "curves/SE3CompositionCurve.hpp"
+#include "curves/SlerpSE3Curve.hpp"
+
+using namespace curves;
+
+typedef SE3CompositionCurve<CubicHermiteSE3Curve, CubicHermiteSE3Curve> HermiteCompositionCurve;
+typedef HermiteCompositionCurve::ValueType ValueType;
+typedef HermiteCompositionCurve::DerivativeType DerivativeType;
+
+namespace {
+
+void getBaseSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  for (int k = 0; k <= 4; ++k) {
+    const double t = k;
+    times->push_back(t);
+    values->push_back(ValueType(ValueType::Position(std::cos(t), std::sin(t), 0.2 * t),
+                                ValueType::Rotation(kindr::EulerAnglesZyxD(0.6 * t, 0.1 * std::sin(t), -0.2))));
+  }
+}
+
+void expectNear(const ValueType& expected, const ValueType& actual, double tolerance, const std::string& msg)
+{
+  EXPECT_NEAR(0.0, (expected.getPosition().vector() - actual.getPosition().vector()).norm(), tolerance) << msg;
+  EXPECT_NEAR(0.0, expected.getRotation().getDisparityAngle(actual.getRotation()), tolerance) << msg;
+}
+
+} // namespace
+
+TEST(SE3CompositionCurveTest, identityCorrection)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getBaseSamples(&times, &values);
+  HermiteCompositionCurve curve;
+  curve.fitCurve(times, values);
+  CubicHermiteSE3Curve base;
+  base.fitCurve(times, values);
+  EXPECT_EQ(times.size(), curve.baseSize());
+  EXPECT_EQ(2, curve.correctionSize());
+
+  for (double time = times.front(); time <= times.back(); time += 0.1) {
+    ValueType value, expValue;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(base.evaluate(expValue, time));
+    expectNear(expValue, value, 1e-9, "time: " + std::to_string(time));
+
+    DerivativeType derivative, expDerivative;
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, time, 1));
+    ASSERT_TRUE(base.evaluateDerivative(expDerivative, time, 1));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector(), derivative.getVector(), 1e-6, "derivative", 1e-8);
+  }
+  ValueType value;
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+}
+
+TEST(SE3CompositionCurveTest, constantCorrection)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getBaseSamples(&times, &values);
+  HermiteCompositionCurve curve;
+  curve.fitCurve(times, values);
+  CubicHermiteSE3Curve base;
+  base.fitCurve(times, values);
+
+  // A constant correction is a rigid transformation of the whole curve.
+  const ValueType correction(ValueType::Position(0.5, -0.2, 0.1),
+                             ValueType::Rotation(kindr::EulerAnglesZyxD(0.3, -0.1, 0.2)));
+  curve.resetCorrectionCurve(times);
+  for (size_t i = 0; i < times.size(); ++i) {
+    curve.setCorrectionCoefficientAtTime(times[i], correction);
+  }
+
+  for (double time = times.front(); time <= times.back(); time += 0.1) {
+    ValueType value, baseValue;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(base.evaluate(baseValue, time));
+    expectNear(correction * baseValue, value, 1e-9, "time: " + std::to_string(time));
+  }
+}
+
+TEST(SE3CompositionCurveTest, composedKnots)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getBaseSamples(&times, &values);
+  HermiteCompositionCurve curve(HermiteCompositionCurve::kInterpolateComposedKnots);
+  curve.fitCurve(times, values);
+  CubicHermiteSE3Curve base;
+  base.fitCurve(times, values);
+
+  // Correction from identity to a small offset over the curve.
+  std::vector<Time> correctionTimes;
+  correctionTimes.push_back(times.front());
+  correctionTimes.push_back(times.back());
+  std::vector<ValueType> correctionValues;
+  correctionValues.push_back(ValueType());
+  correctionValues.push_back(ValueType(ValueType::Position(0.2, 0.1, -0.1),
+                                       ValueType::Rotation(kindr::EulerAnglesZyxD(0.2, 0.05, -0.1))));
+  CubicHermiteSE3Curve correction;
+  correction.fitCurve(correctionTimes, correctionValues);
+  curve.setCorrectionCoefficientAtTime(correctionTimes.back(), correctionValues.back());
+
+  const auto compose = [&](Time time) -> ValueType {
+    ValueType baseValue, correctionValue;
+    EXPECT_TRUE(base.evaluate(baseValue, time));
+    EXPECT_TRUE(correction.evaluate(correctionValue, time));
+    return correctionValue * baseValue;
+  };
+
+  // Exact pose and twist at the knots.
+  const double h = 1.0e-6;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ValueType value;
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(compose(times[i]), value, 1e-9, "knot: " + std::to_string(times[i]));
+
+    const Time timeA = std::max(times[i] - h, times.front());
+    const Time timeB = std::min(times[i] + h, times.back());
+    const ValueType valueA = compose(timeA);
+    const ValueType valueB = compose(timeB);
+    const Eigen::Vector3d linearVelocity = (valueB.getPosition().vector() - valueA.getPosition().vector()) / (timeB - timeA);
+    const Eigen::Vector3d angularVelocity = valueB.getRotation().boxMinus(valueA.getRotation()) / (timeB - timeA);
+    DerivativeType derivative;
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, times[i], 1));
+    EXPECT_NEAR(0.0, (linearVelocity - derivative.getTranslationalVelocity().vector()).norm(), 1e-4);
+    EXPECT_NEAR(0.0, (angularVelocity - derivative.getRotationalVelocity().vector()).norm(), 1e-4);
+  }
+
+  // Close to the composition in between, the knots are far apart compared to the motion.
+  for (double time = times.front(); time <= times.back(); time += 0.05) {
+    ValueType value;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    expectNear(compose(time), value, 5e-3, "time: " + std::to_string(time));
+  }
+}
+
+TEST(SE3CompositionCurveTest, invalidation)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getBaseSamples(&times, &values);
+  HermiteCompositionCurve curve(HermiteCompositionCurve::kInterpolateComposedKnots);
+  curve.fitCurve(times, values);
+  curve.resetCorrectionCurve(times);
+
+  std::vector<ValueType> before;
+  for (double time = times.front(); time <= times.back(); time += 0.25) {
+    before.push_back(ValueType());
+    ASSERT_TRUE(curve.evaluate(before.back(), time));
+  }
+
+  // The correction at a knot only changes the curve up to the neighboring knots.
+  const ValueType correction(ValueType::Position(0.1, 0.2, 0.3), ValueType::Rotation(kindr::EulerAnglesZyxD(0.4, 0.0, 0.0)));
+  curve.setCorrectionCoefficientAtTime(2.0, correction);
+  ValueType value;
+  ASSERT_TRUE(curve.evaluate(value, 2.0));
+  expectNear(correction * values[2], value, 1e-9, "corrected knot");
+  for (size_t i = 0; i < before.size(); ++i) {
+    const Time time = 0.25 * i;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    if (time <= 1.0 || time >= 3.0) {
+      expectNear(before[i], value, 1e-9, "time: " + std::to_string(time));
+    } else {
+      EXPECT_GT((before[i].getPosition().vector() - value.getPosition().vector()).norm(), 1e-6) << "time: " << time;
+    }
+  }
+
+  // Modifying base coefficients in place.
+  std::vector<Time> modifiedTimes(1, 4.0);
+  std::vector<ValueType> modifiedValues(1, ValueType(ValueType::Position(1.0, 1.0, 1.0), ValueType::Rotation()));
+  curve.modifyBaseCoefficientsValuesInBatch(modifiedTimes, modifiedValues);
+  ASSERT_TRUE(curve.evaluate(value, 4.0));
+  expectNear(modifiedValues.front(), value, 1e-9, "modified knot");
+  ASSERT_TRUE(curve.evaluate(value, 2.0));
+  expectNear(correction * values[2], value, 1e-9, "corrected knot");
+
+  curve.clear();
+  EXPECT_TRUE(curve.isEmpty());
+  EXPECT_FALSE(curve.evaluate(value, 2.0));
+}
+
+TEST(SE3CompositionCurveTest, foldInCorrections)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int k = 0; k <= 8; ++k) {
+    const double t = k;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(std::cos(0.5 * t), std::sin(0.5 * t), 0.1 * t),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.3 * t, 0.1 * std::sin(t), -0.2))));
+  }
+  HermiteCompositionCurve curve(HermiteCompositionCurve::kInterpolateComposedKnots);
+  curve.fitCurve(times, values);
+
+  std::vector<Time> correctionTimes;
+  for (int k = 0; k <= 8; k += 2) {
+    correctionTimes.push_back(k);
+  }
+  curve.resetCorrectionCurve(correctionTimes);
+  curve.setCorrectionCoefficientAtTime(6.0, ValueType(ValueType::Position(0.1, -0.2, 0.05),
+                                                      ValueType::Rotation(kindr::EulerAnglesZyxD(0.1, 0.0, 0.05))));
+  curve.setCorrectionCoefficientAtTime(8.0, ValueType(ValueType::Position(0.2, -0.1, 0.0),
+                                                      ValueType::Rotation(kindr::EulerAnglesZyxD(0.2, -0.05, 0.0))));
+
+  std::vector<ValueType> composedValues(times.size());
+  std::vector<DerivativeType> composedDerivatives(times.size());
+  std::vector<ValueType> baseValues(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(composedValues[i], times[i]));
+    ASSERT_TRUE(curve.evaluateDerivative(composedDerivatives[i], times[i], 1));
+    ASSERT_TRUE(curve.getBaseCurve().evaluate(baseValues[i], times[i]));
+  }
+
+  // Only the corrections at 6 and 8 are folded in, the base curve changes from the knot at 4 on.
+  curve.foldInCorrections(5.0, 8.0);
+  ValueType value;
+  DerivativeType derivative;
+  for (size_t i = 0; i < times.size(); ++i) {
+    const std::string msg = "knot: " + std::to_string(times[i]);
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(composedValues[i], value, 1e-9, msg);
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, times[i], 1));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(composedDerivatives[i].getVector(), derivative.getVector(), 1e-6, msg, 1e-8);
+    if (times[i] < 4.0) {
+      ASSERT_TRUE(curve.getBaseCurve().evaluate(value, times[i]));
+      expectNear(baseValues[i], value, 1e-12, msg);
+    }
+  }
+  for (Time time = 4.0; time <= 8.0; time += 0.25) {
+    ASSERT_TRUE(curve.getCorrectionCurve().evaluate(value, time));
+    expectNear(ValueType(), value, 1e-12, "correction: " + std::to_string(time));
+  }
+  EXPECT_EQ(correctionTimes.size(), curve.correctionSize());
+
+  // Folding in everything leaves an identity correction.
+  curve.setCorrectionCoefficientAtTime(2.0, ValueType(ValueType::Position(0.0, 0.3, 0.0), ValueType::Rotation()));
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(composedValues[i], times[i]));
+  }
+  curve.foldInCorrections();
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(composedValues[i], value, 1e-9, "knot: " + std::to_string(times[i]));
+    ASSERT_TRUE(curve.getCorrectionCurve().evaluate(value, times[i]));
+    expectNear(ValueType(), value, 1e-12, "correction: " + std::to_string(times[i]));
+  }
+}
+
+TEST(SE3CompositionCurveTest, extend)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int k = 0; k <= 20; ++k) {
+    const double t = 0.5 * k;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(std::cos(0.5 * t), std::sin(0.5 * t), 0.1 * t),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.3 * t, 0.1 * std::sin(t), -0.2))));
+  }
+
+  // Extending in batches gives the same base curve as fitting it at once.
+  HermiteCompositionCurve curve;
+  std::vector<Time> firstTimes(times.begin(), times.begin() + 8);
+  std::vector<ValueType> firstValues(values.begin(), values.begin() + 8);
+  curve.extend(firstTimes, firstValues);
+  EXPECT_EQ(firstTimes.size(), curve.baseSize());
+  EXPECT_EQ(2, curve.correctionSize());
+
+  // A correction at the end of the first batch, which is held constant by the next extend.
+  const ValueType correction(ValueType::Position(0.1, -0.2, 0.05), ValueType::Rotation(kindr::EulerAnglesZyxD(0.1, 0.0, 0.05)));
+  curve.setCorrectionCoefficientAtTime(firstTimes.back(), correction);
+  std::vector<ValueType> before(firstTimes.size());
+  for (size_t i = 0; i + 1 < firstTimes.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(before[i], firstTimes[i]));
+  }
+
+  std::vector<Time> secondTimes(times.begin() + 8, times.end());
+  std::vector<ValueType> secondValues;
+  for (size_t i = 8; i < values.size(); ++i) {
+    secondValues.push_back(correction * values[i]);
+  }
+  std::vector<Key> keys;
+  curve.extend(secondTimes, secondValues, &keys);
+  EXPECT_EQ(secondTimes.size(), keys.size());
+  EXPECT_EQ(times.size(), curve.baseSize());
+  EXPECT_EQ(3, curve.correctionSize());
+
+  // The composed curve passes through the new values and is unchanged before the last knot of the first batch.
+  ValueType value;
+  for (size_t i = 0; i < secondTimes.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, secondTimes[i]));
+    expectNear(secondValues[i], value, 1e-9, "new knot: " + std::to_string(secondTimes[i]));
+  }
+  for (size_t i = 0; i + 2 < firstTimes.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, firstTimes[i]));
+    expectNear(before[i], value, 1e-9, "old knot: " + std::to_string(firstTimes[i]));
+  }
+
+  // The base curve with the inverted corrections matches a single fit.
+  for (size_t i = 8; i < values.size(); ++i) {
+    values[i] = correction.inverted() * secondValues[i - 8];
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    ASSERT_TRUE(curve.getBaseCurve().evaluate(values[i], times[i]));
+  }
+  CubicHermiteSE3Curve base;
+  base.fitCurve(times, values);
+  for (double time = times.front(); time <= times.back(); time += 0.1) {
+    ValueType expValue;
+    ASSERT_TRUE(base.evaluate(expValue, time));
+    ASSERT_TRUE(curve.getBaseCurve().evaluate(value, time));
+    expectNear(expValue, value, 1e-9, "time: " + std::to_string(time));
+  }
+}
+
+TEST(SE3CompositionCurveTest, extendSamplingRatio)
+{
+  typedef SE3CompositionCurve<SlerpSE3Curve, SlerpSE3Curve> SlerpCompositionCurve;
+  SlerpCompositionCurve curve;
+  curve.setSamplingRatio(4);
+  SlerpSE3Curve slerpCurve;
+  slerpCurve.setSamplingRatio(4);
+
+  // The correction curve is sampled like a curve with the same ratio.
+  std::vector<ValueType> values;
+  for (int k = 0; k < 12; ++k) {
+    const Time time = 0.1 * k;
+    values.push_back(ValueType(ValueType::Position(time, std::sin(time), 0.0),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.5 * time, 0.0, 0.0))));
+    curve.extend(std::vector<Time>(1, time), std::vector<ValueType>(1, values.back()));
+    slerpCurve.extend(std::vector<Time>(1, time), std::vector<ValueType>(1, ValueType()));
+    ValueType value;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    expectNear(values.back(), value, 1e-9, "time: " + std::to_string(time));
+  }
+  EXPECT_EQ(12, curve.baseSize());
+  EXPECT_EQ(slerpCurve.size(), curve.correctionSize());
+  EXPECT_EQ(5, curve.correctionSize());
+
+  // A correction at the end stops the correction from being held and moved, the next extend
+  // adds a coefficient and leaves the correction before it unchanged.
+  const ValueType correction(ValueType::Position(0.0, 0.1, 0.0), ValueType::Rotation());
+  curve.setCorrectionCoefficientAtTime(curve.getMaxTime(), correction);
+  std::vector<ValueType> before(values.size());
+  for (int k = 0; k < 12; ++k) {
+    ASSERT_TRUE(curve.evaluate(before[k], 0.1 * k));
+  }
+  expectNear(correction * values.back(), before.back(), 1e-9, "corrected knot");
+  const Time time = 1.2;
+  curve.extend(std::vector<Time>(1, time), std::vector<ValueType>(1, correction * values.back()));
+  EXPECT_EQ(6, curve.correctionSize());
+  ValueType value;
+  for (int k = 0; k < 12; ++k) {
+    ASSERT_TRUE(curve.evaluate(value, 0.1 * k));
+    expectNear(before[k], value, 1e-9, "knot: " + std::to_string(k));
+  }
+  ASSERT_TRUE(curve.evaluate(value, time));
+  expectNear(correction * values.back(), value, 1e-9, "new knot");
+}
+
+TEST(SE3CompositionCurveTest, extendComposedKnots)
+{
+  // Extending one pose at a time only recomputes the composed knots at the end of the curve,
+  // which gives the same curve as recomputing all of them.
+  const auto build = [](HermiteCompositionCurve* curve) {
+    curve->setSamplingRatio(3);
+    for (int k = 0; k <= 20; ++k) {
+      const Time time = 0.25 * k;
+      curve->extend(std::vector<Time>(1, time),
+                    std::vector<ValueType>(1, ValueType(ValueType::Position(std::cos(time), std::sin(time), 0.1 * time),
+                                                        ValueType::Rotation(kindr::EulerAnglesZyxD(0.3 * time, 0.0, 0.1)))));
+      if (k == 10) {
+        curve->setCorrectionCoefficientAtTime(curve->getMaxTime(),
+                                              ValueType(ValueType::Position(0.1, -0.1, 0.0),
+                                                        ValueType::Rotation(kindr::EulerAnglesZyxD(0.1, 0.0, 0.0))));
+      }
+    }
+  };
+  HermiteCompositionCurve curve(HermiteCompositionCurve::kInterpolateComposedKnots);
+  build(&curve);
+  HermiteCompositionCurve rebuiltCurve(HermiteCompositionCurve::kComposeCurves);
+  build(&rebuiltCurve);
+  rebuiltCurve.setCompositionStrategy(HermiteCompositionCurve::kInterpolateComposedKnots);
+  EXPECT_LT(curve.correctionSize(), curve.baseSize());
+
+  for (double time = curve.getMinTime(); time <= curve.getMaxTime(); time += 0.05) {
+    ValueType value, expValue;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(rebuiltCurve.evaluate(expValue, time));
+    expectNear(expValue, value, 1e-12, "time: " + std::to_string(time));
+    DerivativeType derivative, expDerivative;
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, time, 1));
+    ASSERT_TRUE(rebuiltCurve.evaluateDerivative(expDerivative, time, 1));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector(), derivative.getVector(), 1e-9, "derivative", 1e-10);
+  }
+
+  // Removing a correction coefficient only recomputes the knots around it.
+  std::vector<Time> correctionTimes;
+  curve.getCurveTimes(&correctionTimes);
+  ASSERT_GT(correctionTimes.size(), 2u);
+  curve.removeCorrectionCoefficientAtTime(correctionTimes[1]);
+  rebuiltCurve.removeCorrectionCoefficientAtTime(correctionTimes[1]);
+  rebuiltCurve.setCompositionStrategy(HermiteCompositionCurve::kComposeCurves);
+  rebuiltCurve.setCompositionStrategy(HermiteCompositionCurve::kInterpolateComposedKnots);
+  for (double time = curve.getMinTime(); time <= curve.getMaxTime(); time += 0.05) {
+    ValueType value, expValue;
+    ASSERT_TRUE(curve.evaluate(value, time));
+    ASSERT_TRUE(rebuiltCurve.evaluate(expValue, time));
+    expectNear(expValue, value, 1e-12, "time: " + std::to_string(time));
+  }
+}
+
+TEST(SE3CompositionCurveTest, compositionStrategy)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getBaseSamples(&times, &values);
+  HermiteCompositionCurve curve;
+  EXPECT_EQ(HermiteCompositionCurve::kComposeCurves, curve.getCompositionStrategy());
+  curve.fitCurve(times, values);
+  CubicHermiteSE3Curve base;
+  base.fitCurve(times, values);
+
+  std::vector<Time> correctionTimes;
+  correctionTimes.push_back(times.front());
+  correctionTimes.push_back(times.back());
+  std::vector<ValueType> correctionValues;
+  correctionValues.push_back(ValueType());
+  correctionValues.push_back(ValueType(ValueType::Position(0.2, 0.1, -0.1),
+                                       ValueType::Rotation(kindr::EulerAnglesZyxD(0.2, 0.05, -0.1))));
+  CubicHermiteSE3Curve correction;
+  correction.fitCurve(correctionTimes, correctionValues);
+  curve.setCorrectionCoefficientAtTime(correctionTimes.back(), correctionValues.back());
+
+  // Exact composition everywhere, the interpolation of the composed knots only at the knots.
+  for (double time = times.front(); time <= times.back(); time += 0.05) {
+    ValueType baseValue, correctionValue, value, interpolatedValue;
+    ASSERT_TRUE(base.evaluate(baseValue, time));
+    ASSERT_TRUE(correction.evaluate(correctionValue, time));
+    curve.setCompositionStrategy(HermiteCompositionCurve::kComposeCurves);
+    ASSERT_TRUE(curve.evaluate(value, time));
+    expectNear(correctionValue * baseValue, value, 1e-9, "time: " + std::to_string(time));
+
+    curve.setCompositionStrategy(HermiteCompositionCurve::kInterpolateComposedKnots);
+    ASSERT_TRUE(curve.evaluate(interpolatedValue, time));
+    expectNear(value, interpolatedValue, 5e-3, "time: " + std::to_string(time));
+  }
+
+  for (size_t i = 0; i < times.size(); ++i) {
+    DerivativeType derivative, interpolatedDerivative;
+    curve.setCompositionStrategy(HermiteCompositionCurve::kComposeCurves);
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, times[i], 1));
+    curve.setCompositionStrategy(HermiteCompositionCurve::kInterpolateComposedKnots);
+    ASSERT_TRUE(curve.evaluateDerivative(interpolatedDerivative, times[i], 1));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(derivative.getVector(), interpolatedDerivative.getVector(), 1e-6, "derivative", 1e-8);
+  }
+}
+
+namespace {
+
+/// Curves with kinks at their knots are composed exactly whatever the strategy.
+template <class CompositionCurve>
+void expectExactComposition(const std::string& msg)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int k = 0; k <= 2; ++k) {
+    times.push_back(k);
+  }
+  values.push_back(ValueType(ValueType::Position(0.0, 0.0, 0.0), ValueType::Rotation()));
+  values.push_back(ValueType(ValueType::Position(1.0, 0.0, 0.0), ValueType::Rotation()));
+  values.push_back(ValueType(ValueType::Position(1.0, 1.0, 0.0), ValueType::Rotation()));
+  CompositionCurve curve(CompositionCurve::kInterpolateComposedKnots);
+  curve.fitCurve(times, values);
+  curve.setCorrectionTimes(times);
+
+  for (int strategy = 0; strategy < 2; ++strategy) {
+    for (double time = times.front(); time <= times.back(); time += 0.25) {
+      ValueType value, baseValue, correctionValue;
+      ASSERT_TRUE(curve.evaluate(value, time));
+      ASSERT_TRUE(curve.getBaseCurve().evaluate(baseValue, time));
+      ASSERT_TRUE(curve.getCorrectionCurve().evaluate(correctionValue, time));
+      expectNear(correctionValue * baseValue, value, 1e-12, msg + ", time: " + std::to_string(time));
+    }
+    // A correction at the middle knot.
+    curve.setCorrectionCoefficientAtTime(1.0, ValueType(ValueType::Position(0.0, 0.5, 0.0),
+                                                        ValueType::Rotation(kindr::EulerAnglesZyxD(0.3, 0.0, 0.0))));
+  }
+}
+
+} // namespace
+
+TEST(SE3CompositionCurveTest, nonC1Composition)
+{
+  typedef SE3CompositionCurve<SlerpSE3Curve, SlerpSE3Curve> SlerpCompositionCurve;
+  typedef SE3CompositionCurve<DiscreteSE3Curve, DiscreteSE3Curve> DiscreteCompositionCurve;
+  expectExactComposition<SlerpCompositionCurve>("slerp");
+  expectExactComposition<DiscreteCompositionCurve>("discrete");
+
+  // The kink of the path at the middle knot is kept.
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (int k = 0; k <= 2; ++k) {
+    times.push_back(k);
+  }
+  values.push_back(ValueType(ValueType::Position(0.0, 0.0, 0.0), ValueType::Rotation()));
+  values.push_back(ValueType(ValueType::Position(1.0, 0.0, 0.0), ValueType::Rotation()));
+  values.push_back(ValueType(ValueType::Position(1.0, 1.0, 0.0), ValueType::Rotation()));
+  SlerpCompositionCurve slerpCurve(SlerpCompositionCurve::kInterpolateComposedKnots);
+  slerpCurve.fitCurve(times, values);
+  DiscreteCompositionCurve discreteCurve(DiscreteCompositionCurve::kInterpolateComposedKnots);
+  discreteCurve.fitCurve(times, values);
+  ValueType value;
+  ASSERT_TRUE(slerpCurve.evaluate(value, 0.5));
+  expectNear(ValueType(ValueType::Position(0.5, 0.0, 0.0), ValueType::Rotation()), value, 1e-12, "slerp");
+  ASSERT_TRUE(discreteCurve.evaluate(value, 0.5));
+  expectNear(values.front(), value, 1e-12, "discrete");
+}
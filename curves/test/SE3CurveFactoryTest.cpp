@@ -0,0 +1,118 @@
+/*
+ * SE3CurveFactoryTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kindr/Core>
+
+#include "curves/SE3CurveFactory.hpp"
+
+using namespace curves;
+
+typedef SE3Curve::ValueType ValueType;
+
+namespace {
+
+// Fits the curve and checks it at the knots.
+void expectCurveWorks(SE3Curve* curve, const std::string& msg)
+{
+  ASSERT_TRUE(curve != NULL) << msg;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (size_t k = 0; k < 4; ++k) {
+    const double t = 0.5 * k;
+    times.push_back(t);
+    values.push_back(ValueType(ValueType::Position(t, std::sin(t), 0.0),
+                               ValueType::Rotation(kindr::EulerAnglesZyxD(0.3 * t, 0.0, 0.0))));
+  }
+  curve->fitCurve(times, values);
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve->evaluate(value, times[i])) << msg;
+    EXPECT_NEAR(0.0, (values[i].getPosition().vector() - value.getPosition().vector()).norm(), 1e-6) << msg;
+  }
+}
+
+template <SE3CurveType Type>
+bool isCurveOfType(SE3Curve* curve)
+{
+  return dynamic_cast<typename SE3CurveTypeTraits<Type>::Curve*>(curve) != NULL;
+}
+
+bool isCurveOfType(SE3CurveType type, SE3Curve* curve)
+{
+  switch (type) {
+    case kSlerpSE3Curve: return isCurveOfType<kSlerpSE3Curve>(curve);
+    case kDiscreteSE3Curve: return isCurveOfType<kDiscreteSE3Curve>(curve);
+    case kCubicHermiteSE3Curve: return isCurveOfType<kCubicHermiteSE3Curve>(curve);
+    case kSlerpCompositionCurve: return isCurveOfType<kSlerpCompositionCurve>(curve);
+    case kSlerpHermiteCompositionCurve: return isCurveOfType<kSlerpHermiteCompositionCurve>(curve);
+    case kDiscreteCompositionCurve: return isCurveOfType<kDiscreteCompositionCurve>(curve);
+    default: return false;
+  }
+}
+
+} // namespace
+
+TEST(SE3CurveFactoryTest, createCurve)
+{
+  for (int i = 0; i < kNumSE3CurveTypes; ++i) {
+    const SE3CurveType type = static_cast<SE3CurveType>(i);
+    const std::string name = SE3CurveFactory::getCurveName(type);
+    SE3CurveType typeOfName;
+    ASSERT_TRUE(SE3CurveFactory::getCurveType(name, &typeOfName)) << name;
+    EXPECT_EQ(type, typeOfName) << name;
+
+    std::shared_ptr<SE3Curve> curve = SE3CurveFactory::create_curve(name);
+    EXPECT_TRUE(isCurveOfType(type, curve.get())) << name;
+    expectCurveWorks(curve.get(), name);
+
+    curve = SE3CurveFactory::createCurve(type);
+    EXPECT_TRUE(isCurveOfType(type, curve.get())) << name;
+  }
+  SE3CurveType type;
+  EXPECT_FALSE(SE3CurveFactory::getCurveType("semi_discrete_composition_curve", &type));
+}
+
+TEST(SE3CurveFactoryTest, constructCurve)
+{
+  SE3CurveFactory::Storage storage;
+  for (int i = 0; i < kNumSE3CurveTypes; ++i) {
+    const SE3CurveType type = static_cast<SE3CurveType>(i);
+    SE3Curve* curve = SE3CurveFactory::constructCurve(type, &storage);
+    EXPECT_TRUE(isCurveOfType(type, curve)) << SE3CurveFactory::getCurveName(type);
+    expectCurveWorks(curve, SE3CurveFactory::getCurveName(type));
+    SE3CurveFactory::destroyCurve(curve);
+  }
+}
+
+TEST(SE3CurvePoolTest, createCurve)
+{
+  SE3CurvePool pool(2);
+  EXPECT_EQ(0u, pool.getCapacity());
+  {
+    SE3CurvePool::CurvePtr slerp = pool.createCurve(kSlerpSE3Curve);
+    SE3CurvePool::CurvePtr hermite = pool.createCurve(kCubicHermiteSE3Curve);
+    EXPECT_EQ(2u, pool.getCapacity());
+    EXPECT_EQ(0u, pool.getNumFreeBlocks());
+    SE3CurvePool::CurvePtr composition = pool.createCurve(kSlerpCompositionCurve);
+    EXPECT_EQ(4u, pool.getCapacity());
+    EXPECT_TRUE(isCurveOfType(kSlerpSE3Curve, slerp.get()));
+    EXPECT_TRUE(isCurveOfType(kCubicHermiteSE3Curve, hermite.get()));
+    EXPECT_TRUE(isCurveOfType(kSlerpCompositionCurve, composition.get()));
+    expectCurveWorks(composition.get(), "composition");
+
+    // The storage of a released curve is reused.
+    SE3Curve* released = hermite.get();
+    hermite.reset();
+    EXPECT_EQ(2u, pool.getNumFreeBlocks());
+    SE3CurvePool::CurvePtr discrete = pool.createCurve(kDiscreteSE3Curve);
+    EXPECT_EQ(static_cast<void*>(released), static_cast<void*>(discrete.get()));
+    EXPECT_TRUE(isCurveOfType(kDiscreteSE3Curve, discrete.get()));
+  }
+  EXPECT_EQ(4u, pool.getCapacity());
+  EXPECT_EQ(4u, pool.getNumFreeBlocks());
+}
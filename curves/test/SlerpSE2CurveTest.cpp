@@ -0,0 +1,157 @@
+/*
+ * SlerpSE2CurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "curves/SlerpSE2Curve.hpp"
+
+using namespace curves;
+
+typedef SlerpSE2Curve::ValueType ValueType;
+typedef SlerpSE2Curve::DerivativeType DerivativeType;
+
+namespace {
+
+void getSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  const double sampleTimes[] = {0.0, 0.5, 1.5, 2.0, 3.2};
+  for (size_t k = 0; k < 5; ++k) {
+    const double t = sampleTimes[k];
+    times->push_back(t);
+    values->push_back(ValueType(std::cos(t), std::sin(t), 0.8 * t));
+  }
+}
+
+void expectNear(const ValueType& expected, const ValueType& actual, double tolerance, const std::string& msg)
+{
+  EXPECT_NEAR(0.0, (expected.getPosition() - actual.getPosition()).norm(), tolerance) << msg;
+  EXPECT_NEAR(0.0, ValueType::getAngleDifference(expected.getRotation(), actual.getRotation()), tolerance) << msg;
+}
+
+} // namespace
+
+TEST(SlerpSE2CurveTest, evaluate)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-12, "knot: " + std::to_string(times[i]));
+  }
+  EXPECT_FALSE(curve.evaluate(value, times.front() - 0.1));
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+
+  // A(A^-1 B)^alpha with the power of the rotation and the translation.
+  for (size_t i = 0; i + 1 < times.size(); ++i) {
+    const double alpha = 0.3;
+    ASSERT_TRUE(curve.evaluate(value, times[i] + alpha * (times[i+1] - times[i])));
+    EXPECT_NEAR(0.0, (value.getPosition() - ((1.0 - alpha) * values[i].getPosition()
+        + alpha * values[i+1].getPosition())).norm(), 1e-12);
+    EXPECT_NEAR(values[i].getRotation().angle() + alpha * (values[i+1].getRotation().angle()
+        - values[i].getRotation().angle()), value.getRotation().angle(), 1e-12);
+  }
+}
+
+TEST(SlerpSE2CurveTest, angleWrap)
+{
+  // The heading crosses +-pi, it has to be interpolated along the shortest arc.
+  std::vector<Time> times = {0.0, 1.0};
+  std::vector<ValueType> values = {ValueType(0.0, 0.0, M_PI - 0.1), ValueType(1.0, 0.0, -M_PI + 0.1)};
+  SlerpSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  ASSERT_TRUE(curve.evaluate(value, 0.5));
+  expectNear(ValueType(0.5, 0.0, M_PI), value, 1e-12, "wrap");
+
+  DerivativeType derivative;
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, 0.5, 1));
+  EXPECT_NEAR(1.0, derivative(0), 1e-12);
+  EXPECT_NEAR(0.2, derivative(2), 1e-12);
+}
+
+TEST(SlerpSE2CurveTest, evaluateDerivative)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  const double h = 1e-6;
+  DerivativeType derivative;
+  ValueType before, after;
+  for (double t = 0.05; t < times.back(); t += 0.3) {
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, t, 1));
+    ASSERT_TRUE(curve.evaluate(before, t - h));
+    ASSERT_TRUE(curve.evaluate(after, t + h));
+    const DerivativeType expDerivative = after.boxMinus(before) / (2.0 * h);
+    EXPECT_NEAR(0.0, (expDerivative - derivative).norm(), 1e-6) << "time: " << t;
+
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, t, 2));
+    EXPECT_EQ(0.0, derivative.norm());
+  }
+  EXPECT_FALSE(curve.evaluateDerivative(derivative, times.back() + 0.1, 1));
+}
+
+TEST(SlerpSE2CurveTest, evaluateInBatchAndState)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  std::vector<Time> queryTimes;
+  for (double t = times.front(); t <= times.back(); t += 0.1) {
+    queryTimes.push_back(t);
+  }
+  queryTimes.push_back(times.back());
+  std::vector<ValueType> batchValues;
+  ASSERT_TRUE(curve.evaluateInBatch(batchValues, queryTimes));
+  ASSERT_EQ(queryTimes.size(), batchValues.size());
+
+  ValueType value;
+  DerivativeType derivative;
+  SlerpSE2Curve::State state;
+  for (size_t i = 0; i < queryTimes.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, queryTimes[i]));
+    expectNear(value, batchValues[i], 1e-12, "time: " + std::to_string(queryTimes[i]));
+
+    ASSERT_TRUE(curve.evaluateState(state, queryTimes[i]));
+    expectNear(value, state.value, 1e-12, "time: " + std::to_string(queryTimes[i]));
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, queryTimes[i], 1));
+    EXPECT_NEAR(0.0, (derivative - state.velocity).norm(), 1e-12);
+    EXPECT_EQ(0.0, state.acceleration.norm());
+  }
+
+  queryTimes.push_back(times.back() + 0.1);
+  EXPECT_FALSE(curve.evaluateInBatch(batchValues, queryTimes));
+}
+
+TEST(SlerpSE2CurveTest, transformCurve)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE2Curve curve;
+  curve.fitCurve(times, values);
+
+  const ValueType T(0.5, -1.0, 0.7);
+  curve.transformCurve(T);
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(T * values[i], value, 1e-12, "knot: " + std::to_string(times[i]));
+  }
+}
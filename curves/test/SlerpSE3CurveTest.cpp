@@ -0,0 +1,160 @@
+/*
+ * SlerpSE3CurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <kindr/Core>
+#include <kindr/common/gtest_eigen.hpp>
+
+#include "curves/SlerpSE3Curve.hpp"
+
+using namespace curves;
+
+typedef SlerpSE3Curve::ValueType ValueType;
+typedef SlerpSE3Curve::DerivativeType DerivativeType;
+
+namespace {
+
+void getSamples(std::vector<Time>* times, std::vector<ValueType>* values)
+{
+  const double sampleTimes[] = {0.0, 0.5, 1.5, 2.0, 3.2};
+  for (size_t k = 0; k < 5; ++k) {
+    const double t = sampleTimes[k];
+    times->push_back(t);
+    values->push_back(ValueType(ValueType::Position(std::cos(t), std::sin(t), 0.3 * t),
+                                ValueType::Rotation(kindr::EulerAnglesZyxD(0.8 * t, 0.2 * std::sin(t), -0.4 * t))));
+  }
+}
+
+void expectNear(const ValueType& expected, const ValueType& actual, double tolerance, const std::string& msg)
+{
+  EXPECT_NEAR(0.0, (expected.getPosition().vector() - actual.getPosition().vector()).norm(), tolerance) << msg;
+  EXPECT_NEAR(0.0, expected.getRotation().getDisparityAngle(actual.getRotation()), tolerance) << msg;
+}
+
+} // namespace
+
+TEST(SlerpSE3CurveTest, evaluate)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE3Curve curve;
+  curve.fitCurve(times, values);
+
+  ValueType value;
+  for (size_t i = 0; i < times.size(); ++i) {
+    ASSERT_TRUE(curve.evaluate(value, times[i]));
+    expectNear(values[i], value, 1e-12, "knot: " + std::to_string(times[i]));
+  }
+  EXPECT_FALSE(curve.evaluate(value, times.front() - 0.1));
+  EXPECT_FALSE(curve.evaluate(value, times.back() + 0.1));
+
+  // A(A^-1 B)^alpha with the power of the rotation and the translation.
+  for (size_t i = 0; i + 1 < times.size(); ++i) {
+    const double alpha = 0.3;
+    const ValueType expValue = values[i] * transformationPower(inverseTransformation(values[i]) * values[i+1], alpha);
+    ASSERT_TRUE(curve.evaluate(value, times[i] + alpha * (times[i+1] - times[i])));
+    expectNear(expValue, value, 1e-9, "segment: " + std::to_string(i));
+  }
+}
+
+TEST(SlerpSE3CurveTest, transformationPower)
+{
+  const ValueType T(ValueType::Position(1.0, -2.0, 0.5), ValueType::Rotation(kindr::EulerAnglesZyxD(0.6, -0.3, 0.2)));
+  expectNear(ValueType(), transformationPower(T, 0.0), 1e-12, "power 0");
+  expectNear(T, transformationPower(T, 1.0), 1e-12, "power 1");
+  const ValueType half = transformationPower(T, 0.5);
+  expectNear(T, ValueType(ValueType::Position(2.0 * half.getPosition().vector()), half.getRotation() * half.getRotation()),
+             1e-12, "power 0.5");
+  expectNear(ValueType(), inverseTransformation(T) * T, 1e-12, "inverse");
+  expectNear(ValueType(), invertAndComposeImplementation(T, T), 1e-12, "invert and compose");
+}
+
+TEST(SlerpSE3CurveTest, evaluateDerivative)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE3Curve curve;
+  curve.fitCurve(times, values);
+
+  // The twist is constant within a segment, compare with central differences.
+  const double h = 1.0e-6;
+  for (double time = times.front() + 0.05; time < times.back(); time += 0.1) {
+    ValueType valueA, valueB;
+    ASSERT_TRUE(curve.evaluate(valueA, time - h));
+    ASSERT_TRUE(curve.evaluate(valueB, time + h));
+    const Eigen::Vector3d linearVelocity = (valueB.getPosition().vector() - valueA.getPosition().vector()) / (2.0 * h);
+    const Eigen::Vector3d angularVelocity = valueB.getRotation().boxMinus(valueA.getRotation()) / (2.0 * h);
+    DerivativeType derivative;
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, time, 1));
+    EXPECT_NEAR(0.0, (linearVelocity - derivative.getTranslationalVelocity().vector()).norm(), 1e-6) << "time: " << time;
+    EXPECT_NEAR(0.0, (angularVelocity - derivative.getRotationalVelocity().vector()).norm(), 1e-6) << "time: " << time;
+
+    ASSERT_TRUE(curve.evaluateDerivative(derivative, time, 2));
+    KINDR_ASSERT_DOUBLE_MX_EQ_ZT(Eigen::VectorXd::Zero(6), derivative.getVector(), 1e-6, "second derivative", 1e-12);
+  }
+
+  // On a knot, the slope to the next knot, on the last knot the slope of the last segment.
+  DerivativeType derivative, expDerivative;
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times[1], 1));
+  ASSERT_TRUE(curve.evaluateDerivative(expDerivative, 0.5 * (times[1] + times[2]), 1));
+  KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector(), derivative.getVector(), 1e-6, "knot", 1e-12);
+  ASSERT_TRUE(curve.evaluateDerivative(derivative, times.back(), 1));
+  ASSERT_TRUE(curve.evaluateDerivative(expDerivative, times.back() - 0.1, 1));
+  KINDR_ASSERT_DOUBLE_MX_EQ_ZT(expDerivative.getVector(), derivative.getVector(), 1e-6, "last knot", 1e-12);
+  EXPECT_FALSE(curve.evaluateDerivative(derivative, times.back() + 0.1, 1));
+}
+
+TEST(SlerpSE3CurveTest, evaluateInBatch)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE3Curve curve;
+  curve.fitCurve(times, values);
+
+  std::vector<Time> queryTimes;
+  for (double time = times.front(); time <= times.back(); time += 0.07) {
+    queryTimes.push_back(time);
+  }
+  queryTimes.push_back(times.back());
+  std::vector<ValueType> batchValues;
+  ASSERT_TRUE(curve.evaluateInBatch(batchValues, queryTimes));
+  ASSERT_EQ(queryTimes.size(), batchValues.size());
+  for (size_t i = 0; i < queryTimes.size(); ++i) {
+    ValueType value;
+    ASSERT_TRUE(curve.evaluate(value, queryTimes[i]));
+    expectNear(value, batchValues[i], 1e-12, "time: " + std::to_string(queryTimes[i]));
+  }
+
+  queryTimes.push_back(times.back() + 0.1);
+  EXPECT_FALSE(curve.evaluateInBatch(batchValues, queryTimes));
+}
+
+TEST(SlerpSE3CurveTest, modifiedCoefficients)
+{
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  getSamples(&times, &values);
+  SlerpSE3Curve curve;
+  curve.fitCurve(times, values);
+
+  // The cached segment follows coefficients which are modified in place.
+  const Time time = 0.5 * (times[1] + times[2]);
+  ValueType value;
+  ASSERT_TRUE(curve.evaluate(value, time));
+  const ValueType T(ValueType::Position(0.5, 0.0, -1.0), ValueType::Rotation(kindr::EulerAnglesZyxD(0.3, 0.0, 0.0)));
+  curve.transformCurve(T);
+  ValueType transformedValue;
+  ASSERT_TRUE(curve.evaluate(transformedValue, time));
+  expectNear(T * value, transformedValue, 1e-9, "transformed");
+
+  curve.setCurve(std::vector<Time>(1, times[2]), std::vector<ValueType>(1, ValueType()));
+  ASSERT_TRUE(curve.evaluate(value, times[2]));
+  expectNear(ValueType(), value, 1e-12, "modified knot");
+}
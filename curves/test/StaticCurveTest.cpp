@@ -0,0 +1,199 @@
+/*
+ * StaticCurveTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "curves/GaussianProcessVectorSpaceCurve.hpp"
+#include "curves/PolynomialSplineScalarCurve.hpp"
+#include "curves/PolynomialSplineVectorSpaceCurve.hpp"
+#include "curves/StaticCurve.hpp"
+
+using namespace curves;
+
+namespace {
+
+std::vector<Time> getEvaluationTimes()
+{
+  std::vector<Time> times;
+  for (double t = -0.5; t < 4.5; t += 0.01) times.push_back(t);
+  return times;
+}
+
+} // namespace
+
+TEST(StaticCurveTest, vectorSpaceCurve)
+{
+  typedef PolynomialSplineQuinticVector3Curve CurveType;
+  typedef CurveType::ValueType ValueType;
+  typedef CurveType::DerivativeType DerivativeType;
+  CurveType curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (size_t k = 0; k < 5; ++k) {
+    times.push_back(double(k));
+    values.push_back(ValueType(std::sin(double(k)), std::cos(double(k)), 0.5 * k));
+  }
+  curve.fitCurve(times, values);
+  const VectorSpaceCurve<3>& virtualCurve = curve;
+
+  const std::vector<Time> evaluationTimes = getEvaluationTimes();
+  std::vector<ValueType> batchValues;
+  std::vector<DerivativeType> batchDerivatives;
+  ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateInBatch(curve, evaluationTimes, batchValues));
+  ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateDerivativeInBatch(curve, evaluationTimes, 2, batchDerivatives));
+  ASSERT_EQ(evaluationTimes.size(), batchValues.size());
+  ASSERT_EQ(evaluationTimes.size(), batchDerivatives.size());
+
+  ValueType value, staticValue;
+  DerivativeType derivative, staticDerivative;
+  for (size_t i = 0; i < evaluationTimes.size(); ++i) {
+    const Time time = evaluationTimes[i];
+    ASSERT_TRUE(virtualCurve.evaluate(value, time));
+    ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluate(curve, staticValue, time));
+    EXPECT_EQ(value, staticValue);
+    EXPECT_EQ(value, batchValues[i]);
+    for (unsigned order = 1; order <= 2; ++order) {
+      ASSERT_TRUE(virtualCurve.evaluateDerivative(derivative, time, order));
+      ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateDerivative(curve, staticDerivative, time, order));
+      EXPECT_EQ(derivative, staticDerivative);
+    }
+    EXPECT_EQ(derivative, batchDerivatives[i]);
+  }
+  EXPECT_FALSE(StaticCurveTraits<CurveType>::evaluateDerivative(curve, derivative, 1.0, 7));
+}
+
+TEST(StaticCurveTest, scalarCurve)
+{
+  typedef PolynomialSplineQuinticScalarCurve CurveType;
+  CurveType curve;
+  std::vector<Time> times;
+  std::vector<double> values;
+  for (size_t k = 0; k < 5; ++k) {
+    times.push_back(double(k));
+    values.push_back(std::sin(double(k)));
+  }
+  curve.fitCurve(times, values);
+  curve.transformTime(2.0, 0.5);
+  const Curve<ScalarCurveConfig>& virtualCurve = curve;
+
+  const std::vector<Time> evaluationTimes = getEvaluationTimes();
+  std::vector<double> batchValues;
+  ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateInBatch(curve, evaluationTimes, batchValues));
+  double value, derivative, staticDerivative;
+  for (size_t i = 0; i < evaluationTimes.size(); ++i) {
+    ASSERT_TRUE(virtualCurve.evaluate(value, evaluationTimes[i]));
+    EXPECT_EQ(value, batchValues[i]);
+    ASSERT_TRUE(virtualCurve.evaluateDerivative(derivative, evaluationTimes[i], 1));
+    ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateDerivative(curve, staticDerivative, evaluationTimes[i], 1));
+    EXPECT_EQ(derivative, staticDerivative);
+  }
+}
+
+TEST(StaticCurveTest, compileTimeDerivativeOrder)
+{
+  typedef PolynomialSplineQuinticVector3Curve CurveType;
+  typedef CurveType::ValueType ValueType;
+  typedef CurveType::DerivativeType DerivativeType;
+  CurveType curve;
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (size_t k = 0; k < 5; ++k) {
+    times.push_back(double(k));
+    values.push_back(ValueType(std::sin(double(k)), std::cos(double(k)), 0.5 * k));
+  }
+  curve.fitCurve(times, values);
+  curve.transformTime(0.5, 1.0);
+
+  ValueType value, sharedValue;
+  DerivativeType derivative;
+  std::array<DerivativeType, 3> derivatives;
+  for (double t = 0.9; t < 3.2; t += 0.05) {
+    ASSERT_TRUE(curve.evaluate<3>(sharedValue, derivatives, t));
+    ASSERT_TRUE(curve.evaluate(value, t));
+    EXPECT_NEAR(0.0, (value - sharedValue).norm(), 1e-10);
+
+    ASSERT_TRUE(curve.evaluateDerivative<1>(derivative, t));
+    EXPECT_NEAR(0.0, (derivative - derivatives[0]).norm(), 1e-10);
+    ASSERT_TRUE(curve.evaluateDerivative<2>(derivative, t));
+    EXPECT_NEAR(0.0, (derivative - derivatives[1]).norm(), 1e-10);
+    ASSERT_TRUE(StaticCurveTraits<CurveType>::evaluateDerivative<3>(curve, derivative, t));
+    EXPECT_NEAR(0.0, (derivative - derivatives[2]).norm(), 1e-10);
+
+    // The runtime order reaches the same implementations.
+    for (unsigned order = 1; order <= 3; ++order) {
+      ASSERT_TRUE(curve.evaluateDerivative(derivative, t, order));
+      EXPECT_NEAR(0.0, (derivative - derivatives[order - 1]).norm(), 1e-10);
+    }
+    EXPECT_FALSE(curve.evaluateDerivative(derivative, t, 0));
+    EXPECT_FALSE(curve.evaluateDerivative(derivative, t, 4));
+  }
+
+  // Jerk from finite differences of the acceleration, away from the knots.
+  const double h = 1e-5;
+  DerivativeType accelerationBefore, accelerationAfter;
+  ASSERT_TRUE(curve.evaluateDerivative<2>(accelerationBefore, 2.3 - h));
+  ASSERT_TRUE(curve.evaluateDerivative<2>(accelerationAfter, 2.3 + h));
+  ASSERT_TRUE(curve.evaluateDerivative<3>(derivative, 2.3));
+  EXPECT_NEAR(0.0, ((accelerationAfter - accelerationBefore) / (2.0 * h) - derivative).norm(), 1e-4);
+}
+
+TEST(StaticCurveTest, compileTimeDerivativeOrderScalar)
+{
+  typedef PolynomialSplineQuinticScalarCurve CurveType;
+  CurveType curve;
+  std::vector<Time> times;
+  std::vector<double> values;
+  for (size_t k = 0; k < 5; ++k) {
+    times.push_back(double(k));
+    values.push_back(std::sin(double(k)));
+  }
+  curve.fitCurve(times, values);
+  curve.transformTime(2.0, 0.5);
+
+  double value, derivative;
+  std::array<double, 3> derivatives;
+  for (double t = 0.6; t < 8.4; t += 0.1) {
+    ASSERT_TRUE(curve.evaluate<3>(value, derivatives, t));
+    for (unsigned order = 1; order <= 3; ++order) {
+      ASSERT_TRUE(curve.evaluateDerivative(derivative, t, order));
+      EXPECT_NEAR(derivative, derivatives[order - 1], 1e-10);
+    }
+    ASSERT_TRUE(curve.evaluateDerivative<2>(derivative, t));
+    EXPECT_NEAR(derivative, derivatives[1], 1e-10);
+  }
+}
+
+TEST(StaticCurveTest, compileTimeDerivativeOrderGaussianProcess)
+{
+  typedef GaussianProcessVectorSpaceCurve<2> CurveType;
+  typedef CurveType::ValueType ValueType;
+  typedef CurveType::DerivativeType DerivativeType;
+  CurveType curve(1.0, 0.01);
+  std::vector<Time> times;
+  std::vector<ValueType> values;
+  for (size_t k = 0; k < 10; ++k) {
+    times.push_back(0.3 * k);
+    values.push_back(ValueType(std::sin(0.3 * k), std::cos(0.3 * k)));
+  }
+  curve.fitCurve(times, values);
+
+  ValueType value, sharedValue;
+  DerivativeType derivative;
+  std::array<DerivativeType, 2> derivatives;
+  for (double t = 0.0; t < 2.7; t += 0.1) {
+    ASSERT_TRUE(curve.evaluate<2>(sharedValue, derivatives, t));
+    ASSERT_TRUE(curve.evaluate(value, t));
+    EXPECT_NEAR(0.0, (value - sharedValue).norm(), 1e-10);
+    for (unsigned order = 1; order <= 2; ++order) {
+      ASSERT_TRUE(curve.evaluateDerivative(derivative, t, order));
+      EXPECT_NEAR(0.0, (derivative - derivatives[order - 1]).norm(), 1e-10);
+    }
+    ASSERT_TRUE(curve.evaluateDerivative<1>(derivative, t));
+    EXPECT_NEAR(0.0, (derivative - derivatives[0]).norm(), 1e-10);
+  }
+  EXPECT_FALSE(curve.evaluateDerivative(derivative, 1.0, 3));
+}